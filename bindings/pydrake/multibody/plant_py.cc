@@ -257,6 +257,10 @@ void DoScalarDependentDefinitions(py::module_ m, T) {
         .def("SetUseSampledOutputPorts", &Class::SetUseSampledOutputPorts,
             py::arg("use_sampled_output_ports"),
             cls_doc.SetUseSampledOutputPorts.doc)
+        .def("set_parallelism", &Class::set_parallelism,
+            py::arg("parallelism"), cls_doc.set_parallelism.doc)
+        .def("get_parallelism", &Class::get_parallelism,
+            cls_doc.get_parallelism.doc)
         .def(
             "AddJoint",
             [](Class* self, const Joint<T>& joint) {
@@ -724,6 +728,37 @@ void DoScalarDependentDefinitions(py::module_ m, T) {
         .def("CalcInverseDynamics", &Class::CalcInverseDynamics,
             py::arg("context"), py::arg("known_vdot"),
             py::arg("external_forces"), cls_doc.CalcInverseDynamics.doc)
+        .def(
+            "CalcInverseDynamicsDerivatives",
+            [](const Class* self, const Context<T>& context,
+                const VectorX<T>& known_vdot,
+                const MultibodyForces<T>& external_forces) {
+              const int nv = self->num_velocities();
+              MatrixX<T> dtau_dq(nv, nv);
+              MatrixX<T> dtau_dv(nv, nv);
+              MatrixX<T> dtau_dvdot(nv, nv);
+              self->CalcInverseDynamicsDerivatives(context, known_vdot,
+                  external_forces, &dtau_dq, &dtau_dv, &dtau_dvdot);
+              return py::make_tuple(dtau_dq, dtau_dv, dtau_dvdot);
+            },
+            py::arg("context"), py::arg("known_vdot"),
+            py::arg("external_forces"),
+            cls_doc.CalcInverseDynamicsDerivatives.doc)
+        .def(
+            "CalcForwardDynamicsDerivatives",
+            [](const Class* self, const Context<T>& context,
+                const MultibodyForces<T>& forces) {
+              const int nv = self->num_velocities();
+              VectorX<T> vdot(nv);
+              MatrixX<T> dvdot_dq(nv, nv);
+              MatrixX<T> dvdot_dv(nv, nv);
+              MatrixX<T> dvdot_dtau(nv, nv);
+              self->CalcForwardDynamicsDerivatives(
+                  context, forces, &vdot, &dvdot_dq, &dvdot_dv, &dvdot_dtau);
+              return py::make_tuple(vdot, dvdot_dq, dvdot_dv, dvdot_dtau);
+            },
+            py::arg("context"), py::arg("forces"),
+            cls_doc.CalcForwardDynamicsDerivatives.doc)
         .def("CalcForceElementsContribution",
             &Class::CalcForceElementsContribution, py::arg("context"),
             py::arg("forces"), cls_doc.CalcForceElementsContribution.doc)
@@ -763,6 +798,21 @@ void DoScalarDependentDefinitions(py::module_ m, T) {
               return H;
             },
             py::arg("context"), cls_doc.CalcMassMatrix.doc)
+        .def("CalcMassMatrixBatch", &Class::CalcMassMatrixBatch,
+            py::arg("context"), py::arg("q_batch"),
+            py::arg("parallelize") = Parallelism::None(),
+            py::call_guard<py::gil_scoped_release>(),
+            cls_doc.CalcMassMatrixBatch.doc)
+        .def("CalcInverseDynamicsBatch", &Class::CalcInverseDynamicsBatch,
+            py::arg("context"), py::arg("x_batch"), py::arg("vdot_batch"),
+            py::arg("parallelize") = Parallelism::None(),
+            py::call_guard<py::gil_scoped_release>(),
+            cls_doc.CalcInverseDynamicsBatch.doc)
+        .def("CalcForwardDynamicsBatch", &Class::CalcForwardDynamicsBatch,
+            py::arg("context"), py::arg("x_batch"),
+            py::arg("parallelize") = Parallelism::None(),
+            py::call_guard<py::gil_scoped_release>(),
+            cls_doc.CalcForwardDynamicsBatch.doc)
         .def(
             "CalcBiasSpatialAcceleration",
             [](const Class* self, const systems::Context<T>& context,
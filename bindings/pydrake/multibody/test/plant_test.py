@@ -3402,6 +3402,36 @@ class TestPlant(unittest.TestCase):
         vd_d = np.zeros(nv)
         tau = plant.CalcInverseDynamics(context, vd_d, MultibodyForces(plant))
         self.assertEqual(tau.shape, (2,))
+        num_samples = 3
+        q_batch = np.tile(plant.GetPositions(context), (num_samples, 1)).T
+        x_batch = np.tile(
+            plant.GetPositionsAndVelocities(context), (num_samples, 1)
+        ).T
+        M_batch = plant.CalcMassMatrixBatch(context=context, q_batch=q_batch)
+        self.assertEqual(len(M_batch), num_samples)
+        numpy_compare.assert_float_equal(M_batch[0], M)
+        tau_batch = plant.CalcInverseDynamicsBatch(
+            context=context,
+            x_batch=x_batch,
+            vdot_batch=np.zeros((nv, num_samples)),
+        )
+        self.assertEqual(tau_batch.shape, (nv, num_samples))
+        numpy_compare.assert_float_equal(tau_batch[:, 0], tau)
+        dtau_dq, dtau_dv, dtau_dvdot = plant.CalcInverseDynamicsDerivatives(
+            context=context,
+            known_vdot=vd_d,
+            external_forces=MultibodyForces(plant),
+        )
+        for dtau in (dtau_dq, dtau_dv, dtau_dvdot):
+            self.assertEqual(dtau.shape, (nv, nv))
+        vdot, dvdot_dq, dvdot_dv, dvdot_dtau = (
+            plant.CalcForwardDynamicsDerivatives(
+                context=context, forces=MultibodyForces(plant)
+            )
+        )
+        self.assertEqual(vdot.shape, (nv,))
+        for dvdot in (dvdot_dq, dvdot_dv, dvdot_dtau):
+            self.assertEqual(dvdot.shape, (nv, nv))
         self.assert_sane(tau, nonzero=False)
         # - Existence checks.
         # Gravity leads to non-zero potential energy.
@@ -3605,6 +3635,12 @@ class TestPlant(unittest.TestCase):
                 plant.get_adjacent_bodies_collision_filters(), value
             )
 
+    def test_parallelism(self):
+        plant = MultibodyPlant_[float](0.1)
+        self.assertEqual(plant.get_parallelism().num_threads(), 1)
+        plant.set_parallelism(parallelism=Parallelism(2))
+        self.assertEqual(plant.get_parallelism().num_threads(), 2)
+
     def test_contact_results_to_lcm(self):
         # ContactResultsToLcmSystem
         file_name = FindResourceOrThrow(
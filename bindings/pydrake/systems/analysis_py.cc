@@ -12,6 +12,7 @@
 #include "drake/bindings/pydrake/pydrake_pybind.h"
 #include "drake/common/scope_exit.h"
 #include "drake/systems/analysis/batch_eval.h"
+#include "drake/systems/analysis/batch_simulate.h"
 #include "drake/systems/analysis/discrete_time_approximation.h"
 #include "drake/systems/analysis/integrator_base.h"
 #include "drake/systems/analysis/monte_carlo.h"
@@ -438,6 +439,17 @@ Parameter ``interruptible``:
   };
   type_visit(bind_nonsymbolic_scalar_types, NonSymbolicScalarPack{});
 
+  m.def("BatchSimulate", &BatchSimulate, py::arg("system"), py::arg("context"),
+      py::arg("initial_states"), py::arg("parameters"), py::arg("inputs"),
+      py::arg("time_step"), py::arg("num_time_steps"),
+      py::arg("output_port_index") =
+          OutputPortSelection::kUseFirstOutputIfItExists,
+      py::arg("input_port_index") =
+          InputPortSelection::kUseFirstInputIfItExists,
+      py::arg("simulator_config") = SimulatorConfig{},
+      py::arg("parallelize") = Parallelism::Max(),
+      py::call_guard<py::gil_scoped_release>(), doc.BatchSimulate.doc);
+
   // Simulator Flags
   m  // BR
       .def(
@@ -1228,7 +1228,14 @@ Note: The above is for the C++ documentation. For Python, use
         .def("get_system", &Diagram<T>::get_system, py_rvp::reference_internal,
             doc.Diagram.get_system.doc)
         .def("AreConnected", &Diagram<T>::AreConnected, py::arg("output"),
-            py::arg("input"), doc.Diagram.AreConnected.doc);
+            py::arg("input"), doc.Diagram.AreConnected.doc)
+        .def("set_update_dispatch_parallelism",
+            &Diagram<T>::set_update_dispatch_parallelism,
+            py::arg("parallelism"),
+            doc.Diagram.set_update_dispatch_parallelism.doc)
+        .def("update_dispatch_parallelism",
+            &Diagram<T>::update_dispatch_parallelism,
+            doc.Diagram.update_dispatch_parallelism.doc);
   }
 
   static void DefineVectorSystem(py::module_ m) {
@@ -14,6 +14,7 @@ from pydrake.systems.analysis import (
     ApplySimulatorConfig,
     BatchEvalTimeDerivatives,
     BatchEvalUniquePeriodicDiscreteUpdate,
+    BatchSimulate,
     DiscreteTimeApproximation,
     ExtractSimulatorConfig,
     InitializeParams,
@@ -31,7 +32,12 @@ from pydrake.systems.analysis import (
     SimulatorConfig,
     SimulatorStatus,
 )
-from pydrake.systems.framework import Context_, DiagramBuilder_, EventStatus
+from pydrake.systems.framework import (
+    Context_,
+    DiagramBuilder_,
+    EventStatus,
+    OutputPortSelection,
+)
 from pydrake.systems.primitives import (
     AffineSystem_,
     ConstantVectorSource,
@@ -186,6 +192,38 @@ class TestAnalysis(unittest.TestCase):
             derivatives, A @ states + B @ inputs
         )
 
+    def test_batch_simulate(self):
+        A = np.array([[0.1, 0.2], [0.3, 0.4]])
+        B = np.array([[0.5, 0.6], [0.7, 0.8]])
+        system = LinearSystem_[float](A, B, time_period=0.1)
+        context = system.CreateDefaultContext()
+
+        initial_states = np.array([[1.2, 1.3, 1.4], [2.1, 2.2, 2.3]])
+        inputs = [np.full((2, 2), i) for i in range(3)]
+        logs = BatchSimulate(
+            system=system,
+            context=context,
+            initial_states=initial_states,
+            parameters=np.zeros((0, 0)),
+            inputs=inputs,
+            time_step=0.1,
+            num_time_steps=2,
+            output_port_index=OutputPortSelection.kNoOutput,
+            simulator_config=SimulatorConfig(),
+            parallelize=Parallelism(num_threads=2),
+        )
+        self.assertEqual(len(logs), 3)
+        for i, log in enumerate(logs):
+            x0 = initial_states[:, i]
+            x1 = A @ x0 + B @ inputs[i][:, 0]
+            x2 = A @ x1 + B @ inputs[i][:, 1]
+            numpy_compare.assert_float_allclose(
+                log.data(), np.column_stack([x0, x1, x2])
+            )
+            numpy_compare.assert_float_allclose(
+                log.sample_times(), [0.0, 0.1, 0.2]
+            )
+
     @numpy_compare.check_nonsymbolic_types
     def test_integrator_api(self, T):
         system = FirstOrderLowPassFilter_[T](time_constant=1.0, size=1)
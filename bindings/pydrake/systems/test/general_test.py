@@ -6,7 +6,7 @@ import unittest
 import numpy as np
 
 from pydrake.autodiffutils import AutoDiffXd
-from pydrake.common import RandomGenerator
+from pydrake.common import Parallelism, RandomGenerator
 from pydrake.common.test_utilities import numpy_compare
 from pydrake.common.value import AbstractValue, Value
 from pydrake.examples import PendulumPlant, RimlessWheel
@@ -1041,6 +1041,9 @@ class TestGeneral(unittest.TestCase):
                 output=adder1.get_output_port(), input=adder2.get_input_port()
             )
         )
+        self.assertEqual(diagram.update_dispatch_parallelism().num_threads(), 1)
+        diagram.set_update_dispatch_parallelism(parallelism=Parallelism(2))
+        self.assertEqual(diagram.update_dispatch_parallelism().num_threads(), 2)
         del adder1, adder2, diagram  # To test keep-alive logic
         gc.collect()
         self.assertEqual(list(connections.keys())[0][0].get_name(), "adder2")
@@ -1,6 +1,7 @@
 #include "drake/common/ad/internal/partials.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <stdexcept>
@@ -27,14 +28,118 @@ int IndexToInt(Eigen::Index index) {
   return static_cast<int>(index);
 }
 
+// The per-thread cache of arrays used by StorageVec. Arrays are always obtained
+// from `new double[]`, so they may freely migrate between threads' caches or
+// back to the heap.
+class StoragePool {
+ public:
+  // Arrays longer than this are never cached.
+  static constexpr int kMaxCachedSize = 64;
+  // The maximum number of arrays cached for each size.
+  static constexpr int kMaxCachedPerSize = 32;
+
+  // Returns the calling thread's pool, or null when the pool has already been
+  // destroyed (e.g., while thread_local AutoDiff objects are being destroyed
+  // during thread exit).
+  static StoragePool* get() {
+    if (destroyed_) [[unlikely]] {
+      return nullptr;
+    }
+    thread_local StoragePool pool;
+    return &pool;
+  }
+
+  ~StoragePool() {
+    destroyed_ = true;
+    Clear();
+  }
+
+  void Clear() {
+    for (FreeList& free_list : free_lists_) {
+      for (int i = 0; i < free_list.count; ++i) {
+        delete[] free_list.data[i];
+      }
+      free_list.count = 0;
+    }
+  }
+
+  double* Acquire(int size) {
+    if (size <= kMaxCachedSize) {
+      FreeList& free_list = free_lists_[size];
+      if (free_list.count > 0) {
+        return free_list.data[--free_list.count];
+      }
+    }
+    return new double[size];
+  }
+
+  void Release(double* data, int size) noexcept {
+    if (size <= kMaxCachedSize) {
+      FreeList& free_list = free_lists_[size];
+      if (free_list.count < kMaxCachedPerSize) {
+        free_list.data[free_list.count++] = data;
+        return;
+      }
+    }
+    delete[] data;
+  }
+
+ private:
+  // A fixed-capacity stack of cached arrays of a single size. The capacity is
+  // fixed so that the pool itself never allocates; the only allocations are
+  // those of the arrays it hands out.
+  struct FreeList {
+    int count{0};
+    std::array<double*, kMaxCachedPerSize> data;
+  };
+
+  // This flag is trivially destructible, so remains valid to check even after
+  // the pool itself has been destroyed.
+  static inline thread_local bool destroyed_{false};
+
+  // The cached arrays, indexed by their size.
+  std::array<FreeList, kMaxCachedSize + 1> free_lists_;
+};
+
+// Creating a thread's pool registers its destructor for thread exit, which
+// allocates. We create the main thread's pool during static initialization so
+// that its first use (e.g., within a LimitMalloc guard) doesn't allocate.
+[[maybe_unused]] const bool kMainThreadPoolCreated =
+    (StoragePool::get() != nullptr);
+
 }  // namespace
 
+double* StorageVec::Acquire(int size) {
+  DRAKE_ASSERT(size > 0);
+  StoragePool* const pool = StoragePool::get();
+  return (pool != nullptr) ? pool->Acquire(size) : new double[size];
+}
+
+void StorageVec::Release(double* data, int size) noexcept {
+  if (data == nullptr) {
+    return;
+  }
+  StoragePool* const pool = StoragePool::get();
+  if (pool != nullptr) {
+    pool->Release(data, size);
+  } else {
+    delete[] data;
+  }
+}
+
+void StorageVec::ClearCacheForTesting() {
+  StoragePool* const pool = StoragePool::get();
+  if (pool != nullptr) {
+    pool->Clear();
+  }
+}
+
 StorageVec StorageVec::Allocate(int size) {
   DRAKE_ASSERT(0 <= size && size <= INT32_MAX);
   StorageVec result;
   if (size > 0) {
     result.size_ = size;
-    result.data_ = new double[size];
+    result.data_ = Acquire(size);
   }
   return result;
 }
@@ -44,7 +149,7 @@ StorageVec::StorageVec(const StorageVec& other) noexcept {
   StorageVec result;
   if (other.size_ > 0) {
     size_ = other.size_;
-    data_ = new double[size_];
+    data_ = Acquire(size_);
     std::copy(other.data_, other.data_ + size_, data_);
   }
 }
@@ -55,10 +160,10 @@ StorageVec& StorageVec::operator=(const StorageVec& other) noexcept {
     if (size_ == other.size_) {
       std::copy(other.data_, other.data_ + other.size_, data_);
     } else {
-      delete[] data_;
+      Release(data_, size_);
       size_ = other.size_;
       if (size_ > 0) {
-        data_ = new double[size_];
+        data_ = Acquire(size_);
         std::copy(other.data_, other.data_ + other.size_, data_);
       } else {
         data_ = nullptr;
@@ -69,7 +174,7 @@ StorageVec& StorageVec::operator=(const StorageVec& other) noexcept {
 }
 
 StorageVec::~StorageVec() {
-  delete[] data_;
+  Release(data_, size_);
 }
 
 Partials::Partials(Eigen::Index size, Eigen::Index offset)
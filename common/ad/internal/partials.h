@@ -11,6 +11,11 @@ namespace internal {
 /* Heap storage for an array of doubles, for use by the Partials class later in
 this file. The storage can be empty (null).
 
+AutoDiff computations create and destroy many temporary Partials, nearly always
+all of the same size. Rather than returning each array to the heap, StorageVec
+recycles small arrays through a per-thread cache of free lists (one per size),
+so that steady-state arithmetic on small derivative vectors doesn't allocate.
+
 Note that this class is not directly unit tested; instead, it's test coverage
 comes from partial_test indirectly. */
 class StorageVec {
@@ -33,7 +38,7 @@ class StorageVec {
   /* Steals the storage from `other`. */
   StorageVec& operator=(StorageVec&& other) noexcept {
     if (this != &other) {
-      delete[] data_;
+      Release(data_, size_);
       size_ = other.size_;
       data_ = other.data_;
       other.size_ = 0;
@@ -57,7 +62,20 @@ class StorageVec {
   const double* data() const { return data_; }
   double* mutable_data() { return data_; }
 
+  /* Returns all arrays in the calling thread's cache to the heap, so that the
+  heap counts of subsequent code don't depend on what earlier code released.
+  This is intended for unit tests only. */
+  static void ClearCacheForTesting();
+
  private:
+  /* Returns an uninitialized array of the given (positive) size, either from
+  the calling thread's cache or from the heap. */
+  static double* Acquire(int size);
+
+  /* Returns the array `data` of the given size (which may be null) to the
+  calling thread's cache or to the heap. */
+  static void Release(double* data, int size) noexcept;
+
   int size_{0};
   double* data_{nullptr};
 };
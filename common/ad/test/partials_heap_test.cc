@@ -49,6 +49,35 @@ TEST_F(PartialsHeapTest, CopyAssign) {
   foo = bar;
 }
 
+// Storage freed by a Partials is recycled for later Partials of the same size,
+// so in steady state small temporaries don't allocate.
+TEST_F(PartialsHeapTest, RecycledStorage) {
+  const VectorXd value = VectorXd::LinSpaced(14, 1.0, 2.0);
+  {
+    Partials warm_up_1(value);
+    Partials warm_up_2(value);
+  }
+  LimitMalloc guard;
+  for (int i = 0; i < 10; ++i) {
+    Partials foo(value);
+    Partials bar(foo);
+    bar.Add(foo);
+  }
+}
+
+// Once the calling thread's cache is cleared, new storage comes from the heap.
+TEST_F(PartialsHeapTest, ClearCacheForTesting) {
+  const VectorXd value = VectorXd::LinSpaced(14, 1.0, 2.0);
+  { Partials warm_up(value); }
+  {
+    LimitMalloc guard;
+    Partials foo(value);
+  }
+  StorageVec::ClearCacheForTesting();
+  LimitMalloc guard({.max_num_allocations = 1, .min_num_allocations = 1});
+  Partials foo(value);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace ad
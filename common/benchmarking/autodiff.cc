@@ -201,6 +201,23 @@ void MatrixMultiply(benchmark::State& state) {  // NOLINT
       state);
 }
 
+// Measures a chain of scalar operations that creates several temporaries per
+// iteration, as typically found in kinematics code, e.g.,
+//  `cos(x) * sin(y) + x * y - sin(y) / (1 + cos(x)²)`.
+// The number of derivatives is given by the benchmark's only argument.
+void ScalarChain(benchmark::State& state) {  // NOLINT
+  const int size = state.range(0);
+  const AD x = MakeScalar<AD>(0.3, kDerivativesDense, size);
+  const AD y = MakeScalar<AD>(0.7, kDerivativesDense, size);
+  tools::performance::TareMemoryManager();
+  for (auto _ : state) {
+    const AD c = cos(x);
+    const AD s = sin(y);
+    AD result = c * s + x * y - s / (1.0 + c * c);
+    benchmark::DoNotOptimize(result);
+  }
+}
+
 void ArgSweep(benchmark::Benchmark* benchmark, bool use_double) {
   for (const auto& left_side : {kDerivativesEmpty, kDerivativesDense}) {
     for (const auto& right_side :
@@ -234,6 +251,11 @@ BENCHMARK(VectorDotProduct)
     ->Apply(VectorArgSweep)
     ->Unit(benchmark::kMicrosecond);
 BENCHMARK(MatrixMultiply)->Apply(MatrixArgSweep)->Unit(benchmark::kMicrosecond);
+BENCHMARK(ScalarChain)
+    ->Arg(7)
+    ->Arg(14)
+    ->Arg(100)
+    ->Unit(benchmark::kMicrosecond);
 
 }  // namespace
 }  // namespace ad
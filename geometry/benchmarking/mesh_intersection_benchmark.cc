@@ -1,8 +1,10 @@
+#include <array>
 #include <iostream>
 #include <memory>
 #include <set>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include <benchmark/benchmark.h>
@@ -12,6 +14,8 @@
 #include "drake/geometry/proximity/make_ellipsoid_mesh.h"
 #include "drake/geometry/proximity/make_sphere_mesh.h"
 #include "drake/geometry/proximity/mesh_intersection.h"
+#include "drake/geometry/proximity/posed_half_space.h"
+#include "drake/geometry/proximity/triangle_tetrahedron_intersection.h"
 #include "drake/math/rigid_transform.h"
 
 namespace drake {
@@ -25,6 +29,10 @@ namespace {
  @ingroup proximity_queries
 
  The benchmark evaluates mesh intersection between compliant and rigid meshes.
+ A second benchmark, ClipTriangles, isolates the narrow phase: it clips every
+ candidate pair of triangle and tetrahedron reported by the broad phase, either
+ with four successive calls to ClipPolygonByHalfSpace() or with the SIMD kernel
+ IntersectTriangleWithTetrahedron().
 
  It computes the contact surface formed from the intersection of an ellipsoid
  and a sphere using broad-phase culling (via a bounding volume hierarchy).
@@ -112,7 +120,7 @@ Resulting contact surface sizes:
  MeshIntersectionBenchmark/TestName/resolution/contact_overlap/rotation_factor/min_time
  ```
 
-   - __TestName__: RigidCompliantMesh
+   - __TestName__: RigidCompliantMesh or ClipTriangles
    - __resolution__: Affects the resolution of the ellipsoid and sphere
      meshes. Valid values must be one of [0, 1, 2, 3], where 0 produces the
      coarsest meshes and 3 produces the finest meshes. This is converted behind
@@ -136,6 +144,8 @@ Resulting contact surface sizes:
      [0, 1, 2, 3]. Note: we use this integer factor instead of directly
      specifying the rotation because Google Benchmark does not accept doubles
      as arguments.
+   - __kernel__ (ClipTriangles only): 0 clips with ClipPolygonByHalfSpace(),
+     1 clips with IntersectTriangleWithTetrahedron().
    - __min_time__: Minimum amount of time to run the benchmark in seconds. This
      needs to be specified for tests that run long in order to get enough
      iterations.
@@ -270,6 +280,58 @@ BENCHMARK_REGISTER_F(MeshIntersectionBenchmark, RigidCompliantMesh)
     ->Args({2, 3, 1})   // 2 resolution, 3 contact overlap, 1 rotation factor.
     ->Args({2, 2, 2});  // 2 resolution, 2 contact overlap, 2 rotation factor.
 
+BENCHMARK_DEFINE_F(MeshIntersectionBenchmark, ClipTriangles)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  SetupMeshes(state);
+  const bool use_kernel = state.range(3) != 0;
+  const auto bvh_S = Bvh<Obb, VolumeMesh<double>>(mesh_S_);
+  const auto bvh_R = Bvh<Obb, TriangleSurfaceMesh<double>>(mesh_R_);
+  // The tetrahedra and triangles (measured and expressed in S) of the
+  // candidate pairs, prepared up front so that we time the clipping alone.
+  std::vector<std::pair<std::array<Vector3d, 4>, std::array<Vector3d, 3>>>
+      candidates;
+  for (const auto& [tet, tri] : bvh_S.GetCollisionCandidates(bvh_R, X_SR_)) {
+    auto& [p_SVs, p_STs] = candidates.emplace_back();
+    for (int i = 0; i < 4; ++i) {
+      p_SVs[i] = mesh_S_.vertex(mesh_S_.element(tet).vertex(i));
+    }
+    for (int i = 0; i < 3; ++i) {
+      p_STs[i] = X_SR_ * mesh_R_.vertex(mesh_R_.element(tri).vertex(i));
+    }
+  }
+  const int faces[4][3] = {{1, 2, 3}, {0, 3, 2}, {0, 1, 3}, {0, 2, 1}};
+  std::vector<Vector3d> in_S;
+  std::vector<Vector3d> out_S;
+  TriangleTetrahedronPolygon polygon_S;
+  int num_polygons = 0;
+  for (auto _ : state) {
+    num_polygons = 0;
+    for (const auto& [p_SVs, p_STs] : candidates) {
+      if (use_kernel) {
+        IntersectTriangleWithTetrahedron(p_SVs, p_STs, &polygon_S);
+        num_polygons += polygon_S.size > 0;
+        continue;
+      }
+      in_S.assign(p_STs.begin(), p_STs.end());
+      for (const auto& face : faces) {
+        const Vector3d& p_SA = p_SVs[face[0]];
+        const Vector3d normal_S =
+            (p_SVs[face[1]] - p_SA).cross(p_SVs[face[2]] - p_SA);
+        ClipPolygonByHalfSpace(in_S, PosedHalfSpace<double>(normal_S, p_SA),
+                               &out_S);
+        std::swap(in_S, out_S);
+      }
+      num_polygons += !in_S.empty();
+    }
+  }
+  state.counters["candidates"] = candidates.size();
+  state.counters["polygons"] = num_polygons;
+}
+BENCHMARK_REGISTER_F(MeshIntersectionBenchmark, ClipTriangles)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({{2, 3}, {3, 4}, {1}, {0, 1}});
+
 void ReportContactSurfaces() {
   std::cout << "Resulting contact surface sizes:" << std::endl;
   for (const auto& output :
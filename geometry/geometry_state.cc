@@ -1710,6 +1710,16 @@ void GeometryState<T>::ApplyProximityDefaults(
              RoleAssign::kReplace);
 }
 
+template <typename T>
+void GeometryState<T>::SetNarrowPhaseParallelism(Parallelism parallelism) {
+  geometry_engine_->set_narrow_phase_parallelism(parallelism);
+}
+
+template <typename T>
+void GeometryState<T>::SetBroadphasePadding(double padding) {
+  geometry_engine_->set_broadphase_padding(padding);
+}
+
 template <typename T>
 unordered_set<GeometryId> GeometryState<T>::CollectIds(
     const GeometrySet& geometry_set, std::optional<Role> role,
@@ -577,6 +577,15 @@ class GeometryState {
         kinematics_data_.X_WGs);
   }
 
+  /** Implementation of QueryObject::ComputePointPairPenetration() with an
+   output argument.  */
+  void ComputePointPairPenetration(
+      std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
+    DRAKE_DEMAND(point_pairs != nullptr);
+    geometry_engine_->ComputePointPairPenetration(kinematics_data_.X_WGs,
+                                                  point_pairs);
+  }
+
   /** Implementation of QueryObject::ComputeContactSurfaces().  */
   template <typename T1 = T>
   typename std::enable_if_t<scalar_predicate<T1>::is_bool,
@@ -587,6 +596,17 @@ class GeometryState {
                                                     kinematics_data_.X_WGs);
   }
 
+  /** Implementation of QueryObject::ComputeContactSurfaces() with an output
+   argument.  */
+  template <typename T1 = T>
+  typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
+  ComputeContactSurfaces(HydroelasticContactRepresentation representation,
+                         std::vector<ContactSurface<T>>* surfaces) const {
+    DRAKE_DEMAND(surfaces != nullptr);
+    geometry_engine_->ComputeContactSurfaces(
+        representation, kinematics_data_.X_WGs, surfaces);
+  }
+
   /** Implementation of QueryObject::ComputeContactSurfacesWithFallback().  */
   template <typename T1 = T>
   typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
@@ -654,6 +674,17 @@ class GeometryState {
         kinematics_data_.X_WGs, max_distance);
   }
 
+  /** Implementation of
+   QueryObject::ComputeSignedDistancePairwiseClosestPoints() with an output
+   argument.  */
+  void ComputeSignedDistancePairwiseClosestPoints(
+      double max_distance,
+      std::vector<SignedDistancePair<T>>* signed_distance_pairs) const {
+    DRAKE_DEMAND(signed_distance_pairs != nullptr);
+    geometry_engine_->ComputeSignedDistancePairwiseClosestPoints(
+        kinematics_data_.X_WGs, max_distance, signed_distance_pairs);
+  }
+
   /** Implementation of
    QueryObject::ComputeSignedDistancePairClosestPoints().  */
   SignedDistancePair<T> ComputeSignedDistancePairClosestPoints(
@@ -754,6 +785,14 @@ class GeometryState {
   void ApplyProximityDefaults(const DefaultProximityProperties& defaults,
                               GeometryId geometry_id);
 
+  /** Sets the parallelism of the narrow phase of the proximity queries. See
+   SceneGraphConfig::narrow_phase_num_threads. */
+  void SetNarrowPhaseParallelism(Parallelism parallelism);
+
+  /** Sets the padding of the broadphase bounding boxes of the dynamic
+   geometries. See SceneGraphConfig::broadphase_padding. */
+  void SetBroadphasePadding(double padding);
+
   //@}
 
  private:
@@ -239,7 +239,16 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
       data.collision_filter == nullptr ||
       data.collision_filter->CanCollideWith(encoding_a.id(), encoding_b.id());
 
-  if (can_collide) {
+  // The broadphase may bound objects by padded boxes (see
+  // ProximityEngine::set_broadphase_padding()) and doesn't cull every pair of
+  // leaves by distance anyway. The distance between the objects' own AABBs is
+  // a lower bound on their signed distance, so we skip the pairs it puts out of
+  // range; that way which pairs reach the narrow phase (and so which
+  // unsupported pairs throw) doesn't depend on the padding.
+  const bool in_range = object_A_ptr->getAABB().distance(
+                            object_B_ptr->getAABB()) <= data.max_distance;
+
+  if (can_collide && in_range) {
     // Throw if the geometry-pair isn't supported.
     if (ScalarSupport<T>::is_supported(
             object_A_ptr->collisionGeometry()->getNodeType(),
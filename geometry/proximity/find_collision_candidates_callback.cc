@@ -25,7 +25,12 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
 
   const bool can_collide =
       data.collision_filter.CanCollideWith(encoding_a.id(), encoding_b.id());
-  if (can_collide) {
+  // The broadphase may bound objects by padded boxes (see
+  // ProximityEngine::set_broadphase_padding()), so we confirm that the
+  // objects' own AABBs overlap; otherwise the candidates would depend on the
+  // padding.
+  if (can_collide &&
+      object_A_ptr->getAABB().overlap(object_B_ptr->getAABB())) {
     data.pairs.emplace_back(encoding_a.id(), encoding_b.id());
   }
   // Tell the broadphase to keep searching.
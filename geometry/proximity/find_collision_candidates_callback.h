@@ -42,7 +42,8 @@ struct CallbackData {
 };
 
 /* The callback function that stores the geometry ids of two shapes identified
- as potentially being in contact by the collision candidates query.
+ as potentially being in contact by the collision candidates query. A pair is
+ stored only if it is not filtered and the AABBs of the two objects overlap.
 
  @param object_A_ptr    Pointer to the first object in the pair (the order has
                         no significance).
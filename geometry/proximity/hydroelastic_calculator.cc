@@ -21,7 +21,8 @@ std::unique_ptr<ContactSurface<T>> CalcRigidCompliant(
     const CompliantGeometry& compliant, const math::RigidTransform<T>& X_WS,
     GeometryId id_S, const RigidGeometry& rigid,
     const math::RigidTransform<T>& X_WR, GeometryId id_R,
-    HydroelasticContactRepresentation representation) {
+    HydroelasticContactRepresentation representation,
+    SurfaceVolumeCandidateCache<Obb>* candidate_cache) {
   if (compliant.is_half_space() || rigid.is_half_space()) {
     if (compliant.is_half_space()) {
       DRAKE_DEMAND(!rigid.is_half_space());
@@ -48,7 +49,8 @@ std::unique_ptr<ContactSurface<T>> CalcRigidCompliant(
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R = rigid.bvh();
 
     return ComputeContactSurfaceFromCompliantVolumeRigidSurface(
-        id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR, representation);
+        id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR, representation,
+        candidate_cache);
   }
 }
 
@@ -76,8 +78,9 @@ ContactCalculator<T>::ContactCalculator(
 
 template <typename T>
 typename ContactCalculator<T>::MaybeMakeContactSurfaceResult
-ContactCalculator<T>::MaybeMakeContactSurface(GeometryId id_A,
-                                              GeometryId id_B) const {
+ContactCalculator<T>::MaybeMakeContactSurface(
+    GeometryId id_A, GeometryId id_B,
+    SurfaceVolumeCandidateCache<Obb>* candidate_cache) const {
   // One or two objects have vanished. We can report that we're done
   // calculating the contact (no contact).
   if (geometries_.is_vanished(id_A) || geometries_.is_vanished(id_B)) {
@@ -149,8 +152,9 @@ ContactCalculator<T>::MaybeMakeContactSurface(GeometryId id_A,
   const math::RigidTransform<T>& X_WS = X_WGs_.at(id_S);
   const math::RigidTransform<T>& X_WR = X_WGs_.at(id_R);
 
-  std::unique_ptr<ContactSurface<T>> surface = CalcRigidCompliant(
-      compliant, X_WS, id_S, rigid, X_WR, id_R, representation_);
+  std::unique_ptr<ContactSurface<T>> surface =
+      CalcRigidCompliant(compliant, X_WS, id_S, rigid, X_WR, id_R,
+                         representation_, candidate_cache);
 
   return {ContactSurfaceResult::kCalculated, std::move(surface)};
 }
@@ -7,6 +7,7 @@
 
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity/hydroelastic_internal.h"
+#include "drake/geometry/proximity/mesh_intersection.h"
 #include "drake/geometry/query_results/contact_surface.h"
 #include "drake/math/rigid_transform.h"
 
@@ -17,13 +18,19 @@ namespace hydroelastic {
 
 /* Computes ContactSurface using the algorithm appropriate to the Shape types
  represented by the given `compliant` and `rigid` geometries.
+
+ If `candidate_cache` is not null and both geometries are meshes, it is used
+ (and updated) as the temporal-coherence cache of the broadphase between the
+ two meshes; the contact surface doesn't depend on it. See
+ SurfaceVolumeCandidateCache.
  @pre The geometries are not *both* half spaces.  */
 template <typename T>
 std::unique_ptr<ContactSurface<T>> CalcRigidCompliant(
     const CompliantGeometry& compliant, const math::RigidTransform<T>& X_WS,
     GeometryId id_S, const RigidGeometry& rigid,
     const math::RigidTransform<T>& X_WR, GeometryId id_R,
-    HydroelasticContactRepresentation representation);
+    HydroelasticContactRepresentation representation,
+    SurfaceVolumeCandidateCache<Obb>* candidate_cache = nullptr);
 
 /* Computes ContactSurface using the algorithm appropriate to the Shape types
  represented by the given `compliant` geometries.
@@ -104,9 +111,14 @@ class ContactCalculator {
 
      @param id_A     Id of the first object in the pair (order insignificant).
      @param id_B     Id of the second object in the pair (order insignificant).
+     @param candidate_cache  If not null, the temporal-coherence cache for this
+                     pair of geometries, used if the pair is a compliant mesh
+                     and a rigid mesh (see CalcRigidCompliant()). The same
+                     cache must always be passed for the same pair.
      @returns both the result code, and the new surface, if any. */
-  MaybeMakeContactSurfaceResult MaybeMakeContactSurface(GeometryId id_A,
-                                                        GeometryId id_B) const;
+  MaybeMakeContactSurfaceResult MaybeMakeContactSurface(
+      GeometryId id_A, GeometryId id_B,
+      SurfaceVolumeCandidateCache<Obb>* candidate_cache = nullptr) const;
 
  private:
   /* The T-valued poses of all geometries.  */
@@ -6,16 +6,20 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <stack>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity/bvh.h"
 #include "drake/geometry/proximity/contact_surface_utility.h"
 #include "drake/geometry/proximity/posed_half_space.h"
 #include "drake/geometry/proximity/triangle_surface_mesh.h"
+#include "drake/geometry/proximity/triangle_tetrahedron_intersection.h"
 #include "drake/geometry/proximity/volume_mesh.h"
 #include "drake/geometry/proximity/volume_mesh_field.h"
 #include "drake/geometry/query_results/contact_surface.h"
@@ -196,7 +200,7 @@ SurfaceVolumeIntersector<MeshBuilder, TetBvType, TriBvType>::
   // `element` of volume_M. Because we are doing this in the M frame, we can
   // leave the volume mesh's quantities as double-valued -- T-values will arise
   // as we do transformed computations below.
-  Vector3<double> p_MVs[4];
+  std::array<Vector3<double>, 4> p_MVs;
   for (int i = 0; i < 4; ++i) {
     int v = volume_M.element(element).vertex(i);
     p_MVs[i] = volume_M.vertex(v);
@@ -227,21 +231,39 @@ SurfaceVolumeIntersector<MeshBuilder, TetBvType, TriBvType>::
   // for the subsequent code, which heavily relies on it being true, from any
   // changes that may be applied to the previous code.
   DRAKE_ASSERT(polygon_M == &(polygon_[0]));
-  std::vector<Vector3<T>>* in_M = polygon_M;
-  std::vector<Vector3<T>>* out_M = &(polygon_[1]);
-  for (auto& face_vertex : faces) {
-    const Vector3<T>& p_MA = p_MVs[face_vertex[0]].cast<T>();
-    const Vector3<T>& p_MB = p_MVs[face_vertex[1]].cast<T>();
-    const Vector3<T>& p_MC = p_MVs[face_vertex[2]].cast<T>();
-    // We'll allow the PosedHalfSpace to normalize our vector.
-    const Vector3<T> normal_M = (p_MB - p_MA).cross(p_MC - p_MA);
-    PosedHalfSpace<T> half_space_M(normal_M, p_MA);
-    // Intersects the output polygon by the half space of each face of the
-    // tetrahedron.
-    ClipPolygonByHalfSpace(*in_M, half_space_M, out_M);
-    std::swap(in_M, out_M);
+  bool clipped = false;
+  if constexpr (std::is_same_v<T, double>) {
+    // For double-valued queries, the kernel below clips by all four faces at
+    // once, without heap allocation, with the same face table (see its
+    // documentation). It declines degenerate tetrahedra, for which the code
+    // below reports the error, and the rare polygon that round-off grows
+    // past its fixed capacity, which the code below clips instead.
+    const std::array<Vector3<double>, 3> p_MTs{(*polygon_M)[0], (*polygon_M)[1],
+                                               (*polygon_M)[2]};
+    TriangleTetrahedronPolygon clipped_M;
+    clipped = IntersectTriangleWithTetrahedron(p_MVs, p_MTs, &clipped_M);
+    if (clipped) {
+      polygon_M->assign(clipped_M.vertices.begin(),
+                        clipped_M.vertices.begin() + clipped_M.size);
+    }
+  }
+  if (!clipped) {
+    std::vector<Vector3<T>>* in_M = polygon_M;
+    std::vector<Vector3<T>>* out_M = &(polygon_[1]);
+    for (auto& face_vertex : faces) {
+      const Vector3<T>& p_MA = p_MVs[face_vertex[0]].cast<T>();
+      const Vector3<T>& p_MB = p_MVs[face_vertex[1]].cast<T>();
+      const Vector3<T>& p_MC = p_MVs[face_vertex[2]].cast<T>();
+      // We'll allow the PosedHalfSpace to normalize our vector.
+      const Vector3<T> normal_M = (p_MB - p_MA).cross(p_MC - p_MA);
+      PosedHalfSpace<T> half_space_M(normal_M, p_MA);
+      // Intersects the output polygon by the half space of each face of the
+      // tetrahedron.
+      ClipPolygonByHalfSpace(*in_M, half_space_M, out_M);
+      std::swap(in_M, out_M);
+    }
+    polygon_M = in_M;
   }
-  polygon_M = in_M;
 
   // TODO(DamrongGuoy): Remove the code below when ClipPolygonByHalfSpace()
   //  stops generating duplicate vertices. See the note in
@@ -287,6 +309,100 @@ bool SurfaceVolumeIntersector<MeshBuilder, TetBvType, TriBvType>::
                                        tri_index, X_MN.rotation());
 }
 
+namespace {
+
+/* Returns a copy of `bv` whose extents are grown by `margin` in every
+ direction. */
+Obb PadBv(const Obb& bv, double margin) {
+  return Obb(bv.pose(), bv.half_width() + Vector3<double>::Constant(margin));
+}
+
+Aabb PadBv(const Aabb& bv, double margin) {
+  return Aabb(bv.center(), bv.half_width() + Vector3<double>::Constant(margin));
+}
+
+}  // namespace
+
+template <typename TetBvType, typename TriBvType>
+SurfaceVolumeCandidateCache<TetBvType, TriBvType>::SurfaceVolumeCandidateCache(
+    double margin)
+    : margin_(margin) {
+  DRAKE_THROW_UNLESS(margin >= 0.0);
+}
+
+template <typename TetBvType, typename TriBvType>
+void SurfaceVolumeCandidateCache<TetBvType, TriBvType>::GetCandidates(
+    const TetBvh& bvh_M, const TriBvh& bvh_N, const math::RigidTransformd& X_MN,
+    std::vector<std::pair<int, int>>* candidate_tet_tri_pairs) {
+  DRAKE_DEMAND(candidate_tet_tri_pairs != nullptr);
+  bool up_to_date = &bvh_M == bvh_M_ && &bvh_N == bvh_N_;
+  if (up_to_date) {
+    // A vertex at p_NV is displaced by (R_MN - R_MN₀)⋅p_NV + p_MoNo - p_MoNo₀
+    // whose norm is bounded using the Frobenius norm of the rotation change.
+    const double displacement =
+        (X_MN.rotation().matrix() - X_MN_.rotation().matrix()).norm() *
+            radius_N_ +
+        (X_MN.translation() - X_MN_.translation()).norm();
+    up_to_date = displacement <= margin_;
+  }
+  if (!up_to_date) Rebuild(bvh_M, bvh_N, X_MN);
+
+  for (const auto& [node_a, node_b] : leaf_pairs_) {
+    if (!TetBvType::HasOverlap(node_a->bv(), node_b->bv(), X_MN)) continue;
+    const int num_a_elements = node_a->num_element_indices();
+    const int num_b_elements = node_b->num_element_indices();
+    for (int a = 0; a < num_a_elements; ++a) {
+      for (int b = 0; b < num_b_elements; ++b) {
+        candidate_tet_tri_pairs->emplace_back(node_a->element_index(a),
+                                              node_b->element_index(b));
+      }
+    }
+  }
+}
+
+template <typename TetBvType, typename TriBvType>
+void SurfaceVolumeCandidateCache<TetBvType, TriBvType>::Rebuild(
+    const TetBvh& bvh_M, const TriBvh& bvh_N,
+    const math::RigidTransformd& X_MN) {
+  bvh_M_ = &bvh_M;
+  bvh_N_ = &bvh_N;
+  X_MN_ = X_MN;
+  const TriBvType& root_bv_N = bvh_N.root_node().bv();
+  radius_N_ = root_bv_N.center().norm() + root_bv_N.half_width().norm();
+  leaf_pairs_.clear();
+  ++num_traversals_;
+
+  // This mirrors Bvh::Collide() so that the leaf pairs are visited in the
+  // same order.
+  using NodePair = std::pair<const TetNode*, const TriNode*>;
+  std::stack<NodePair, std::vector<NodePair>> node_pairs;
+  node_pairs.emplace(&bvh_M.root_node(), &bvh_N.root_node());
+  while (!node_pairs.empty()) {
+    const auto [node_a, node_b] = node_pairs.top();
+    node_pairs.pop();
+
+    if (!TetBvType::HasOverlap(PadBv(node_a->bv(), margin_), node_b->bv(),
+                               X_MN)) {
+      continue;
+    }
+
+    if (node_a->is_leaf() && node_b->is_leaf()) {
+      leaf_pairs_.emplace_back(node_a, node_b);
+    } else if (node_b->is_leaf()) {
+      node_pairs.emplace(&node_a->left(), node_b);
+      node_pairs.emplace(&node_a->right(), node_b);
+    } else if (node_a->is_leaf()) {
+      node_pairs.emplace(node_a, &node_b->left());
+      node_pairs.emplace(node_a, &node_b->right());
+    } else {
+      node_pairs.emplace(&node_a->left(), &node_b->left());
+      node_pairs.emplace(&node_a->right(), &node_b->left());
+      node_pairs.emplace(&node_a->left(), &node_b->right());
+      node_pairs.emplace(&node_a->right(), &node_b->right());
+    }
+  }
+}
+
 template <typename MeshBuilder, typename TetBvType, typename TriBvType>
 void SurfaceVolumeIntersector<MeshBuilder, TetBvType, TriBvType>::
     SampleVolumeFieldOnSurface(
@@ -295,18 +411,24 @@ void SurfaceVolumeIntersector<MeshBuilder, TetBvType, TriBvType>::
         const TriangleSurfaceMesh<double>& surface_N,
         const Bvh<TriBvType, TriangleSurfaceMesh<double>>& bvh_N,
         const math::RigidTransform<T>& X_MN,
-        const bool filter_face_normal_along_field_gradient) {
+        const bool filter_face_normal_along_field_gradient,
+        SurfaceVolumeCandidateCache<TetBvType, TriBvType>* candidate_cache) {
   // Builds the intersection mesh represented in M's frame.
   MeshBuilder builder_M;
   const math::RigidTransform<double>& X_MN_d = convert_to_double(X_MN);
 
   std::vector<std::pair<int, int>> candidate_tet_tri_pairs;
-  bvh_M.Collide(bvh_N, X_MN_d,
-                [&candidate_tet_tri_pairs](
-                    int tet_index, int tri_index) -> BvttCallbackResult {
-                  candidate_tet_tri_pairs.emplace_back(tet_index, tri_index);
-                  return BvttCallbackResult::Continue;
-                });
+  if (candidate_cache != nullptr) {
+    candidate_cache->GetCandidates(bvh_M, bvh_N, X_MN_d,
+                                   &candidate_tet_tri_pairs);
+  } else {
+    bvh_M.Collide(bvh_N, X_MN_d,
+                  [&candidate_tet_tri_pairs](
+                      int tet_index, int tri_index) -> BvttCallbackResult {
+                    candidate_tet_tri_pairs.emplace_back(tet_index, tri_index);
+                    return BvttCallbackResult::Continue;
+                  });
+  }
 
   for (const auto& [tet_index, tri_index] : candidate_tet_tri_pairs) {
     CalcContactPolygon(volume_field_M, surface_N, X_MN, X_MN_d, &builder_M,
@@ -390,7 +512,8 @@ ComputeContactSurfaceFromCompliantVolumeRigidSurface(
     const TriangleSurfaceMesh<double>& mesh_R,
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R,
     const math::RigidTransform<T>& X_WR,
-    HydroelasticContactRepresentation representation) {
+    HydroelasticContactRepresentation representation,
+    SurfaceVolumeCandidateCache<Obb>* candidate_cache) {
   auto process_intersection =
       [&X_WS, id_S,
        id_R](auto&& intersector_in) -> std::unique_ptr<ContactSurface<T>> {
@@ -429,16 +552,23 @@ ComputeContactSurfaceFromCompliantVolumeRigidSurface(
 
   if (representation == HydroelasticContactRepresentation::kTriangle) {
     SurfaceVolumeIntersector<TriMeshBuilder<T>, Obb> intersector;
-    intersector.SampleVolumeFieldOnSurface(field_S, bvh_S, mesh_R, bvh_R, X_SR);
+    intersector.SampleVolumeFieldOnSurface(
+        field_S, bvh_S, mesh_R, bvh_R, X_SR,
+        true /* filter_face_normal_along_field_gradient */, candidate_cache);
     return process_intersection(intersector);
   } else {
     // Polygon.
     SurfaceVolumeIntersector<PolyMeshBuilder<T>, Obb> intersector;
-    intersector.SampleVolumeFieldOnSurface(field_S, bvh_S, mesh_R, bvh_R, X_SR);
+    intersector.SampleVolumeFieldOnSurface(
+        field_S, bvh_S, mesh_R, bvh_R, X_SR,
+        true /* filter_face_normal_along_field_gradient */, candidate_cache);
     return process_intersection(intersector);
   }
 }
 
+template class SurfaceVolumeCandidateCache<Obb, Obb>;
+template class SurfaceVolumeCandidateCache<Obb, Aabb>;
+
 // Hydroelastics use Obb for the bounding volumes of tetrahedra.
 template class SurfaceVolumeIntersector<TriMeshBuilder<double>, Obb>;
 template class SurfaceVolumeIntersector<TriMeshBuilder<AutoDiffXd>, Obb>;
@@ -93,6 +93,91 @@ void ClipPolygonByHalfSpace(const std::vector<Vector3<T>>& input_vertices_F,
 template <typename T>
 void RemoveNearlyDuplicateVertices(std::vector<Vector3<T>>* polygon);
 
+/* %SurfaceVolumeCandidateCache exploits temporal coherence in the broadphase
+ of SurfaceVolumeIntersector::SampleVolumeFieldOnSurface() for a volume mesh M
+ and a surface mesh N whose relative pose changes little from one query to the
+ next (e.g., objects resting in a bin or on a shelf).
+
+ It stores the pairs of leaf nodes of the two hierarchies whose bounding
+ volumes overlap at a reference pose X_MN₀ once the bounding volumes of M are
+ padded by `margin`. As long as no point of the surface mesh is displaced
+ (measured in M) by more than `margin` from where X_MN₀ put it, every pair of
+ nodes that overlaps at the current pose is among those visited at the
+ reference pose. So, testing the stored leaf pairs at the current pose replaces
+ traversing the hierarchies. Once the displacement exceeds the margin, the
+ cache falls back to a full traversal at the current pose, which becomes the
+ new reference pose.
+
+ The candidates reported are those of Bvh::Collide() at the current pose, in
+ the same order, plus possibly pairs whose leaves overlap although an ancestor
+ pair does not. Elements of the latter pairs are separated and contribute
+ nothing to the contact surface, so the contact surface computed with the cache
+ is the same as the one computed without it.
+
+ The cache aliases the nodes of the hierarchies it was last built with. It
+ detects a change of hierarchies (by address) and rebuilds, but its owner must
+ discard it whenever a hierarchy it refers to may have been destroyed.
+
+ @tparam TetBvType  The type of bounding volumes for the tetrahedra in the
+   volume mesh.
+ @tparam TriBvType  The type of bounding volumes for the triangles in the
+   surface mesh. */
+template <typename TetBvType, typename TriBvType = Obb>
+class SurfaceVolumeCandidateCache {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SurfaceVolumeCandidateCache);
+
+  using TetBvh = Bvh<TetBvType, VolumeMesh<double>>;
+  using TriBvh = Bvh<TriBvType, TriangleSurfaceMesh<double>>;
+
+  /* The default padding, in meters. It is large compared to the motion of
+   resting objects over a time step and small compared to typical tetrahedra
+   of hydroelastic meshes. */
+  static constexpr double kDefaultMargin = 1e-3;
+
+  /* Constructs an empty cache with the given padding of the bounding volumes.
+   @pre margin >= 0. */
+  explicit SurfaceVolumeCandidateCache(double margin = kDefaultMargin);
+
+  double margin() const { return margin_; }
+
+  /* Reports the number of full traversals of the hierarchies performed by
+   this cache. */
+  int num_traversals() const { return num_traversals_; }
+
+  /* Appends the pairs of (tetrahedron, triangle) indices that cannot be
+   culled by bounding volumes at the pose X_MN to `candidate_tet_tri_pairs`,
+   traversing the hierarchies only if the cached leaf pairs can't account for
+   the motion since the reference pose.
+   @pre candidate_tet_tri_pairs != nullptr. */
+  void GetCandidates(const TetBvh& bvh_M, const TriBvh& bvh_N,
+                     const math::RigidTransformd& X_MN,
+                     std::vector<std::pair<int, int>>* candidate_tet_tri_pairs);
+
+ private:
+  using TetNode = typename TetBvh::NodeType;
+  using TriNode = typename TriBvh::NodeType;
+
+  /* Collects the overlapping leaf pairs of the padded hierarchies at X_MN and
+   makes X_MN the reference pose. */
+  void Rebuild(const TetBvh& bvh_M, const TriBvh& bvh_N,
+               const math::RigidTransformd& X_MN);
+
+  double margin_{};
+  int num_traversals_{};
+
+  // The hierarchies the cache was last built with; nullptr for an empty cache.
+  const TetBvh* bvh_M_{};
+  const TriBvh* bvh_N_{};
+  // The reference pose and an upper bound on the distance from No to any
+  // vertex of the surface mesh N.
+  math::RigidTransformd X_MN_;
+  double radius_N_{};
+  // The overlapping leaf pairs of the padded hierarchies at X_MN_ in the order
+  // of their traversal.
+  std::vector<std::pair<const TetNode*, const TriNode*>> leaf_pairs_;
+};
+
 // Forward declaration of Tester class, so we can grant friend access.
 template <typename MeshBuilder>
 class SurfaceVolumeIntersectorTester;
@@ -156,6 +241,11 @@ class SurfaceVolumeIntersector {
        If true, allow only contact polygons whose face normals are "along"
        the direction of field gradient vectors. See
        IsFaceNormalAlongPressureGradient().
+   @param[in, out] candidate_cache
+       If not null, the candidate (tetrahedron, triangle) pairs are obtained
+       from (and the cache is updated for) the temporal-coherence cache of this
+       pair of hierarchies instead of traversing the hierarchies; the resulting
+       surface is the same. See SurfaceVolumeCandidateCache.
    @note
        The output surface mesh (see mutable_mesh() and release_mesh()) may
        have duplicate vertices.
@@ -166,7 +256,9 @@ class SurfaceVolumeIntersector {
       const TriangleSurfaceMesh<double>& surface_N,
       const Bvh<TriBvType, TriangleSurfaceMesh<double>>& bvh_N,
       const math::RigidTransform<T>& X_MN,
-      bool filter_face_normal_along_field_gradient = true);
+      bool filter_face_normal_along_field_gradient = true,
+      SurfaceVolumeCandidateCache<TetBvType, TriBvType>* candidate_cache =
+          nullptr);
 
   bool has_intersection() const { return mesh_M_ != nullptr; }
 
@@ -417,6 +509,10 @@ class SurfaceVolumeIntersector {
      The pose of the rigid frame R in the world frame W.
  @param[in] representation
      The preferred representation of each contact polygon.
+ @param[in, out] candidate_cache
+     If not null, the temporal-coherence cache of the broadphase for this pair
+     of geometries (see SurfaceVolumeCandidateCache). It doesn't change the
+     result.
  @return
      The contact surface between M and N. Geometries S and R map to M and N
      with a consistent mapping (as documented in ContactSurface) but without any
@@ -450,7 +546,8 @@ ComputeContactSurfaceFromCompliantVolumeRigidSurface(
     const TriangleSurfaceMesh<double>& mesh_R,
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R,
     const math::RigidTransform<T>& X_WR,
-    HydroelasticContactRepresentation representation);
+    HydroelasticContactRepresentation representation,
+    SurfaceVolumeCandidateCache<Obb>* candidate_cache = nullptr);
 
 }  // namespace internal
 }  // namespace geometry
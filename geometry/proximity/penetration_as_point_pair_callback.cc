@@ -392,6 +392,14 @@ bool Callback(fcl::CollisionObjectd* fcl_object_A_ptr,
   // Since we want *all* collisions, we return false.
   if (!can_collide) return false;
 
+  // The broadphase may bound objects by padded boxes (see
+  // ProximityEngine::set_broadphase_padding()), so we confirm that the
+  // objects' own AABBs overlap; otherwise which pairs reach the narrow phase
+  // (and so which unsupported pairs throw) would depend on the padding.
+  if (!fcl_object_A_ptr->getAABB().overlap(fcl_object_B_ptr->getAABB())) {
+    return false;
+  }
+
   auto result = MaybeMakePointPair(fcl_object_A_ptr, fcl_object_B_ptr, data);
   if (result.has_value()) {
     data.point_pairs.push_back(std::move(*result));
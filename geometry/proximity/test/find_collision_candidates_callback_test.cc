@@ -83,6 +83,34 @@ GTEST_TEST(Callback, RespectsCollisionFilter) {
   EXPECT_EQ(pairs.size(), 0u);
 }
 
+// The broadphase may report pairs whose padded bounding boxes overlap; the
+// callback only keeps them if the objects' own AABBs overlap.
+GTEST_TEST(Callback, RequiresOverlappingAabbs) {
+  CollisionFilter collision_filter;
+
+  EncodedData data_A(GeometryId::get_new_id(), true);
+  EncodedData data_B(GeometryId::get_new_id(), true);
+  collision_filter.AddGeometry(data_A.id());
+  collision_filter.AddGeometry(data_B.id());
+
+  CollisionObjectd box_A(make_shared<Boxd>(1.0, 1.0, 1.0));
+  data_A.write_to(&box_A);
+  CollisionObjectd box_B(make_shared<Boxd>(1.0, 1.0, 1.0));
+  data_B.write_to(&box_B);
+  box_B.setTranslation(Eigen::Vector3d(1.1, 0, 0));
+  box_B.computeAABB();
+
+  vector<SortedPair<GeometryId>> pairs;
+  CallbackData data(&collision_filter, &pairs);
+  Callback(&box_A, &box_B, &data);
+  EXPECT_EQ(pairs.size(), 0u);
+
+  box_B.setTranslation(Eigen::Vector3d(0.9, 0, 0));
+  box_B.computeAABB();
+  Callback(&box_A, &box_B, &data);
+  EXPECT_EQ(pairs.size(), 1u);
+}
+
 }  // namespace
 }  // namespace find_collision_candidates
 }  // namespace internal
@@ -14,6 +14,8 @@
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/proximity/make_box_field.h"
+#include "drake/geometry/proximity/make_box_mesh.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
 #include "drake/math/rigid_transform.h"
@@ -1056,6 +1058,71 @@ TYPED_TEST(MeshIntersectionFixture, TestComputeContactSurfaceCompliantRigid) {
                                                       X_WS);
 }
 
+// The temporal-coherence cache of the broadphase reproduces the contact
+// surfaces computed without it, exactly, while a rigid slab slowly sinks and
+// tilts into a compliant box. The hierarchies are traversed again only when
+// the accumulated motion exceeds the cache's margin or the hierarchies change.
+GTEST_TEST(SurfaceVolumeCandidateCacheTest, MatchesFullTraversal) {
+  const Box box_S(0.1, 0.1, 0.1);
+  const VolumeMesh<double> mesh_S = MakeBoxVolumeMesh<double>(box_S, 0.02);
+  const VolumeMeshFieldLinear<double, double> field_S =
+      MakeBoxPressureField<double>(box_S, &mesh_S, 1e5);
+  const Bvh<Obb, VolumeMesh<double>> bvh_S(mesh_S);
+  const TriangleSurfaceMesh<double> mesh_R =
+      MakeBoxSurfaceMesh<double>(Box(0.2, 0.2, 0.02), 0.02);
+  const Bvh<Obb, TriangleSurfaceMesh<double>> bvh_R(mesh_R);
+  const GeometryId id_S = GeometryId::get_new_id();
+  const GeometryId id_R = GeometryId::get_new_id();
+  const RigidTransformd X_WS(Vector3d(0.01, 0.02, 0.03));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(SurfaceVolumeCandidateCache<Obb>(-1.0),
+                              ".*margin >= 0.*");
+
+  for (const auto representation :
+       {HydroelasticContactRepresentation::kTriangle,
+        HydroelasticContactRepresentation::kPolygon}) {
+    SurfaceVolumeCandidateCache<Obb> cache;
+    EXPECT_EQ(cache.margin(), SurfaceVolumeCandidateCache<Obb>::kDefaultMargin);
+    const int kNumSteps = 10;
+    for (int i = 0; i < kNumSteps; ++i) {
+      // The top of the slab penetrates the bottom of the box by 5 mm, plus
+      // 0.2 mm per step.
+      const RigidTransformd X_WR =
+          X_WS * RigidTransformd(RollPitchYawd(1e-3 * i, 0, 0),
+                                 Vector3d(0.003, 0, -0.055 + 2e-4 * i));
+      const auto expected =
+          ComputeContactSurfaceFromCompliantVolumeRigidSurface(
+              id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR,
+              representation);
+      const auto surface = ComputeContactSurfaceFromCompliantVolumeRigidSurface(
+          id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR, representation,
+          &cache);
+      ASSERT_NE(expected, nullptr);
+      ASSERT_NE(surface, nullptr);
+      EXPECT_TRUE(surface->Equal(*expected));
+    }
+    EXPECT_GT(cache.num_traversals(), 1);
+    EXPECT_LT(cache.num_traversals(), kNumSteps);
+
+    // A copy of the rigid hierarchy at another address forces a traversal.
+    const int num_traversals = cache.num_traversals();
+    const Bvh<Obb, TriangleSurfaceMesh<double>> bvh_R_copy(bvh_R);
+    const RigidTransformd X_WR(Vector3d(0, 0, -0.055));
+    std::vector<std::pair<int, int>> candidates;
+    cache.GetCandidates(bvh_S, bvh_R_copy, X_WS.InvertAndCompose(X_WR),
+                        &candidates);
+    EXPECT_EQ(cache.num_traversals(), num_traversals + 1);
+    // The cache may report extra candidates whose elements are separated.
+    std::vector<std::pair<int, int>> expected_candidates =
+        bvh_S.GetCollisionCandidates(bvh_R_copy, X_WS.InvertAndCompose(X_WR));
+    std::sort(candidates.begin(), candidates.end());
+    std::sort(expected_candidates.begin(), expected_candidates.end());
+    EXPECT_TRUE(std::includes(candidates.begin(), candidates.end(),
+                              expected_candidates.begin(),
+                              expected_candidates.end()));
+  }
+}
+
 /* This test fixture enables some limited testing of the autodiff-valued contact
  surface. It computes the intersection between a rigid triangle mesh (a single
  large triangle) and simple tetrahedral mesh (single tet).
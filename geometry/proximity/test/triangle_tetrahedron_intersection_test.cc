@@ -0,0 +1,154 @@
+#include "drake/geometry/proximity/triangle_tetrahedron_intersection.h"
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "hwy/tests/hwy_gtest.h"
+#include <gtest/gtest.h>
+
+#include "drake/common/hwy_dynamic.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/geometry/proximity/mesh_intersection.h"
+#include "drake/geometry/proximity/posed_half_space.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+
+/* This hwy-infused test fixture replicates every test case to be run against
+ every target architecture variant (e.g., SSE4, AVX2, AVX512VL, etc). When run,
+ it filters the suite to only run tests that the current CPU can handle. */
+class TriangleTetrahedronIntersectionTest : public hwy::TestWithParamTarget {
+ protected:
+  void SetUp() override {
+    // Reset Drake's dispatcher, to be sure that we run all of the target
+    // architectures.
+    drake::internal::HwyDynamicReset();
+    hwy::TestWithParamTarget::SetUp();
+  }
+
+  /* The reference result: the triangle clipped successively by the half
+   spaces of the four faces with ClipPolygonByHalfSpace(), as in
+   SurfaceVolumeIntersector::ClipTriangleByTetrahedron(). */
+  static std::vector<Vector3d> ClipByHalfSpaces(
+      const std::array<Vector3d, 4>& p_MVs,
+      const std::array<Vector3d, 3>& p_MTs) {
+    const int faces[4][3] = {{1, 2, 3}, {0, 3, 2}, {0, 1, 3}, {0, 2, 1}};
+    std::vector<Vector3d> in_M(p_MTs.begin(), p_MTs.end());
+    std::vector<Vector3d> out_M;
+    for (const auto& face : faces) {
+      const Vector3d& p_MA = p_MVs[face[0]];
+      const Vector3d normal_M =
+          (p_MVs[face[1]] - p_MA).cross(p_MVs[face[2]] - p_MA);
+      ClipPolygonByHalfSpace(in_M, PosedHalfSpace<double>(normal_M, p_MA),
+                             &out_M);
+      std::swap(in_M, out_M);
+    }
+    return in_M;
+  }
+
+  /* Compares IntersectTriangleWithTetrahedron() against ClipByHalfSpaces()
+   and returns the number of vertices of the intersection. */
+  static int CompareWithHalfSpaces(const std::array<Vector3d, 4>& p_MVs,
+                                   const std::array<Vector3d, 3>& p_MTs) {
+    TriangleTetrahedronPolygon polygon_M;
+    EXPECT_TRUE(IntersectTriangleWithTetrahedron(p_MVs, p_MTs, &polygon_M));
+    const std::vector<Vector3d> expected_M = ClipByHalfSpaces(p_MVs, p_MTs);
+    EXPECT_EQ(polygon_M.size, ssize(expected_M));
+    if (polygon_M.size != ssize(expected_M)) return 0;
+    for (int i = 0; i < polygon_M.size; ++i) {
+      EXPECT_TRUE(
+          CompareMatrices(polygon_M.vertices[i], expected_M[i], 1e-14));
+    }
+    return polygon_M.size;
+  }
+
+  /* The tetrahedron of (Zero(), UnitX(), UnitY(), UnitZ()), whose fourth
+   vertex sees the first three in counterclockwise order. */
+  const std::array<Vector3d, 4> p_MVs_{Vector3d::Zero(), Vector3d::UnitX(),
+                                       Vector3d::UnitY(), Vector3d::UnitZ()};
+};
+
+// Instantiate the suite for all CPU targets (using the HWY macro).
+HWY_TARGET_INSTANTIATE_TEST_SUITE_P(TriangleTetrahedronIntersectionTest);
+
+// A triangle inside the tetrahedron is returned as is, and a triangle beyond
+// one of its faces is clipped away entirely.
+TEST_P(TriangleTetrahedronIntersectionTest, InsideAndOutside) {
+  const std::array<Vector3d, 3> inside{Vector3d(0.1, 0.1, 0.1),
+                                       Vector3d(0.5, 0.1, 0.1),
+                                       Vector3d(0.1, 0.5, 0.1)};
+  TriangleTetrahedronPolygon polygon_M;
+  ASSERT_TRUE(IntersectTriangleWithTetrahedron(p_MVs_, inside, &polygon_M));
+  ASSERT_EQ(polygon_M.size, 3);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(polygon_M.vertices[i], inside[i]);
+  }
+
+  const std::array<Vector3d, 3> outside{Vector3d(1, 1, 1), Vector3d(2, 1, 1),
+                                        Vector3d(1, 2, 1)};
+  ASSERT_TRUE(IntersectTriangleWithTetrahedron(p_MVs_, outside, &polygon_M));
+  EXPECT_EQ(polygon_M.size, 0);
+  EXPECT_TRUE(ClipByHalfSpaces(p_MVs_, outside).empty());
+}
+
+// A large triangle in the plane z = 0.2 contains the triangular cross section
+// of the tetrahedron, and a triangle cutting across the cross section is
+// clipped to a hexagon.
+TEST_P(TriangleTetrahedronIntersectionTest, CrossSections) {
+  const std::array<Vector3d, 3> large{Vector3d(-1, -1, 0.2),
+                                      Vector3d(3, -1, 0.2),
+                                      Vector3d(-1, 3, 0.2)};
+  EXPECT_EQ(CompareWithHalfSpaces(p_MVs_, large), 3);
+
+  const std::array<Vector3d, 3> star{Vector3d(-0.1, 0.3, 0.2),
+                                     Vector3d(0.6, -0.1, 0.2),
+                                     Vector3d(0.5, 0.5, 0.2)};
+  EXPECT_EQ(CompareWithHalfSpaces(p_MVs_, star), 6);
+}
+
+// Random triangles against a random tetrahedron agree with the successive
+// clipping by half spaces, including the order of the vertices.
+TEST_P(TriangleTetrahedronIntersectionTest, RandomTriangles) {
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<double> coordinate(-0.5, 1.5);
+  auto random_point = [&]() {
+    return Vector3d(coordinate(generator), coordinate(generator),
+                    coordinate(generator));
+  };
+  // Perturb the vertices of the unit tetrahedron while keeping its
+  // orientation.
+  std::array<Vector3d, 4> p_MVs = p_MVs_;
+  for (Vector3d& p_MV : p_MVs) {
+    p_MV += 0.1 * random_point();
+  }
+  int num_nonempty = 0;
+  for (int i = 0; i < 1000; ++i) {
+    const std::array<Vector3d, 3> p_MTs{random_point(), random_point(),
+                                        random_point()};
+    if (CompareWithHalfSpaces(p_MVs, p_MTs) > 0) ++num_nonempty;
+  }
+  // Confirms that the cases are not trivial.
+  EXPECT_GT(num_nonempty, 100);
+}
+
+// The kernel declines a tetrahedron with a degenerate face, which
+// PosedHalfSpace rejects.
+TEST_P(TriangleTetrahedronIntersectionTest, DegenerateTetrahedron) {
+  const std::array<Vector3d, 4> p_MVs{Vector3d::Zero(), Vector3d::UnitX(),
+                                      Vector3d::UnitY(),
+                                      Vector3d(0.5, 0.5, 0)};
+  const std::array<Vector3d, 3> p_MTs{Vector3d::Zero(), Vector3d::UnitX(),
+                                      Vector3d::UnitY()};
+  TriangleTetrahedronPolygon polygon_M;
+  EXPECT_FALSE(IntersectTriangleWithTetrahedron(p_MVs, p_MTs, &polygon_M));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,314 @@
+#include "drake/geometry/proximity/triangle_tetrahedron_intersection.h"
+
+#include <algorithm>
+#include <utility>
+
+// This is the magic juju that compiles our impl functions for multiple CPUs.
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "geometry/proximity/triangle_tetrahedron_intersection.cc"
+#include "hwy/foreach_target.h"
+#include "hwy/highway.h"
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/hwy_dynamic_impl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace drake {
+namespace geometry {
+namespace internal {
+
+using Eigen::Vector3d;
+
+namespace {
+namespace HWY_NAMESPACE {
+// The hn namespace holds the CPU-specific function overloads. By defining it
+// using a substitute-able macro, we achieve per-CPU instruction selection.
+namespace hn = hwy::HWY_NAMESPACE;
+
+// The four faces of the tetrahedron, with right-handed normals pointing
+// outward. This is the same table (in the same order) as in
+// SurfaceVolumeIntersector::ClipTriangleByTetrahedron().
+constexpr int kFaces[4][3] = {{1, 2, 3}, {0, 3, 2}, {0, 1, 3}, {0, 2, 1}};
+
+// The smallest magnitude of a face normal for which Plane is willing to
+// normalize it.
+constexpr double kMinNormalMagnitude = 1e-10;
+
+// The planes of the four faces in structure-of-arrays layout; lane k holds the
+// unit normal and the displacement of face k.
+struct FacePlanes {
+  alignas(32) double nx[4];
+  alignas(32) double ny[4];
+  alignas(32) double nz[4];
+  alignas(32) double displacement[4];
+};
+
+// The SIMD approach is only useful when we have registers of size `double[4]`
+// or larger. When we have smaller registers (e.g., SSE2's 2-wide lanes, or
+// SVE's variable-length vectors) we will fall back to non-SIMD code.
+#if HWY_MAX_BYTES >= 32 && HWY_HAVE_SCALABLE == 0
+
+// Computes the planes of the four faces of the tetrahedron with vertices
+// `p_MVs`. Each plane is computed exactly as PosedHalfSpace computes it from
+// the normal (B - A) × (C - A) and the point A of its face. Returns false if a
+// normal is too small to normalize.
+bool CalcFacePlanes(const std::array<Vector3d, 4>& p_MVs, FacePlanes* planes) {
+  const hn::FixedTag<double, 4> tag;
+  using VecT = hn::Vec<decltype(tag)>;
+
+  // Lane k of a[i] holds the i-th coordinate of vertex A of face k, etc.
+  alignas(32) double a[3][4];
+  alignas(32) double b[3][4];
+  alignas(32) double c[3][4];
+  for (int k = 0; k < 4; ++k) {
+    for (int i = 0; i < 3; ++i) {
+      a[i][k] = p_MVs[kFaces[k][0]][i];
+      b[i][k] = p_MVs[kFaces[k][1]][i];
+      c[i][k] = p_MVs[kFaces[k][2]][i];
+    }
+  }
+  const VecT ax = hn::Load(tag, a[0]);
+  const VecT ay = hn::Load(tag, a[1]);
+  const VecT az = hn::Load(tag, a[2]);
+  const VecT ux = hn::Sub(hn::Load(tag, b[0]), ax);
+  const VecT uy = hn::Sub(hn::Load(tag, b[1]), ay);
+  const VecT uz = hn::Sub(hn::Load(tag, b[2]), az);
+  const VecT vx = hn::Sub(hn::Load(tag, c[0]), ax);
+  const VecT vy = hn::Sub(hn::Load(tag, c[1]), ay);
+  const VecT vz = hn::Sub(hn::Load(tag, c[2]), az);
+
+  // n = u × v. We deliberately avoid fused multiply-adds throughout so that the
+  // planes agree with the scalar PosedHalfSpace to the last bit on targets
+  // that don't contract the scalar code.
+  VecT nx = hn::Sub(hn::Mul(uy, vz), hn::Mul(uz, vy));
+  VecT ny = hn::Sub(hn::Mul(uz, vx), hn::Mul(ux, vz));
+  VecT nz = hn::Sub(hn::Mul(ux, vy), hn::Mul(uy, vx));
+  const VecT magnitude = hn::Sqrt(hn::Add(
+      hn::Add(hn::Mul(nx, nx), hn::Mul(ny, ny)), hn::Mul(nz, nz)));
+  if (!hn::AllFalse(tag,
+                    hn::Lt(magnitude, hn::Set(tag, kMinNormalMagnitude)))) {
+    return false;
+  }
+  nx = hn::Div(nx, magnitude);
+  ny = hn::Div(ny, magnitude);
+  nz = hn::Div(nz, magnitude);
+  const VecT displacement =
+      hn::Add(hn::Add(hn::Mul(nx, ax), hn::Mul(ny, ay)), hn::Mul(nz, az));
+  hn::Store(nx, tag, planes->nx);
+  hn::Store(ny, tag, planes->ny);
+  hn::Store(nz, tag, planes->nz);
+  hn::Store(displacement, tag, planes->displacement);
+  return true;
+}
+
+// Writes the signed distances of the point `p_MQ` to the four face planes
+// into `distances`.
+void CalcSignedDistances(const FacePlanes& planes, const Vector3d& p_MQ,
+                         double* distances) {
+  const hn::FixedTag<double, 4> tag;
+  using VecT = hn::Vec<decltype(tag)>;
+  const VecT xxxx = hn::Set(tag, p_MQ.x());
+  const VecT yyyy = hn::Set(tag, p_MQ.y());
+  const VecT zzzz = hn::Set(tag, p_MQ.z());
+  VecT height = hn::Mul(hn::Load(tag, planes.nx), xxxx);
+  height = hn::Add(height, hn::Mul(hn::Load(tag, planes.ny), yyyy));
+  height = hn::Add(height, hn::Mul(hn::Load(tag, planes.nz), zzzz));
+  height = hn::Sub(height, hn::Load(tag, planes.displacement));
+  hn::Store(height, tag, distances);
+}
+
+#else  // HWY_MAX_BYTES
+
+bool CalcFacePlanes(const std::array<Vector3d, 4>& p_MVs, FacePlanes* planes) {
+  for (int k = 0; k < 4; ++k) {
+    const Vector3d& p_MA = p_MVs[kFaces[k][0]];
+    const Vector3d& p_MB = p_MVs[kFaces[k][1]];
+    const Vector3d& p_MC = p_MVs[kFaces[k][2]];
+    const Vector3d normal_M = (p_MB - p_MA).cross(p_MC - p_MA);
+    const double magnitude = normal_M.norm();
+    if (magnitude < kMinNormalMagnitude) {
+      return false;
+    }
+    const Vector3d nhat_M = normal_M / magnitude;
+    planes->nx[k] = nhat_M.x();
+    planes->ny[k] = nhat_M.y();
+    planes->nz[k] = nhat_M.z();
+    planes->displacement[k] = nhat_M.dot(p_MA);
+  }
+  return true;
+}
+
+void CalcSignedDistances(const FacePlanes& planes, const Vector3d& p_MQ,
+                         double* distances) {
+  for (int k = 0; k < 4; ++k) {
+    distances[k] = planes.nx[k] * p_MQ.x() + planes.ny[k] * p_MQ.y() +
+                   planes.nz[k] * p_MQ.z() - planes.displacement[k];
+  }
+}
+
+#endif  // HWY_MAX_BYTES
+
+// A polygon being clipped, together with the signed distances of each of its
+// vertices to the four face planes.
+struct ClippedPolygon {
+  std::array<Vector3d, TriangleTetrahedronPolygon::kCapacity> vertices;
+  alignas(32) double distances[TriangleTetrahedronPolygon::kCapacity][4];
+  int size{0};
+};
+
+// Appends the point where the edge from `previous` to `current` (vertex
+// indices into `in`) crosses the plane of face k, computed with the same
+// weights as CalcIntersection() in mesh_intersection.cc. Returns false, adding
+// nothing, if `out` is already full.
+bool AddIntersection(const FacePlanes& planes, const ClippedPolygon& in,
+                     int current, int previous, int k, ClippedPolygon* out) {
+  if (out->size == TriangleTetrahedronPolygon::kCapacity) {
+    return false;
+  }
+  const double a = in.distances[current][k];
+  const double b = in.distances[previous][k];
+  // Exactly one of the two vertices is contained (a <= 0 or b <= 0) so a != b.
+  DRAKE_ASSERT(a != b);
+  const double wa = b / (b - a);
+  const double wb = 1.0 - wa;
+  Vector3d& p_MI = out->vertices[out->size];
+  p_MI = wa * in.vertices[current] + wb * in.vertices[previous];
+  CalcSignedDistances(planes, p_MI, out->distances[out->size]);
+  ++out->size;
+  return true;
+}
+
+// Appends vertex `i` of `in` to `out`. Returns false, adding nothing, if `out`
+// is already full.
+bool AddVertex(const ClippedPolygon& in, int i, ClippedPolygon* out) {
+  if (out->size == TriangleTetrahedronPolygon::kCapacity) {
+    return false;
+  }
+  out->vertices[out->size] = in.vertices[i];
+  std::copy(in.distances[i], in.distances[i] + 4, out->distances[out->size]);
+  ++out->size;
+  return true;
+}
+
+// See note in IntersectTriangleWithTetrahedron as to why the parameters are
+// pointers. We're simply assuming that they "can't" be null.
+bool IntersectTriangleWithTetrahedronImpl(
+    const std::array<Vector3d, 4>* p_MVs_ptr,
+    const std::array<Vector3d, 3>* p_MTs_ptr,
+    TriangleTetrahedronPolygon* polygon_M) {
+  const std::array<Vector3d, 4>& p_MVs = *p_MVs_ptr;
+  const std::array<Vector3d, 3>& p_MTs = *p_MTs_ptr;
+
+  FacePlanes planes;
+  if (!CalcFacePlanes(p_MVs, &planes)) {
+    return false;
+  }
+
+  ClippedPolygon buffers[2];
+  ClippedPolygon* in = &buffers[0];
+  ClippedPolygon* out = &buffers[1];
+  for (int i = 0; i < 3; ++i) {
+    in->vertices[i] = p_MTs[i];
+    CalcSignedDistances(planes, p_MTs[i], in->distances[i]);
+  }
+  in->size = 3;
+
+  // Quick classification of the triangle as a whole. As in
+  // ClipPolygonByHalfSpace(), a vertex is contained in a half space iff its
+  // signed distance is non-positive.
+  bool all_contained = true;
+  for (int k = 0; k < 4; ++k) {
+    bool none_contained = true;
+    for (int i = 0; i < 3; ++i) {
+      if (in->distances[i][k] <= 0) {
+        none_contained = false;
+      } else {
+        all_contained = false;
+      }
+    }
+    if (none_contained) {
+      polygon_M->size = 0;
+      return true;
+    }
+  }
+  if (all_contained) {
+    std::copy(p_MTs.begin(), p_MTs.end(), polygon_M->vertices.begin());
+    polygon_M->size = 3;
+    return true;
+  }
+
+  // The modified Sutherland-Hodgman algorithm of ClipPolygonByHalfSpace(),
+  // one face at a time. If round-off makes an intermediate polygon so far from
+  // convex that the clipped polygon doesn't fit in the fixed capacity, we
+  // decline and leave the clipping to ClipPolygonByHalfSpace().
+  for (int k = 0; k < 4 && in->size > 0; ++k) {
+    out->size = 0;
+    int previous = in->size - 1;
+    for (int i = 0; i < in->size; ++i) {
+      const bool previous_contained = in->distances[previous][k] <= 0;
+      const bool current_contained = in->distances[i][k] <= 0;
+      if (current_contained) {
+        if (!previous_contained &&
+            !AddIntersection(planes, *in, i, previous, k, out)) {
+          return false;
+        }
+        if (!AddVertex(*in, i, out)) {
+          return false;
+        }
+      } else if (previous_contained &&
+                 !AddIntersection(planes, *in, i, previous, k, out)) {
+        return false;
+      }
+      previous = i;
+    }
+    std::swap(in, out);
+  }
+
+  std::copy(in->vertices.begin(), in->vertices.begin() + in->size,
+            polygon_M->vertices.begin());
+  polygon_M->size = in->size;
+  return true;
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
+HWY_AFTER_NAMESPACE();
+
+// This part of the file is only compiled once total, instead of once per CPU.
+#if HWY_ONCE
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+// Create the lookup tables for the per-CPU hwy implementation functions, and
+// required functors that select from the lookup tables.
+HWY_EXPORT(IntersectTriangleWithTetrahedronImpl);
+struct ChooseBestIntersectTriangleWithTetrahedronImpl {
+  auto operator()() {
+    return HWY_DYNAMIC_POINTER(IntersectTriangleWithTetrahedronImpl);
+  }
+};
+
+}  // namespace
+
+bool IntersectTriangleWithTetrahedron(
+    const std::array<Vector3<double>, 4>& p_MVs,
+    const std::array<Vector3<double>, 3>& p_MTs,
+    TriangleTetrahedronPolygon* polygon_M) {
+  DRAKE_ASSERT(polygon_M != nullptr);
+  // Note: LateBoundFunction currently copies the parameters (with no obvious
+  // immediate solution). For that reason, the impl function takes pointers so
+  // the cost of the copy is negligible.
+  return LateBoundFunction<
+      ChooseBestIntersectTriangleWithTetrahedronImpl>::Call(&p_MVs, &p_MTs,
+                                                            polygon_M);
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
+#endif  // HWY_ONCE
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* The polygon resulting from clipping a triangle by the four face half spaces
+ of a tetrahedron, stored without heap allocation. Clipping a convex polygon
+ by a half space adds at most one vertex, so the intersection has at most
+ seven vertices. Round-off can make the intermediate polygons very slightly
+ non-convex, so the capacity leaves room for one more vertex; a clip that would
+ exceed it is declined (see IntersectTriangleWithTetrahedron()). */
+struct TriangleTetrahedronPolygon {
+  static constexpr int kCapacity = 8;
+
+  std::array<Vector3<double>, kCapacity> vertices;
+  int size{0};
+};
+
+/* Clips the triangle with vertices `p_MTs` by the tetrahedron with vertices
+ `p_MVs`, both measured and expressed in frame M. The tetrahedron's fourth
+ vertex sees the first three in counterclockwise order, as in VolumeMesh.
+
+ The result is that of clipping the triangle successively by the half spaces
+ of the faces {1, 2, 3}, {0, 3, 2}, {0, 1, 3}, and {0, 2, 1} with
+ ClipPolygonByHalfSpace(), except that:
+
+   - the signed distances of each vertex to the four face planes are evaluated
+     at once with SIMD instructions (selected at runtime for the CPU) and are
+     reused by the subsequent clips, and
+   - a triangle entirely outside one face plane is reported as empty without
+     clipping.
+
+ So the vertices agree with ClipPolygonByHalfSpace() up to round-off, in the
+ same order, and may likewise include nearly duplicate vertices (see
+ RemoveNearlyDuplicateVertices()).
+
+ @param[in] p_MVs      The four vertices of the tetrahedron.
+ @param[in] p_MTs      The three vertices of the triangle.
+ @param[out] polygon_M The clipped polygon; empty if there is no intersection.
+ @returns false, leaving `polygon_M` unspecified, if a face of the tetrahedron
+          is too small to define its plane (see PosedHalfSpace), or if
+          round-off would make the clipped polygon exceed
+          TriangleTetrahedronPolygon::kCapacity vertices. Callers can then fall
+          back to ClipPolygonByHalfSpace(), which reports the error in the
+          former case and handles any number of vertices in the latter.
+ @pre polygon_M != nullptr. */
+bool IntersectTriangleWithTetrahedron(
+    const std::array<Vector3<double>, 4>& p_MVs,
+    const std::array<Vector3<double>, 3>& p_MTs,
+    TriangleTetrahedronPolygon* polygon_M);
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
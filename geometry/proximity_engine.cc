@@ -2,7 +2,10 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <exception>
 #include <filesystem>
+#include <iterator>
 #include <limits>
 #include <map>
 #include <string>
@@ -13,6 +16,7 @@
 #include <utility>
 #include <vector>
 
+#include <common_robotics_utilities/parallelism.hpp>
 #include <fcl/fcl.h>
 #include <fmt/format.h>
 
@@ -37,6 +41,9 @@ namespace geometry {
 namespace internal {
 
 using drake::geometry::internal::HydroelasticType;
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::DynamicParallelForIndexLoop;
+using common_robotics_utilities::parallelism::ParallelForBackend;
 using Eigen::Vector3d;
 using fcl::CollisionObjectd;
 using math::RigidTransform;
@@ -56,8 +63,75 @@ namespace {
 // FCL data types used as member fields of ProximityEngine::Impl. Note
 // that FCL Objects on the stack are fine without worrying about hidden;
 // it's only Impl member fields that cause trouble.
+//
+// Beyond FCL's manager, this supports refitting individual leaves to padded
+// ("fat") bounding boxes (see RefitPadded()). FCL's own incremental update()
+// only refits to the objects' exact AABBs, and has no public access to the
+// leaves, so we index them ourselves. Leaves are only created and destroyed by
+// (un)registering objects, so those invalidate the index.
 class FclDynamicAABBTreeCollisionManager
-    : public fcl::DynamicAABBTreeCollisionManager<double> {};
+    : public fcl::DynamicAABBTreeCollisionManager<double> {
+ public:
+  using Base = fcl::DynamicAABBTreeCollisionManager<double>;
+
+  void registerObjects(const std::vector<CollisionObjectd*>& objects) override {
+    leaves_stale_ = true;
+    Base::registerObjects(objects);
+  }
+
+  void registerObject(CollisionObjectd* object) override {
+    leaves_stale_ = true;
+    Base::registerObject(object);
+  }
+
+  void unregisterObject(CollisionObjectd* object) override {
+    leaves_stale_ = true;
+    Base::unregisterObject(object);
+  }
+
+  void clear() override {
+    leaves_stale_ = true;
+    Base::clear();
+  }
+
+  // If the (up-to-date) AABB of the registered `object` is no longer contained
+  // in the bounding box of its leaf, refits the leaf to the AABB padded by
+  // `padding` on every side and returns true. Otherwise, the tree is left
+  // untouched. Unlike update(), this neither refits the other leaves nor
+  // rebalances the tree.
+  bool RefitPadded(const CollisionObjectd* object, double padding) {
+    if (leaves_stale_) IndexLeaves();
+    DynamicAABBNode* leaf = leaves_.at(object);
+    const fcl::AABBd& aabb = object->getAABB();
+    if (leaf->bv.contain(aabb)) return false;
+    fcl::AABBd padded(aabb);
+    padded.min_.array() -= padding;
+    padded.max_.array() += padding;
+    getTree().update(leaf, padded);
+    return true;
+  }
+
+ private:
+  void IndexLeaves() {
+    leaves_.clear();
+    std::vector<DynamicAABBNode*> nodes;
+    if (getTree().getRoot() != nullptr) nodes.push_back(getTree().getRoot());
+    while (!nodes.empty()) {
+      DynamicAABBNode* node = nodes.back();
+      nodes.pop_back();
+      if (node->isLeaf()) {
+        leaves_[static_cast<const CollisionObjectd*>(node->data)] = node;
+      } else {
+        nodes.push_back(node->children[0]);
+        nodes.push_back(node->children[1]);
+      }
+    }
+    leaves_stale_ = false;
+  }
+
+  std::unordered_map<const CollisionObjectd*, DynamicAABBNode*> leaves_;
+  bool leaves_stale_{true};
+};
 class MapGeometryIdToFclCollisionObject
     : public unordered_map<GeometryId, unique_ptr<CollisionObjectd>> {};
 // Cache entry for a single mesh source file (independent of scale). Stores the
@@ -148,6 +222,66 @@ void FclDistance(const fcl::DynamicAABBTreeCollisionManager<double>& tree1,
                  data, callback);
 }
 
+// The data for CollectDistanceCandidate().
+struct DistanceCandidatesData {
+  const CollisionFilter& collision_filter;
+  const double max_distance;
+  std::vector<std::pair<CollisionObjectd*, CollisionObjectd*>>& pairs;
+};
+
+// A broadphase distance callback that only records the unfiltered pairs of
+// collision objects it is called with, for a subsequent narrow phase. It bounds
+// the broadphase search exactly as shape_distance::Callback() does, so it
+// visits the same pairs.
+bool CollectDistanceCandidate(CollisionObjectd* object_A_ptr,
+                              CollisionObjectd* object_B_ptr,
+                              void* callback_data,
+                              // NOLINTNEXTLINE
+                              double& max_distance) {
+  auto& data = *static_cast<DistanceCandidatesData*>(callback_data);
+  const double kEps = std::numeric_limits<double>::epsilon() / 10;
+  max_distance = std::max(data.max_distance, kEps);
+  const EncodedData encoding_a(*object_A_ptr);
+  const EncodedData encoding_b(*object_B_ptr);
+  if (data.collision_filter.CanCollideWith(encoding_a.id(), encoding_b.id())) {
+    data.pairs.emplace_back(object_A_ptr, object_B_ptr);
+  }
+  return false;
+}
+
+// Calls `narrow_phase(thread_num, k)` for every candidate k in
+// [0, num_candidates), concurrently on `num_threads` threads. Exceptions must
+// not escape a parallel region. Instead, we capture them and re-throw the first
+// one (in candidate order) once all candidates are done, so that the caller
+// sees the same exception as with serial evaluation.
+template <typename NarrowPhase>
+void ParallelForEachCandidate(int num_threads, int num_candidates,
+                              const NarrowPhase& narrow_phase) {
+  std::vector<std::exception_ptr> errors(num_candidates);
+  const auto evaluate = [&](const int thread_num, const int64_t k) {
+    try {
+      narrow_phase(thread_num, static_cast<int>(k));
+    } catch (...) {
+      errors[k] = std::current_exception();
+    }
+  };
+  DynamicParallelForIndexLoop(DegreeOfParallelism(num_threads), 0,
+                              num_candidates, evaluate,
+                              ParallelForBackend::BEST_AVAILABLE);
+  for (const std::exception_ptr& error : errors) {
+    if (error != nullptr) std::rethrow_exception(error);
+  }
+}
+
+// Moves the contents of the per-thread `buffers` to the end of `results`.
+template <typename R>
+void AppendThreadBuffers(std::vector<std::vector<R>>* buffers,
+                         std::vector<R>* results) {
+  for (std::vector<R>& buffer : *buffers) {
+    std::move(buffer.begin(), buffer.end(), std::back_inserter(*results));
+  }
+}
+
 // Compare functions to use with ordering PenetrationAsPointPairs.
 template <typename T>
 bool Order(const PenetrationAsPointPair<T>& p1,
@@ -247,6 +381,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     inactive_dynamic_geometries_ = other.inactive_dynamic_geometries_;
     // We'll conservatively mark the copy as stale.
     inactive_dynamic_stale_ = true;
+    narrow_phase_parallelism_ = other.narrow_phase_parallelism_;
+    broadphase_padding_ = other.broadphase_padding_;
   }
 
   // Only the copy constructor is used to facilitate copying of the parent
@@ -287,6 +423,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     engine->convex_hull_cache_ = this->convex_hull_cache_;
     engine->geometry_to_hull_key_ = this->geometry_to_hull_key_;
     engine->distance_tolerance_ = this->distance_tolerance_;
+    engine->narrow_phase_parallelism_ = this->narrow_phase_parallelism_;
+    engine->broadphase_padding_ = this->broadphase_padding_;
 
     return engine;
   }
@@ -452,6 +590,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // deformable contact representations of rigid (non-deformable)
     // geometries.
     hydroelastic_geometries_.RemoveGeometry(id);
+    RemoveHydroelasticCandidateCaches(id);
     hydroelastic_geometries_.MaybeAddGeometry(geometry.shape(), id,
                                               new_properties);
     const RigidTransformd X_WG = GetX_WG(id, geometry.is_dynamic());
@@ -496,6 +635,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       RemoveGeometry(id, &anchored_tree_, &anchored_objects_);
     }
     hydroelastic_geometries_.RemoveGeometry(id);
+    RemoveHydroelasticCandidateCaches(id);
     geometries_for_deformable_contact_.RemoveGeometry(id);
     mesh_distance_boundary_cahe_.Remove(id);
 
@@ -544,6 +684,21 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   double distance_tolerance() const { return distance_tolerance_; }
 
+  void set_narrow_phase_parallelism(Parallelism parallelism) {
+    narrow_phase_parallelism_ = parallelism;
+  }
+
+  Parallelism narrow_phase_parallelism() const {
+    return narrow_phase_parallelism_;
+  }
+
+  void set_broadphase_padding(double padding) {
+    DRAKE_THROW_UNLESS(std::isfinite(padding) && padding >= 0);
+    broadphase_padding_ = padding;
+  }
+
+  double broadphase_padding() const { return broadphase_padding_; }
+
   // TODO(SeanCurtis-TRI): I could do things here differently a number of ways:
   //  1. I could make this move semantics (or swap semantics).
   //  2. I could simply have a method that returns a mutable reference to such
@@ -567,8 +722,16 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       }
       object_ptr->computeAABB();
       geometries_for_deformable_contact_.UpdateRigidWorldPose(id, X_WG_d);
+      // With padding, only the geometries that have moved out of their padded
+      // boxes touch the tree; those at rest (or nearly so) cost no more than
+      // the computeAABB() above.
+      if (broadphase_padding_ > 0) {
+        dynamic_tree_.RefitPadded(object_ptr.get(), broadphase_padding_);
+      }
+    }
+    if (broadphase_padding_ == 0) {
+      dynamic_tree_.update();
     }
-    dynamic_tree_.update();
     // The poses of inactive geometries may have changed. We'll conservatively
     // mark them as stale.
     inactive_dynamic_stale_ |= has_inactive;
@@ -686,28 +849,58 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     ProcessGeometriesForDeformableContact(sphere, user_data);
   }
 
-  std::vector<SignedDistancePair<T>> ComputeSignedDistancePairwiseClosestPoints(
+  void ComputeSignedDistancePairwiseClosestPoints(
       const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
-      const double max_distance) const {
-    std::vector<SignedDistancePair<T>> witness_pairs;
+      const double max_distance,
+      std::vector<SignedDistancePair<T>>* witness_pairs_out) const {
+    DRAKE_DEMAND(witness_pairs_out != nullptr);
+    std::vector<SignedDistancePair<T>>& witness_pairs = *witness_pairs_out;
+    witness_pairs.clear();
     // All these quantities are aliased in the callback data.
-    shape_distance::CallbackData<T> data{&collision_filter_, &X_WGs,
-                                         max_distance, &witness_pairs};
-    data.request.enable_nearest_points = true;
-    data.request.enable_signed_distance = true;
-    data.request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
-    data.request.distance_tolerance = distance_tolerance_;
+    auto make_callback_data = [&](std::vector<SignedDistancePair<T>>* pairs) {
+      shape_distance::CallbackData<T> data{&collision_filter_, &X_WGs,
+                                           max_distance, pairs};
+      data.request.enable_nearest_points = true;
+      data.request.enable_signed_distance = true;
+      data.request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
+      data.request.distance_tolerance = distance_tolerance_;
+      return data;
+    };
+
+    if (const int num_threads = narrow_phase_num_threads(); num_threads > 1) {
+      // Collect the candidate pairs first, then compute their distances
+      // concurrently.
+      std::vector<std::pair<CollisionObjectd*, CollisionObjectd*>> candidates;
+      DistanceCandidatesData candidates_data{collision_filter_, max_distance,
+                                             candidates};
+      dynamic_tree_.distance(&candidates_data, CollectDistanceCandidate);
+      FclDistance(dynamic_tree_, anchored_tree_, &candidates_data,
+                  CollectDistanceCandidate);
+
+      std::vector<std::vector<SignedDistancePair<T>>> thread_pairs(num_threads);
+      ParallelForEachCandidate(
+          num_threads, ssize(candidates), [&](int thread_num, int k) {
+            auto data = make_callback_data(&thread_pairs[thread_num]);
+            double distance_bound = max_distance;
+            shape_distance::Callback<T>(candidates[k].first,
+                                        candidates[k].second, &data,
+                                        distance_bound);
+          });
+      AppendThreadBuffers(&thread_pairs, &witness_pairs);
+    } else {
+      auto data = make_callback_data(&witness_pairs);
 
-    // Perform a query of the dynamic objects against themselves.
-    dynamic_tree_.distance(&data, shape_distance::Callback<T>);
+      // Perform a query of the dynamic objects against themselves.
+      dynamic_tree_.distance(&data, shape_distance::Callback<T>);
 
-    // Perform a query of the dynamic objects against the anchored. We don't do
-    // anchored against anchored because those pairs are implicitly filtered.
-    FclDistance(dynamic_tree_, anchored_tree_, &data,
-                shape_distance::Callback<T>);
+      // Perform a query of the dynamic objects against the anchored. We don't
+      // do anchored against anchored because those pairs are implicitly
+      // filtered.
+      FclDistance(dynamic_tree_, anchored_tree_, &data,
+                  shape_distance::Callback<T>);
+    }
     std::sort(witness_pairs.begin(), witness_pairs.end(),
               OrderSignedDistancePair<T>);
-    return witness_pairs;
   }
 
   /* Searches for an fcl::CollisionObject associated with the given `id`.
@@ -842,26 +1035,46 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     return distances;
   }
 
-  std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration(
-      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
-    std::vector<PenetrationAsPointPair<T>> contacts;
-    penetration_as_point_pair::CallbackData data{&collision_filter_, &X_WGs,
-                                                 &contacts};
+  void ComputePointPairPenetration(
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      std::vector<PenetrationAsPointPair<T>>* contacts_out) const {
+    DRAKE_DEMAND(contacts_out != nullptr);
+    std::vector<PenetrationAsPointPair<T>>& contacts = *contacts_out;
+    contacts.clear();
+
+    if (const int num_threads = narrow_phase_num_threads(); num_threads > 1) {
+      // Collect the candidate pairs first, then evaluate them concurrently.
+      const std::vector<SortedPair<GeometryId>> candidates =
+          FindCollisionCandidates();
+      std::vector<std::vector<PenetrationAsPointPair<T>>> thread_contacts(
+          num_threads);
+      ParallelForEachCandidate(
+          num_threads, ssize(candidates), [&](int thread_num, int k) {
+            penetration_as_point_pair::CallbackData data{
+                &collision_filter_, &X_WGs, &thread_contacts[thread_num]};
+            const auto& [id0, id1] = candidates[k];
+            penetration_as_point_pair::Callback<T>(GetFclPtr(id0),
+                                                   GetFclPtr(id1), &data);
+          });
+      AppendThreadBuffers(&thread_contacts, &contacts);
+    } else {
+      penetration_as_point_pair::CallbackData data{&collision_filter_, &X_WGs,
+                                                   &contacts};
 
-    // Perform a query of the dynamic objects against themselves.
-    dynamic_tree_.collide(&data, penetration_as_point_pair::Callback<T>);
+      // Perform a query of the dynamic objects against themselves.
+      dynamic_tree_.collide(&data, penetration_as_point_pair::Callback<T>);
 
-    // Perform a query of the dynamic objects against the anchored. We don't do
-    // anchored against anchored because those pairs are implicitly filtered.
-    FclCollide(dynamic_tree_, anchored_tree_, &data,
-               penetration_as_point_pair::Callback<T>);
+      // Perform a query of the dynamic objects against the anchored. We don't
+      // do anchored against anchored because those pairs are implicitly
+      // filtered.
+      FclCollide(dynamic_tree_, anchored_tree_, &data,
+                 penetration_as_point_pair::Callback<T>);
+    }
 
     std::sort(contacts.begin(), contacts.end(),
               [](const auto& a, const auto& b) {
                 return Order<T>(a, b);
               });
-
-    return contacts;
   }
 
   std::vector<SortedPair<GeometryId>> FindCollisionCandidates() const {
@@ -903,34 +1116,36 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   }
 
   template <typename T1 = T>
-  typename std::enable_if_t<scalar_predicate<T1>::is_bool,
-                            std::vector<ContactSurface<T>>>
+  typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
   ComputeContactSurfaces(
       HydroelasticContactRepresentation representation,
-      const unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
+      const unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      std::vector<ContactSurface<T>>* surfaces) const {
+    DRAKE_DEMAND(surfaces != nullptr);
+    surfaces->clear();
     std::vector<SortedPair<GeometryId>> candidates = FindCollisionCandidates();
 
-    vector<ContactSurface<T>> surfaces;
     // All these quantities are aliased in the calculator.
     hydroelastic::ContactCalculator<T> calculator{
         &X_WGs, &hydroelastic_geometries_, representation};
 
-    // As a suggestion to future thread parallelizers, make available a fully
-    // allocated and prepared vector for results of the parallelizable step.
+    // Each candidate writes its result into its own slot, so the results are
+    // in candidate order regardless of the number of threads.
     vector<std::unique_ptr<ContactSurface<T>>> surface_ptrs(candidates.size());
-    // TODO(rpoyner-tri): try some thread parallelism here.
-    for (int k = 0; k < ssize(candidates); ++k) {
+    const vector<SurfaceVolumeCandidateCache<Obb>*> caches =
+        GetHydroelasticCandidateCaches(candidates);
+    ForEachCandidate(ssize(candidates), [&](int, int k) {
       const auto& [id0, id1] = candidates[k];
-      auto [result, surface] = calculator.MaybeMakeContactSurface(id0, id1);
+      auto [result, surface] =
+          calculator.MaybeMakeContactSurface(id0, id1, caches[k]);
       if (ContactSurfaceFailed(result)) {
         ThrowOnFailedResult(result, GetFclPtr(id0), GetFclPtr(id1));
       } else if (surface != nullptr) {
         surface_ptrs[k] = std::move(surface);
       }
-    }
-    CullFlatten(&surface_ptrs, &surfaces);
-    DRAKE_ASSERT(IsSortedByOrder(surfaces));
-    return surfaces;
+    });
+    CullFlatten(&surface_ptrs, surfaces);
+    DRAKE_ASSERT(IsSortedByOrder(*surfaces));
   }
 
   template <typename T1 = T>
@@ -951,15 +1166,17 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     penetration_as_point_pair::CallbackData<T> point_data{&collision_filter_,
                                                           &X_WGs, point_pairs};
 
-    // As a suggestion to future thread parallelizers, make available fully
-    // allocated and prepared vectors for results of the parallelizable steps.
+    // Each candidate writes its results into its own slots, so the results
+    // are in candidate order regardless of the number of threads.
     vector<std::unique_ptr<ContactSurface<T>>> surface_ptrs(candidates.size());
     vector<std::optional<PenetrationAsPointPair<T>>> point_pair_maybes(
         candidates.size());
-    // TODO(rpoyner-tri): try some thread parallelism here.
-    for (int k = 0; k < ssize(candidates); ++k) {
+    const vector<SurfaceVolumeCandidateCache<Obb>*> caches =
+        GetHydroelasticCandidateCaches(candidates);
+    ForEachCandidate(ssize(candidates), [&](int, int k) {
       const auto& [id0, id1] = candidates[k];
-      auto [result, surface] = calculator.MaybeMakeContactSurface(id0, id1);
+      auto [result, surface] =
+          calculator.MaybeMakeContactSurface(id0, id1, caches[k]);
       if (ContactSurfaceFailed(result)) {
         auto penetration = penetration_as_point_pair::MaybeMakePointPair(
             GetFclPtr(id0), GetFclPtr(id1), point_data);
@@ -969,7 +1186,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       } else if (surface != nullptr) {
         surface_ptrs[k] = std::move(surface);
       }
-    }
+    });
     CullFlatten(&surface_ptrs, surfaces);
     DRAKE_ASSERT(IsSortedByOrder(*surfaces));
     CullFlatten(&point_pair_maybes, point_pairs);
@@ -1124,6 +1341,10 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     return true;
   }
 
+  int num_hydroelastic_candidate_caches() const {
+    return ssize(hydroelastic_candidate_caches_);
+  }
+
  private:
   // Engine on one scalar can see the members of other engines.
   friend class ProximityEngineTester;
@@ -1137,6 +1358,96 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     return static_cast<CollisionObjectd*>(GetCollisionObject(id));
   }
 
+  // Removes the hydroelastic candidate caches of all pairs involving `id`.
+  void RemoveHydroelasticCandidateCaches(GeometryId id) {
+    std::erase_if(hydroelastic_candidate_caches_, [id](const auto& entry) {
+      return entry.first.first() == id || entry.first.second() == id;
+    });
+  }
+
+  // Reports if the hydroelastic contact between the geometries of `pair` would
+  // intersect a compliant volume mesh with a rigid surface mesh, the only case
+  // that uses a hydroelastic candidate cache.
+  bool UsesHydroelasticCandidateCache(
+      const SortedPair<GeometryId>& pair) const {
+    const auto& [id_A, id_B] = pair;
+    if (hydroelastic_geometries_.is_vanished(id_A) ||
+        hydroelastic_geometries_.is_vanished(id_B)) {
+      return false;
+    }
+    const HydroelasticType type_A =
+        hydroelastic_geometries_.hydroelastic_type(id_A);
+    const HydroelasticType type_B =
+        hydroelastic_geometries_.hydroelastic_type(id_B);
+    if (type_A == HydroelasticType::kRigid &&
+        type_B == HydroelasticType::kCompliant) {
+      return !hydroelastic_geometries_.rigid_geometry(id_A).is_half_space() &&
+             !hydroelastic_geometries_.compliant_geometry(id_B).is_half_space();
+    }
+    if (type_A == HydroelasticType::kCompliant &&
+        type_B == HydroelasticType::kRigid) {
+      return !hydroelastic_geometries_.compliant_geometry(id_A)
+                  .is_half_space() &&
+             !hydroelastic_geometries_.rigid_geometry(id_B).is_half_space();
+    }
+    return false;
+  }
+
+  // Returns the hydroelastic candidate caches of the given pairs, creating
+  // them as necessary, or null for the pairs that don't use one. Caches of
+  // pairs that are no longer candidates are discarded, so the map only grows
+  // with the number of mesh-mesh candidates. The map of caches must not be
+  // modified during a concurrent narrow phase, so we look up all of the
+  // entries beforehand; pointers to them remain valid.
+  vector<SurfaceVolumeCandidateCache<Obb>*> GetHydroelasticCandidateCaches(
+      const vector<SortedPair<GeometryId>>& candidates) const {
+    std::unordered_set<SortedPair<GeometryId>> cached_pairs;
+    for (const SortedPair<GeometryId>& pair : candidates) {
+      if (UsesHydroelasticCandidateCache(pair)) {
+        cached_pairs.insert(pair);
+      }
+    }
+    std::erase_if(hydroelastic_candidate_caches_,
+                  [&cached_pairs](const auto& entry) {
+                    return !cached_pairs.contains(entry.first);
+                  });
+    vector<SurfaceVolumeCandidateCache<Obb>*> caches(candidates.size(),
+                                                     nullptr);
+    for (int k = 0; k < ssize(candidates); ++k) {
+      if (cached_pairs.contains(candidates[k])) {
+        caches[k] = &hydroelastic_candidate_caches_[candidates[k]];
+      }
+    }
+    return caches;
+  }
+
+  // The number of threads for the narrow phase of the queries. Only double and
+  // AutoDiffXd are safe to evaluate concurrently.
+  int narrow_phase_num_threads() const {
+    if constexpr (scalar_predicate<T>::is_bool) {
+      return narrow_phase_parallelism_.num_threads();
+    } else {
+      return 1;
+    }
+  }
+
+  // Calls `narrow_phase(thread_num, k)` for every candidate k in
+  // [0, num_candidates), concurrently if so configured. Otherwise, the
+  // candidates are evaluated in order with thread_num = 0.
+  template <typename NarrowPhase>
+  void ForEachCandidate(int num_candidates,
+                        const NarrowPhase& narrow_phase) const {
+    const int num_threads =
+        std::min(narrow_phase_num_threads(), num_candidates);
+    if (num_threads > 1) {
+      ParallelForEachCandidate(num_threads, num_candidates, narrow_phase);
+    } else {
+      for (int k = 0; k < num_candidates; ++k) {
+        narrow_phase(0, k);
+      }
+    }
+  }
+
   // Overload for when the parameters are largely stashed within a ReifyData
   // instance.
   void InflateAabbForHydroelasticTypesOnly(const Shape& shape,
@@ -1474,10 +1785,29 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // @see ProximityEngine::set_distance_tolerance() for more details.
   double distance_tolerance_{1E-6};
 
+  // @see ProximityEngine::set_narrow_phase_parallelism() for more details.
+  Parallelism narrow_phase_parallelism_{false};
+
+  // @see ProximityEngine::set_broadphase_padding() for more details.
+  double broadphase_padding_{0.0};
+
   // All of the hydroelastic representations of supported geometries -- this
   // can get quite large based on mesh resolution.
   hydroelastic::Geometries hydroelastic_geometries_;
 
+  // The temporal-coherence caches of the broadphase between compliant and
+  // rigid meshes for hydroelastic contact surfaces, keyed by geometry pair.
+  // Only the pairs that were candidates of the last hydroelastic query have
+  // entries. They alias the bounding volume hierarchies of
+  // hydroelastic_geometries_, so they are never copied, and an entry is
+  // removed along with the hydroelastic representation of either of its
+  // geometries. Like
+  // mesh_distance_boundary_cahe_, this is updated by const queries and is not
+  // threadsafe.
+  mutable std::unordered_map<SortedPair<GeometryId>,
+                             SurfaceVolumeCandidateCache<Obb>>
+      hydroelastic_candidate_caches_;
+
   // All of the geometries that produce contacts that involve deformable
   // geometries. This includes deformable geometries as well as rigid geometry
   // representations that participate in contacts with deformable geometries.
@@ -1620,6 +1950,26 @@ double ProximityEngine<T>::distance_tolerance() const {
   return impl_->distance_tolerance();
 }
 
+template <typename T>
+void ProximityEngine<T>::set_narrow_phase_parallelism(Parallelism parallelism) {
+  impl_->set_narrow_phase_parallelism(parallelism);
+}
+
+template <typename T>
+Parallelism ProximityEngine<T>::narrow_phase_parallelism() const {
+  return impl_->narrow_phase_parallelism();
+}
+
+template <typename T>
+void ProximityEngine<T>::set_broadphase_padding(double padding) {
+  impl_->set_broadphase_padding(padding);
+}
+
+template <typename T>
+double ProximityEngine<T>::broadphase_padding() const {
+  return impl_->broadphase_padding();
+}
+
 template <typename T>
 template <typename U>
 std::unique_ptr<ProximityEngine<U>> ProximityEngine<T>::ToScalarType() const {
@@ -1667,7 +2017,19 @@ std::vector<SignedDistancePair<T>>
 ProximityEngine<T>::ComputeSignedDistancePairwiseClosestPoints(
     const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
     const double max_distance) const {
-  return impl_->ComputeSignedDistancePairwiseClosestPoints(X_WGs, max_distance);
+  std::vector<SignedDistancePair<T>> witness_pairs;
+  ComputeSignedDistancePairwiseClosestPoints(X_WGs, max_distance,
+                                             &witness_pairs);
+  return witness_pairs;
+}
+
+template <typename T>
+void ProximityEngine<T>::ComputeSignedDistancePairwiseClosestPoints(
+    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    const double max_distance,
+    std::vector<SignedDistancePair<T>>* witness_pairs) const {
+  impl_->ComputeSignedDistancePairwiseClosestPoints(X_WGs, max_distance,
+                                                    witness_pairs);
 }
 
 template <typename T>
@@ -1707,7 +2069,16 @@ std::vector<PenetrationAsPointPair<T>>
 ProximityEngine<T>::ComputePointPairPenetration(
     const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
     const {
-  return impl_->ComputePointPairPenetration(X_WGs);
+  std::vector<PenetrationAsPointPair<T>> point_pairs;
+  ComputePointPairPenetration(X_WGs, &point_pairs);
+  return point_pairs;
+}
+
+template <typename T>
+void ProximityEngine<T>::ComputePointPairPenetration(
+    const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+    std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
+  impl_->ComputePointPairPenetration(X_WGs, point_pairs);
 }
 
 template <typename T>
@@ -1717,7 +2088,19 @@ typename std::enable_if_t<scalar_predicate<T1>::is_bool,
 ProximityEngine<T>::ComputeContactSurfaces(
     HydroelasticContactRepresentation representation,
     const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
-  return impl_->ComputeContactSurfaces(representation, X_WGs);
+  std::vector<ContactSurface<T>> surfaces;
+  impl_->ComputeContactSurfaces(representation, X_WGs, &surfaces);
+  return surfaces;
+}
+
+template <typename T>
+template <typename T1>
+typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
+ProximityEngine<T>::ComputeContactSurfaces(
+    HydroelasticContactRepresentation representation,
+    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    std::vector<ContactSurface<T>>* surfaces) const {
+  impl_->ComputeContactSurfaces(representation, X_WGs, surfaces);
 }
 
 template <typename T>
@@ -1822,11 +2205,24 @@ bool ProximityEngine<T>::geometry_hull_reverse_map_consistent() const {
   return impl_->geometry_hull_reverse_map_consistent();
 }
 
+template <typename T>
+int ProximityEngine<T>::num_hydroelastic_candidate_caches() const {
+  return impl_->num_hydroelastic_candidate_caches();
+}
+
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     (&ProximityEngine<T>::template ToScalarType<U>));
 
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
-    (&ProximityEngine<T>::template ComputeContactSurfaces<T>,
+    (static_cast<std::vector<ContactSurface<T>> (ProximityEngine<T>::*)(
+         HydroelasticContactRepresentation,
+         const std::unordered_map<GeometryId, RigidTransform<T>>&) const>(
+         &ProximityEngine<T>::template ComputeContactSurfaces<T>),
+     static_cast<void (ProximityEngine<T>::*)(
+         HydroelasticContactRepresentation,
+         const std::unordered_map<GeometryId, RigidTransform<T>>&,
+         std::vector<ContactSurface<T>>*) const>(
+         &ProximityEngine<T>::template ComputeContactSurfaces<T>),
      &ProximityEngine<T>::template ComputeContactSurfacesWithFallback<T>));
 
 template void ProximityEngine<double>::ComputeDeformableContact<double>(
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "drake/common/autodiff.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/sorted_pair.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_roles.h"
@@ -210,6 +211,33 @@ class ProximityEngine {
 
   double distance_tolerance() const;
 
+  /* Sets the parallelism of the narrow phase of ComputePointPairPenetration(),
+   ComputeSignedDistancePairwiseClosestPoints(), ComputeContactSurfaces(), and
+   ComputeContactSurfacesWithFallback(). With more than one thread, those
+   queries first collect the candidate pairs from the broadphase and then
+   evaluate the candidates concurrently, each thread into its own buffer. The
+   results are the same (in the same order) for any number of threads. The
+   default is serial evaluation through the broadphase callbacks. The narrow
+   phase of scalar types other than double and AutoDiffXd is always serial. */
+  void set_narrow_phase_parallelism(Parallelism parallelism);
+
+  Parallelism narrow_phase_parallelism() const;
+
+  /* Sets the padding (in meters) of the bounding boxes with which the
+   broadphase bounds the active dynamic geometries. With zero padding (the
+   default), UpdateWorldPoses() refits every bounding box to its geometry's
+   AABB and rebalances the whole tree. With positive padding, a geometry's
+   bounding box is only refit (to its AABB padded by `padding` on every side)
+   once the geometry's AABB escapes it, so geometries at rest or moving less
+   than the padding cost no tree updates. The results of the queries do not
+   depend on the padding; larger padding means fewer refits, but more pairs
+   that the broadphase passes on to be rejected by their exact AABBs or by the
+   narrow phase.
+   @throws std::exception if `padding` is negative or not finite. */
+  void set_broadphase_padding(double padding);
+
+  double broadphase_padding() const;
+
   //@}
 
   /* Updates the poses for all active dynamic geometries in the engine.
@@ -258,6 +286,15 @@ class ProximityEngine {
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
       const double max_distance) const;
 
+  /* Overload of ComputeSignedDistancePairwiseClosestPoints() that writes the
+   results into `witness_pairs`, replacing its contents but keeping its
+   capacity.
+   @pre witness_pairs != nullptr. */
+  void ComputeSignedDistancePairwiseClosestPoints(
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      const double max_distance,
+      std::vector<SignedDistancePair<T>>* witness_pairs) const;
+
   /* Implementation of
    GeometryState::ComputeSignedDistancePairClosestPoints().
    This includes `X_WGs`, the current poses of all geometries in World in the
@@ -303,6 +340,13 @@ class ProximityEngine {
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
       const;
 
+  /* Overload of ComputePointPairPenetration() that writes the results into
+   `point_pairs`, replacing its contents but keeping its capacity.
+   @pre point_pairs != nullptr. */
+  void ComputePointPairPenetration(
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      std::vector<PenetrationAsPointPair<T>>* point_pairs) const;
+
   /* Implementation of GeometryState::ComputeContactSurfaces().
    @param X_WGs the current poses of all geometries in World in the
                 current scalar type, keyed on each geometry's GeometryId.  */
@@ -314,6 +358,16 @@ class ProximityEngine {
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
       const;
 
+  /* Overload of ComputeContactSurfaces() that writes the results into
+   `surfaces`, replacing its contents but keeping its capacity.
+   @pre surfaces != nullptr. */
+  template <typename T1 = T>
+  typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
+  ComputeContactSurfaces(
+      HydroelasticContactRepresentation representation,
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      std::vector<ContactSurface<T>>* surfaces) const;
+
   /* Implementation of GeometryState::ComputeContactSurfacesWithFallback().
    @param X_WGs the current poses of all geometries in World in the
                 current scalar type, keyed on each geometry's GeometryId.  */
@@ -420,6 +474,8 @@ class ProximityEngine {
   bool geometry_hull_key_absent(GeometryId id) const;
   // Returns true if every reverse-map entry points to a valid cache entry.
   bool geometry_hull_reverse_map_consistent() const;
+  // Returns the number of pairs with a hydroelastic candidate cache.
+  int num_hydroelastic_candidate_caches() const;
 };
 
 }  // namespace internal
@@ -132,6 +132,17 @@ QueryObject<T>::ComputePointPairPenetration() const {
   return state.ComputePointPairPenetration();
 }
 
+template <typename T>
+void QueryObject<T>::ComputePointPairPenetration(
+    std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
+  DRAKE_DEMAND(point_pairs != nullptr);
+  ThrowIfNotCallable();
+
+  FullPoseAndConfigurationUpdate();
+  const GeometryState<T>& state = geometry_state();
+  state.ComputePointPairPenetration(point_pairs);
+}
+
 template <typename T>
 std::vector<SortedPair<GeometryId>> QueryObject<T>::FindCollisionCandidates()
     const {
@@ -164,6 +175,20 @@ QueryObject<T>::ComputeContactSurfaces(
   return state.ComputeContactSurfaces(representation);
 }
 
+template <typename T>
+template <typename T1>
+typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
+QueryObject<T>::ComputeContactSurfaces(
+    HydroelasticContactRepresentation representation,
+    std::vector<ContactSurface<T>>* surfaces) const {
+  DRAKE_DEMAND(surfaces != nullptr);
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  state.ComputeContactSurfaces(representation, surfaces);
+}
+
 template <typename T>
 template <typename T1>
 typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
@@ -207,6 +232,19 @@ QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints(
   return state.ComputeSignedDistancePairwiseClosestPoints(max_distance);
 }
 
+template <typename T>
+void QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints(
+    const double max_distance,
+    std::vector<SignedDistancePair<T>>* signed_distance_pairs) const {
+  DRAKE_DEMAND(signed_distance_pairs != nullptr);
+  ThrowIfNotCallable();
+
+  FullPoseAndConfigurationUpdate();
+  const GeometryState<T>& state = geometry_state();
+  state.ComputeSignedDistancePairwiseClosestPoints(max_distance,
+                                                   signed_distance_pairs);
+}
+
 template <typename T>
 SignedDistancePair<T> QueryObject<T>::ComputeSignedDistancePairClosestPoints(
     GeometryId geometry_id_A, GeometryId geometry_id_B) const {
@@ -298,7 +336,12 @@ const GeometryState<T>& QueryObject<T>::geometry_state() const {
 }
 
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
-    (&QueryObject<T>::template ComputeContactSurfaces<T>,
+    (static_cast<std::vector<ContactSurface<T>> (QueryObject<T>::*)(
+         HydroelasticContactRepresentation) const>(
+         &QueryObject<T>::template ComputeContactSurfaces<T>),
+     static_cast<void (QueryObject<T>::*)(
+         HydroelasticContactRepresentation, std::vector<ContactSurface<T>>*)
+         const>(&QueryObject<T>::template ComputeContactSurfaces<T>),
      &QueryObject<T>::template ComputeContactSurfacesWithFallback<T>));
 
 template void QueryObject<double>::ComputeDeformableContact<double>(
@@ -325,6 +325,19 @@ class QueryObject {
   // clang-format on
   std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration() const;
 
+  /** An overload of ComputePointPairPenetration() that writes into a
+   caller-owned vector instead of returning a new one. Reusing the same vector
+   across calls keeps its capacity, which spares the repeated allocation of the
+   results.
+
+   @param[out] point_pairs  The vector that the penetrations will be written
+                            to. Any data passed in is cleared before the
+                            computation.
+   @pre point_pairs != nullptr.
+   @note This overload is not bound in Python.  */
+  void ComputePointPairPenetration(
+      std::vector<PenetrationAsPointPair<T>>* point_pairs) const;
+
   // Disable formatter to preserve doxygen tables.
   // clang-format off
   /** Reports pairwise intersections and characterizes each non-empty
@@ -411,6 +424,25 @@ class QueryObject {
   ComputeContactSurfaces(
       HydroelasticContactRepresentation representation) const;
 
+  /** An overload of ComputeContactSurfaces() that writes into a caller-owned
+   vector instead of returning a new one. Reusing the same vector across calls
+   keeps its capacity, which spares the repeated allocation of the results
+   (but not of the meshes of the contact surfaces).
+
+   @param representation    Controls the mesh representation of the contact
+                            surface. See
+                            @ref contact_surface_discrete_representation
+                            "contact surface representation" for more details.
+   @param[out] surfaces     The vector that the contact surfaces will be
+                            written to. Any data passed in is cleared before the
+                            computation.
+   @pre surfaces != nullptr.
+   @note This overload is not bound in Python.  */
+  template <typename T1 = T>
+  typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
+  ComputeContactSurfaces(HydroelasticContactRepresentation representation,
+                         std::vector<ContactSurface<T>>* surfaces) const;
+
   /** Reports pairwise intersections and characterizes each non-empty
    intersection as a ContactSurface _where possible_ and as a
    PenetrationAsPointPair where not.
@@ -697,6 +729,22 @@ class QueryObject {
       const double max_distance =
           std::numeric_limits<double>::infinity()) const;
 
+  /** An overload of ComputeSignedDistancePairwiseClosestPoints() that writes
+   into a caller-owned vector instead of returning a new one. Reusing the same
+   vector across calls keeps its capacity, which spares the repeated
+   allocation of the results.
+
+   @param max_distance  The maximum distance at which distance data is reported.
+   @param[out] signed_distance_pairs
+                        The vector that the signed distances will be written
+                        to. Any data passed in is cleared before the
+                        computation.
+   @pre signed_distance_pairs != nullptr.
+   @note This overload is not bound in Python.  */
+  void ComputeSignedDistancePairwiseClosestPoints(
+      double max_distance,
+      std::vector<SignedDistancePair<T>>* signed_distance_pairs) const;
+
   /** A variant of ComputeSignedDistancePairwiseClosestPoints() which computes
    the signed distance (and witnesses) between a specific pair of geometries
    indicated by id. This function has the same restrictions on scalar report
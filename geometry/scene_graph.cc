@@ -147,6 +147,9 @@ class SceneGraph<T>::Hub {
       // Our cache was out-of-date, so we need to refresh it.
       auto result = std::make_unique<GeometryState<T>>(model_);
       result->ApplyProximityDefaults(config_.default_proximity_properties);
+      result->SetNarrowPhaseParallelism(
+          Parallelism(config_.narrow_phase_num_threads));
+      result->SetBroadphasePadding(config_.broadphase_padding);
       augmented_model_cache_ =
           std::make_unique<const GeometryState<T>>(*result);
       return result;
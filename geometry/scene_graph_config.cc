@@ -1,5 +1,6 @@
 #include "drake/geometry/scene_graph_config.h"
 
+#include <cmath>
 #include <functional>
 
 #include "drake/geometry/proximity_properties.h"
@@ -97,6 +98,18 @@ void DefaultProximityProperties::ValidateOrThrow() const {
 
 void SceneGraphConfig::ValidateOrThrow() const {
   default_proximity_properties.ValidateOrThrow();
+  if (narrow_phase_num_threads < 1) {
+    throw std::logic_error(fmt::format(
+        "Invalid scene graph configuration: 'narrow_phase_num_threads' ({}) "
+        "must be positive.",
+        narrow_phase_num_threads));
+  }
+  if (!(broadphase_padding >= 0 && std::isfinite(broadphase_padding))) {
+    throw std::logic_error(fmt::format(
+        "Invalid scene graph configuration: 'broadphase_padding' ({}) must be "
+        "non-negative and finite.",
+        broadphase_padding));
+  }
 }
 
 }  // namespace geometry
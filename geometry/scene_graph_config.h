@@ -166,12 +166,32 @@ struct SceneGraphConfig {
   template <typename Archive>
   void Serialize(Archive* a) {
     a->Visit(DRAKE_NVP(default_proximity_properties));
+    a->Visit(DRAKE_NVP(narrow_phase_num_threads));
+    a->Visit(DRAKE_NVP(broadphase_padding));
   }
 
   /** Provides SceneGraph-wide contact material values to use when none have
   been otherwise specified. */
   DefaultProximityProperties default_proximity_properties;
 
+  /** The number of threads with which to evaluate the narrow phase of the
+  point-pair penetration, pairwise signed distance, and contact surface
+  queries. With more than one thread, the broadphase first collects the
+  candidate pairs of geometries, which are then evaluated concurrently. The
+  results do not depend on the number of threads. The narrow phase of the
+  symbolic scalar type is always serial. Must be positive. */
+  int narrow_phase_num_threads{1};
+
+  /** The padding (in meters) of the bounding boxes with which the broadphase
+  bounds the dynamic geometries. When zero, every bounding box is refit to its
+  geometry whenever the poses change. When positive, a geometry's bounding box
+  is padded by this distance on every side and is only refit once the geometry
+  moves out of it, so that geometries at rest (or moving by less than the
+  padding between pose updates) don't cost any broadphase updates. The query
+  results do not depend on the padding, but larger padding lets more pairs of
+  nearby geometries through the broadphase. Must be non-negative and finite. */
+  double broadphase_padding{0.0};
+
   /** Throws if the values are inconsistent. */
   void ValidateOrThrow() const;
 };
@@ -10,6 +10,7 @@
 #include <ranges>
 #include <set>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -143,6 +144,12 @@ class ProximityEngineTester {
       const ProximityEngine<double>& engine) {
     return engine.geometry_hull_reverse_map_consistent();
   }
+
+  // Returns the number of geometry pairs with a hydroelastic candidate cache.
+  static int num_hydroelastic_candidate_caches(
+      const ProximityEngine<double>& engine) {
+    return engine.num_hydroelastic_candidate_caches();
+  }
 };
 
 namespace deformable {
@@ -2067,6 +2074,43 @@ TEST_F(ProximityEngineTests, ComputeContactSurfaces) {
   EXPECT_FALSE(derivs.isZero());
 }
 
+// Only the compliant-mesh, rigid-mesh pairs among the candidates of the latest
+// hydroelastic query have candidate caches.
+TEST_F(ProximityEngineTests, HydroelasticCandidateCaches) {
+  using Tester = ProximityEngineTester;
+  const Sphere sphere(0.5);
+  const double d = sphere.radius() * 2 * 0.9;
+  ProximityProperties compliant_props;
+  AddCompliantHydroelasticProperties(0.5, 1e-8, &compliant_props);
+  ProximityProperties rigid_props;
+  AddRigidHydroelasticProperties(0.5, &rigid_props);
+
+  // A compliant sphere intersects the rigid sphere R and another compliant
+  // sphere; only the former pair intersects two meshes with a candidate cache.
+  AddDynamic(sphere, V3{0, 0, 0}, compliant_props);
+  const GeometryId id_R = AddDynamic(sphere, V3{d, 0, 0}, rigid_props);
+  AddDynamic(sphere, V3{-d, 0, 0}, compliant_props);
+
+  auto eval_dut = [this]() {
+    engine_.UpdateWorldPoses(X_WGs_);
+    return engine_.ComputeContactSurfaces(
+        HydroelasticContactRepresentation::kTriangle, X_WGs_);
+  };
+
+  EXPECT_EQ(eval_dut().size(), 2);
+  EXPECT_EQ(Tester::num_hydroelastic_candidate_caches(engine_), 1);
+
+  // Once R is no longer a candidate, its cache is discarded.
+  X_WGs_[id_R] = RigidTransformd(V3{10 * d, 0, 0});
+  EXPECT_EQ(eval_dut().size(), 1);
+  EXPECT_EQ(Tester::num_hydroelastic_candidate_caches(engine_), 0);
+
+  // It's recreated when R returns.
+  X_WGs_[id_R] = RigidTransformd(V3{d, 0, 0});
+  EXPECT_EQ(eval_dut().size(), 2);
+  EXPECT_EQ(Tester::num_hydroelastic_candidate_caches(engine_), 1);
+}
+
 /* ComputeContactSurfacesWithFallback() responsibilities:
   1. Empty engine produces no results.
   2. Collision result for dynamic-dynamic pair.
@@ -2293,6 +2337,261 @@ TEST_F(ProximityEngineTests, FindCollisionCandidates) {
   EXPECT_EQ(results, results2);
 }
 
+// The overloads of ComputePointPairPenetration(),
+// ComputeSignedDistancePairwiseClosestPoints(), and ComputeContactSurfaces()
+// with output arguments replace the contents of the given vectors with the
+// same results as the overloads that return them.
+TEST_F(ProximityEngineTests, OutputArgumentOverloads) {
+  const Sphere sphere(0.5);
+  ProximityProperties props;
+  AddCompliantHydroelasticProperties(0.5, 1e-8, &props);
+  const GeometryId id_A = AddAnchored(sphere, V3{0, 0, 0}, props);
+  const GeometryId id_B = AddDynamic(sphere, V3{0.9, 0, 0}, props);
+  const GeometryId id_C = AddDynamic(sphere, V3{2.5, 0, 0}, props);
+  engine_.UpdateWorldPoses(X_WGs_);
+
+  // Stale contents, which must not survive the queries.
+  std::vector<PenetrationAsPointPair<double>> point_pairs(3);
+  std::vector<SignedDistancePair<double>> distance_pairs(3);
+  std::vector<ContactSurface<double>> surfaces;
+  surfaces.push_back(engine_.ComputeContactSurfaces(
+      HydroelasticContactRepresentation::kPolygon, X_WGs_)[0]);
+  surfaces.push_back(surfaces[0]);
+
+  engine_.ComputePointPairPenetration(X_WGs_, &point_pairs);
+  ASSERT_EQ(point_pairs.size(), 1);
+  EXPECT_EQ(point_pairs[0].id_A, std::min(id_A, id_B));
+  EXPECT_EQ(point_pairs[0].depth,
+            engine_.ComputePointPairPenetration(X_WGs_)[0].depth);
+
+  engine_.ComputeSignedDistancePairwiseClosestPoints(X_WGs_, 1.0,
+                                                     &distance_pairs);
+  const std::vector<SignedDistancePair<double>> expected_distance_pairs =
+      engine_.ComputeSignedDistancePairwiseClosestPoints(X_WGs_, 1.0);
+  ASSERT_EQ(distance_pairs.size(), 2);
+  ASSERT_EQ(expected_distance_pairs.size(), 2);
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_EQ(distance_pairs[i].id_A, expected_distance_pairs[i].id_A);
+    EXPECT_EQ(distance_pairs[i].id_B, expected_distance_pairs[i].id_B);
+    EXPECT_EQ(distance_pairs[i].distance, expected_distance_pairs[i].distance);
+  }
+  EXPECT_EQ(SortedPair<GeometryId>(distance_pairs[1].id_A,
+                                   distance_pairs[1].id_B),
+            SortedPair<GeometryId>(id_B, id_C));
+
+  engine_.ComputeContactSurfaces(HydroelasticContactRepresentation::kTriangle,
+                                 X_WGs_, &surfaces);
+  ASSERT_EQ(surfaces.size(), 1);
+  EXPECT_TRUE(surfaces[0].is_triangle());
+  EXPECT_EQ(surfaces[0].total_area(),
+            engine_
+                .ComputeContactSurfaces(
+                    HydroelasticContactRepresentation::kTriangle, X_WGs_)[0]
+                .total_area());
+}
+
+/* The narrow phase of ComputePointPairPenetration(),
+ ComputeSignedDistancePairwiseClosestPoints(), ComputeContactSurfaces(), and
+ ComputeContactSurfacesWithFallback() produces the same results in the same
+ order for any parallelism; the parallelism survives copies and scalar
+ conversion; and an exception thrown by the narrow phase of one candidate
+ propagates out of a parallel query. */
+TEST_F(ProximityEngineTests, NarrowPhaseParallelism) {
+  EXPECT_EQ(engine_.narrow_phase_parallelism().num_threads(), 1);
+
+  // A row of overlapping spheres, alternating between anchored and dynamic,
+  // next to a row of overlapping dynamic spheres.
+  const Sphere sphere(0.5);
+  const double d = sphere.radius() * 2 * 0.9;
+  ProximityProperties props;
+  AddCompliantHydroelasticProperties(0.5, 1e-8, &props);
+  for (int i = 0; i < 8; ++i) {
+    if (i % 2 == 0) {
+      AddAnchored(sphere, V3{i * d, 0, 0}, props);
+    } else {
+      AddDynamic(sphere, V3{i * d, 0, 0}, props);
+    }
+    AddDynamic(sphere, V3{i * d, 2, 0}, props);
+  }
+  engine_.UpdateWorldPoses(X_WGs_);
+
+  using enum HydroelasticContactRepresentation;
+  auto evaluate = [this](const ProximityEngine<double>& engine) {
+    std::vector<std::tuple<GeometryId, GeometryId, double>> results;
+    for (const auto& pair : engine.ComputePointPairPenetration(X_WGs_)) {
+      results.emplace_back(pair.id_A, pair.id_B, pair.depth);
+    }
+    for (const auto& pair :
+         engine.ComputeSignedDistancePairwiseClosestPoints(X_WGs_, 1.5)) {
+      results.emplace_back(pair.id_A, pair.id_B, pair.distance);
+    }
+    for (const auto& surface :
+         engine.ComputeContactSurfaces(kTriangle, X_WGs_)) {
+      results.emplace_back(surface.id_M(), surface.id_N(),
+                           surface.total_area());
+    }
+    std::vector<ContactSurface<double>> surfaces;
+    std::vector<PenetrationAsPointPair<double>> point_pairs;
+    engine.ComputeContactSurfacesWithFallback(kPolygon, X_WGs_, &surfaces,
+                                              &point_pairs);
+    for (const auto& surface : surfaces) {
+      results.emplace_back(surface.id_M(), surface.id_N(),
+                           surface.total_area());
+    }
+    EXPECT_TRUE(point_pairs.empty());
+    return results;
+  };
+
+  const auto expected = evaluate(engine_);
+  // Each row has 7 intersecting pairs, so we get 14 penetrations and twice 14
+  // contact surfaces. Within 1.5 of each other are the 10 + 13 pairs one or
+  // two apart in a row (except for the anchored pairs) and the 8 + 14 pairs
+  // across the rows at most one apart.
+  ASSERT_EQ(expected.size(), 14 + (10 + 13 + 8 + 14) + 2 * 14);
+
+  engine_.set_narrow_phase_parallelism(Parallelism(3));
+  EXPECT_EQ(engine_.narrow_phase_parallelism().num_threads(), 3);
+  EXPECT_EQ(evaluate(engine_), expected);
+  const ProximityEngine<double> copy(engine_);
+  EXPECT_EQ(copy.narrow_phase_parallelism().num_threads(), 3);
+  EXPECT_EQ(evaluate(copy), expected);
+  EXPECT_EQ(engine_.ToScalarType<AutoDiffXd>()
+                ->narrow_phase_parallelism()
+                .num_threads(),
+            3);
+
+  // A sphere without hydroelastic properties in contact with a compliant one
+  // is an unsupported pair for ComputeContactSurfaces().
+  AddDynamic(sphere, V3{7 * d, 0.5, 0});
+  engine_.UpdateWorldPoses(X_WGs_);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine_.ComputeContactSurfaces(kTriangle, X_WGs_),
+      ".*without hydroelastic representation.*");
+}
+
+// Padding the broadphase bounding boxes doesn't change the results of the
+// queries as the geometries move by less or more than the padding.
+TEST_F(ProximityEngineTests, BroadphasePadding) {
+  EXPECT_EQ(engine_.broadphase_padding(), 0);
+  DRAKE_EXPECT_THROWS_MESSAGE(engine_.set_broadphase_padding(-0.1),
+                              ".*padding >= 0.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine_.set_broadphase_padding(std::numeric_limits<double>::infinity()),
+      ".*isfinite.*");
+
+  // A grid of dynamic spheres, a quarter of their radius apart, above a row of
+  // anchored spheres.
+  const Sphere sphere(0.1);
+  ProximityProperties props;
+  AddCompliantHydroelasticProperties(0.1, 1e-8, &props);
+  std::vector<std::pair<GeometryId, Vector3d>> dynamic_positions;
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      const Vector3d p_WG(0.25 * i, 0.25 * j, 0);
+      dynamic_positions.emplace_back(AddDynamic(sphere, p_WG, props), p_WG);
+    }
+    AddAnchored(sphere, V3{0.25 * i, 0, -0.25}, props);
+  }
+  engine_.UpdateWorldPoses(X_WGs_);
+  ProximityEngine<double> reference(engine_);
+  engine_.set_broadphase_padding(0.05);
+  EXPECT_EQ(engine_.broadphase_padding(), 0.05);
+
+  using enum HydroelasticContactRepresentation;
+  auto evaluate = [this](const ProximityEngine<double>& engine) {
+    std::vector<std::tuple<GeometryId, GeometryId, double>> results;
+    for (const auto& [id_A, id_B] : engine.FindCollisionCandidates()) {
+      results.emplace_back(id_A, id_B, 0);
+    }
+    for (const auto& pair : engine.ComputePointPairPenetration(X_WGs_)) {
+      results.emplace_back(pair.id_A, pair.id_B, pair.depth);
+    }
+    for (const auto& pair :
+         engine.ComputeSignedDistancePairwiseClosestPoints(X_WGs_, 0.05)) {
+      results.emplace_back(pair.id_A, pair.id_B, pair.distance);
+    }
+    for (const auto& surface :
+         engine.ComputeContactSurfaces(kTriangle, X_WGs_)) {
+      results.emplace_back(surface.id_M(), surface.id_N(),
+                           surface.total_area());
+    }
+    return results;
+  };
+
+  // Half of the dynamic spheres stay nearly at rest, within the padding, while
+  // the others move in and out of contact with their neighbors.
+  int num_contacts = 0;
+  for (int step = 0; step < 20; ++step) {
+    for (int k = 0; k < ssize(dynamic_positions); ++k) {
+      const auto& [id, p_WG] = dynamic_positions[k];
+      const double amplitude = k % 2 == 0 ? 0.002 : 0.08;
+      X_WGs_[id].set_translation(
+          p_WG + amplitude * Vector3d(std::sin(0.7 * step + k),
+                                      std::cos(1.3 * step + 2 * k), 0));
+    }
+    engine_.UpdateWorldPoses(X_WGs_);
+    reference.UpdateWorldPoses(X_WGs_);
+    const auto expected = evaluate(reference);
+    EXPECT_EQ(evaluate(engine_), expected);
+    EXPECT_EQ(engine_.HasCollisions(), reference.HasCollisions());
+    num_contacts += ssize(engine_.ComputePointPairPenetration(X_WGs_));
+  }
+  // Confirms that the cases are not trivial.
+  EXPECT_GT(num_contacts, 0);
+
+  const ProximityEngine<double> copy(engine_);
+  EXPECT_EQ(copy.broadphase_padding(), 0.05);
+  EXPECT_EQ(evaluate(copy), evaluate(reference));
+  EXPECT_EQ(engine_.ToScalarType<AutoDiffXd>()->broadphase_padding(), 0.05);
+
+  // A sphere without hydroelastic properties is an unsupported pair for
+  // ComputeContactSurfaces() only once its own bounding box overlaps a
+  // compliant sphere's, even if its padded one does.
+  const GeometryId rigid_id = AddDynamic(sphere, V3{0, -0.21, 0});
+  engine_.UpdateWorldPoses(X_WGs_);
+  X_WGs_[rigid_id].set_translation(V3{0, -0.22, 0});
+  engine_.UpdateWorldPoses(X_WGs_);
+  EXPECT_NO_THROW(engine_.ComputeContactSurfaces(kTriangle, X_WGs_));
+  X_WGs_[rigid_id].set_translation(V3{0, -0.15, 0});
+  engine_.UpdateWorldPoses(X_WGs_);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine_.ComputeContactSurfaces(kTriangle, X_WGs_),
+      ".*without hydroelastic representation.*");
+}
+
+// The point-pair penetration and signed distance queries throw for a pair of
+// geometries that is unsupported for the scalar type only once the pair's own
+// bounding boxes are in range, even if its padded ones already are.
+TEST_F(ProximityEngineTests, BroadphasePaddingUnsupportedPairs) {
+  // Box-box pairs are unsupported for AutoDiffXd.
+  const Box box(0.1, 0.1, 0.1);
+  const GeometryId id_A = AddDynamic(box, V3{0, 0, 0});
+  const GeometryId id_B = AddDynamic(box, V3{0.5, 0, 0});
+  engine_.set_broadphase_padding(0.05);
+  const auto ad_engine = engine_.ToScalarType<AutoDiffXd>();
+  unordered_map<GeometryId, RigidTransform<AutoDiffXd>> X_WGs_ad;
+  auto update_poses = [&](double x_B) {
+    X_WGs_ad[id_A] = RigidTransform<AutoDiffXd>::Identity();
+    X_WGs_ad[id_B] = RigidTransformd(V3{x_B, 0, 0}).cast<AutoDiffXd>();
+    ad_engine->UpdateWorldPoses(X_WGs_ad);
+  };
+
+  // Moving B next to A refits B's padded box, which then overlaps A's padded
+  // box even though the boxes themselves are 0.03 apart.
+  update_poses(0.13);
+  EXPECT_NO_THROW(ad_engine->ComputePointPairPenetration(X_WGs_ad));
+  EXPECT_NO_THROW(
+      ad_engine->ComputeSignedDistancePairwiseClosestPoints(X_WGs_ad, 0.02));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ad_engine->ComputeSignedDistancePairwiseClosestPoints(X_WGs_ad, 0.04),
+      ".*Box.*Box.*not supported.*");
+
+  update_poses(0.09);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ad_engine->ComputePointPairPenetration(X_WGs_ad),
+      ".*Box.*Box.*not supported.*");
+}
+
 /* HasCollisions() responsibilities:
 
   1. Report false for an empty engine.
@@ -207,11 +207,15 @@ TEST_F(QueryObjectTest, DefaultQueryThrows) {
 
   // Penetration queries.
   EXPECT_DEFAULT_ERROR(default_object.ComputePointPairPenetration());
+  std::vector<PenetrationAsPointPair<double>> point_pairs;
+  EXPECT_DEFAULT_ERROR(
+      default_object.ComputePointPairPenetration(&point_pairs));
   const HydroelasticContactRepresentation representation =
       HydroelasticContactRepresentation::kTriangle;
   EXPECT_DEFAULT_ERROR(default_object.ComputeContactSurfaces(representation));
   std::vector<ContactSurface<double>> surfaces;
-  std::vector<PenetrationAsPointPair<double>> point_pairs;
+  EXPECT_DEFAULT_ERROR(
+      default_object.ComputeContactSurfaces(representation, &surfaces));
   EXPECT_DEFAULT_ERROR(default_object.ComputeContactSurfacesWithFallback(
       representation, &surfaces, &point_pairs));
   internal::DeformableContact<double> deformable_contact;
@@ -221,6 +225,10 @@ TEST_F(QueryObjectTest, DefaultQueryThrows) {
   // Signed distance queries.
   EXPECT_DEFAULT_ERROR(
       default_object.ComputeSignedDistancePairwiseClosestPoints());
+  std::vector<SignedDistancePair<double>> signed_distance_pairs;
+  EXPECT_DEFAULT_ERROR(
+      default_object.ComputeSignedDistancePairwiseClosestPoints(
+          0.0, &signed_distance_pairs));
   EXPECT_DEFAULT_ERROR(default_object.ComputeSignedDistancePairClosestPoints(
       GeometryId::get_new_id(), GeometryId::get_new_id()));
   EXPECT_DEFAULT_ERROR(
@@ -411,11 +419,15 @@ TEST_F(QueryObjectTest, LiveQueryUpdatesState) {
 
   // Collision queries.
   EXPECT_UPDATES(qo.ComputePointPairPenetration(), kFullUpdate);
+  std::vector<PenetrationAsPointPair<double>> point_pairs;
+  EXPECT_UPDATES(qo.ComputePointPairPenetration(&point_pairs), kFullUpdate);
   EXPECT_UPDATES(
       qo.ComputeContactSurfaces(HydroelasticContactRepresentation::kTriangle),
       kPoseOnly);
   std::vector<ContactSurface<double>> surfaces;
-  std::vector<PenetrationAsPointPair<double>> point_pairs;
+  EXPECT_UPDATES(qo.ComputeContactSurfaces(
+                     HydroelasticContactRepresentation::kTriangle, &surfaces),
+                 kPoseOnly);
   EXPECT_UPDATES(qo.ComputeContactSurfacesWithFallback(
                      HydroelasticContactRepresentation::kTriangle, &surfaces,
                      &point_pairs),
@@ -427,6 +439,10 @@ TEST_F(QueryObjectTest, LiveQueryUpdatesState) {
 
   // Signed distance queries.
   EXPECT_UPDATES(qo.ComputeSignedDistancePairwiseClosestPoints(), kFullUpdate);
+  std::vector<SignedDistancePair<double>> signed_distance_pairs;
+  EXPECT_UPDATES(qo.ComputeSignedDistancePairwiseClosestPoints(
+                     0.0, &signed_distance_pairs),
+                 kFullUpdate);
   EXPECT_UPDATES_WITH_THROW(
       qo.ComputeSignedDistancePairClosestPoints(g_id1, g_id2), kFullUpdate);
   EXPECT_UPDATES(qo.ComputeSignedDistanceToPoint(Vector3d::Zero()),
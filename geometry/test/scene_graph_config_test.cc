@@ -25,6 +25,8 @@ default_proximity_properties:
   hunt_crossley_dissipation: 7.0
   relaxation_time: 8.0
   point_stiffness: 9.0
+narrow_phase_num_threads: 10
+broadphase_padding: 0.25
 )""";
 
 GTEST_TEST(SceneGraphConfigTest, YamlTest) {
@@ -39,6 +41,8 @@ GTEST_TEST(SceneGraphConfigTest, YamlTest) {
   EXPECT_EQ(props.hunt_crossley_dissipation, 7);
   EXPECT_EQ(props.relaxation_time, 8);
   EXPECT_EQ(props.point_stiffness, 9);
+  EXPECT_EQ(config.narrow_phase_num_threads, 10);
+  EXPECT_EQ(config.broadphase_padding, 0.25);
   EXPECT_EQ("\n" + SaveYamlString(config), kExampleConfig);
 }
 
@@ -183,6 +187,29 @@ GTEST_TEST(SceneGraphConfigTest, ValidateCoulombFriction) {
       " 'dynamic_friction' \\(0.5\\) must have a value, or neither.");
 }
 
+GTEST_TEST(SceneGraphConfigTest, ValidateNarrowPhaseNumThreads) {
+  SceneGraphConfig config;
+  config.narrow_phase_num_threads = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      config.ValidateOrThrow(),
+      "Invalid scene graph configuration:"
+      " 'narrow_phase_num_threads' \\(0\\) must be positive.");
+}
+
+GTEST_TEST(SceneGraphConfigTest, ValidateBroadphasePadding) {
+  SceneGraphConfig config;
+  config.broadphase_padding = -0.1;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      config.ValidateOrThrow(),
+      "Invalid scene graph configuration:"
+      " 'broadphase_padding' \\(-0.1\\) must be non-negative and finite.");
+  config.broadphase_padding = std::numeric_limits<double>::infinity();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      config.ValidateOrThrow(),
+      "Invalid scene graph configuration:"
+      " 'broadphase_padding' \\(inf\\) must be non-negative and finite.");
+}
+
 }  // namespace
 }  // namespace geometry
 }  // namespace drake
@@ -220,6 +220,42 @@ class Cassie : public benchmark::Fixture {
     }
   }
 
+  // Runs the ArticulatedBodyAlgorithm benchmark. This performs the same
+  // Articulated Body Algorithm passes as ForwardDynamics, with intermediate
+  // results stored in cache entries, but with fixed applied forces so that it
+  // can be compared directly with ArticulatedBodyAlgorithmFused.
+  // NOLINTNEXTLINE(runtime/references)
+  void DoArticulatedBodyAlgorithm(benchmark::State& state) {
+    DRAKE_DEMAND(want_grad_vdot(state) == false);
+    DRAKE_DEMAND(want_grad_u(state) == false);
+    const internal::MultibodyTree<T>& mbtree = GetInternalTree(*plant_);
+    internal::ArticulatedBodyForceCache<T> aba_force_cache(mbtree.forest());
+    internal::AccelerationKinematicsCache<T> ac(mbtree.forest());
+    for (auto _ : state) {
+      InvalidateState();
+      mbtree.CalcArticulatedBodyForceCache(*context_, external_forces_,
+                                           &aba_force_cache);
+      mbtree.CalcArticulatedBodyAccelerations(*context_, aba_force_cache, &ac);
+    }
+  }
+
+  // Runs the ArticulatedBodyAlgorithmFused benchmark, which computes the same
+  // accelerations as ArticulatedBodyAlgorithm using caller-owned scratch
+  // storage instead of cache entries.
+  // NOLINTNEXTLINE(runtime/references)
+  void DoArticulatedBodyAlgorithmFused(benchmark::State& state) {
+    DRAKE_DEMAND(want_grad_vdot(state) == false);
+    DRAKE_DEMAND(want_grad_u(state) == false);
+    const internal::MultibodyTree<T>& mbtree = GetInternalTree(*plant_);
+    internal::ArticulatedBodyAlgorithmScratch<T> scratch(mbtree.forest());
+    internal::AccelerationKinematicsCache<T> ac(mbtree.forest());
+    for (auto _ : state) {
+      InvalidateState();
+      mbtree.CalcForwardDynamicsFused(*context_, external_forces_, &scratch,
+                                      &ac);
+    }
+  }
+
   // The plant itself.
   const std::unique_ptr<const MultibodyPlant<T>> plant_{MakePlant()};
   const int nq_{plant_->num_positions()};
@@ -441,6 +477,24 @@ BENCHMARK_REGISTER_F(CassieDouble, ForwardDynamics)
     ->Unit(benchmark::kMicrosecond)
     ->Arg(kWantNoGrad);
 
+BENCHMARK_DEFINE_F(CassieDouble, ArticulatedBodyAlgorithm)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  DoArticulatedBodyAlgorithm(state);
+}
+BENCHMARK_REGISTER_F(CassieDouble, ArticulatedBodyAlgorithm)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(kWantNoGrad);
+
+BENCHMARK_DEFINE_F(CassieDouble, ArticulatedBodyAlgorithmFused)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  DoArticulatedBodyAlgorithmFused(state);
+}
+BENCHMARK_REGISTER_F(CassieDouble, ArticulatedBodyAlgorithmFused)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(kWantNoGrad);
+
 BENCHMARK_DEFINE_F(CassieAutoDiff, PositionKinematics)
 // NOLINTNEXTLINE(runtime/references)
 (benchmark::State& state) {
@@ -514,6 +568,26 @@ BENCHMARK_REGISTER_F(CassieAutoDiff, ForwardDynamics)
     ->Arg(kWantGradV | kWantGradU)
     ->Arg(kWantGradX | kWantGradU);
 
+BENCHMARK_DEFINE_F(CassieAutoDiff, ArticulatedBodyAlgorithm)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  DoArticulatedBodyAlgorithm(state);
+}
+BENCHMARK_REGISTER_F(CassieAutoDiff, ArticulatedBodyAlgorithm)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(kWantNoGrad)
+    ->Arg(kWantGradX);
+
+BENCHMARK_DEFINE_F(CassieAutoDiff, ArticulatedBodyAlgorithmFused)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  DoArticulatedBodyAlgorithmFused(state);
+}
+BENCHMARK_REGISTER_F(CassieAutoDiff, ArticulatedBodyAlgorithmFused)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(kWantNoGrad)
+    ->Arg(kWantGradX);
+
 BENCHMARK_DEFINE_F(CassieExpression, PositionKinematics)
 // NOLINTNEXTLINE(runtime/references)
 (benchmark::State& state) {
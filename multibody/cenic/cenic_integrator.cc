@@ -350,6 +350,8 @@ bool CenicIntegrator<T>::DoStep(const T& h) {
     builder_->UpdateModel(plant_context, h, actuation_feedback,
                           external_feedback, &model_at_x0_);
   }
+  // Either way, any reduction of the model must be recomputed.
+  reduced_model_source_ = nullptr;
 
   // Solve for the full step x_{t+h}. We'll need this regardless of whether
   // error control is enabled or not.
@@ -392,6 +394,7 @@ bool CenicIntegrator<T>::DoStep(const T& h) {
     // we will reuse the linearizations of any external systems, if they exist.
     builder_->UpdateModel(plant_context, 0.5 * h, actuation_feedback,
                           external_feedback, &model_at_xh_);
+    reduced_model_source_ = nullptr;
     // #created_for_root_system: The `x_next*` state here is the one in
     // `scratch_`, which is always created for the root system.
     v_guess = GetSubstateByPath(*scratch_.x_next_full, structure_.plant_path)
@@ -442,12 +445,22 @@ void CenicIntegrator<T>::ComputeNextContinuousState(
   bool solved{};
   if constexpr (std::is_same_v<T, double>) {
     if (model.is_reducible()) {
-      model.ReduceInto(&reduced_model_, &mapping_);
+      // The full step and the first half-step solve the same model with
+      // different time steps. Since the reduction commutes with
+      // IcfModel::UpdateTimeStep(), we only reduce the model (and recompute its
+      // sparsity pattern) once and then update the time step of the reduced
+      // model.
+      if (reduced_model_source_ != &model) {
+        model.ReduceInto(&reduced_model_, &mapping_);
+        reduced_model_.SetSparsityPattern();
+        reduced_model_source_ = &model;
+      } else if (reduced_model_.time_step() != h) {
+        reduced_model_.UpdateTimeStep(h);
+      }
       reduced_model_.ResizeData(&data_);
       const std::vector<int>& indices =
           mapping_.velocity_subsequence.inverse_permutation();
       data_.set_v(v_guess(indices));
-      reduced_model_.SetSparsityPattern();
       solved = solver_.SolveWithGuess(reduced_model_, tolerance, &data_);
       if (solved) {
         data_.set_v(ExpandRows(data_.v(), model.num_velocities(), indices));
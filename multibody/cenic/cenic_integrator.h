@@ -245,6 +245,11 @@ class CenicIntegrator final : public systems::IntegratorBase<T> {
   /* Reduced-problem data for joint locking. */
   contact_solvers::icf::internal::IcfModel<T> reduced_model_;
   contact_solvers::icf::internal::ReducedMapping mapping_;
+  /* The model that `reduced_model_` was reduced from, if it is still valid, or
+  nullptr. Since the reduction commutes with a change of time step, it remains
+  valid while its source model only changes its time step. */
+  const contact_solvers::icf::internal::IcfModel<T>* reduced_model_source_{
+      nullptr};
   /* Data used with any/all of the above models. */
   contact_solvers::icf::internal::IcfData<T> data_;
 
@@ -13,6 +13,14 @@ namespace internal {
 
 using math::internal::PartialPermutation;
 
+namespace {
+
+bool SamePattern(const BlockSparsityPattern& a, const BlockSparsityPattern& b) {
+  return a.block_sizes() == b.block_sizes() && a.neighbors() == b.neighbors();
+}
+
+}  // namespace
+
 template <typename BlockType>
 BlockSparseCholeskySolver<BlockType>::~BlockSparseCholeskySolver() = default;
 
@@ -25,6 +33,7 @@ void BlockSparseCholeskySolver<BlockType>::SetMatrix(const SymmetricMatrix& A) {
   BlockSparsityPattern L_block_pattern =
       SymbolicFactor(A, elimination_ordering);
   SetMatrixImpl(A, elimination_ordering, std::move(L_block_pattern));
+  schur_complement_analysis_.reset();
 }
 
 template <typename BlockType>
@@ -51,8 +60,22 @@ BlockSparseCholeskySolver<BlockType>::FactorAndCalcSchurComplement(
   const int num_total_blocks = A.block_cols();
   const int num_remaining_blocks = num_total_blocks - num_eliminated_blocks;
   DRAKE_DEMAND(num_remaining_blocks >= 0);
+  /* The elimination ordering and the symbolic factorization only depend on the
+   sparsity pattern of A and on the eliminated blocks, so we skip them if
+   neither has changed since the last call. (L_ is null if `this` has been
+   moved from.) */
+  const bool reuse_analysis =
+      L_ != nullptr && schur_complement_analysis_.has_value() &&
+      schur_complement_analysis_->eliminated_blocks == eliminated_blocks &&
+      SamePattern(schur_complement_analysis_->A_pattern, A.sparsity_pattern());
   if (num_remaining_blocks == 0) {
-    SetMatrix(A);
+    if (reuse_analysis) {
+      UpdateMatrix(A);
+    } else {
+      SetMatrix(A);
+      schur_complement_analysis_ =
+          SchurComplementAnalysis{A.sparsity_pattern(), eliminated_blocks, {}};
+    }
     const bool success = Factor();
     return success ? std::optional<MatrixX<double>>(MatrixX<double>::Zero(0, 0))
                    : std::nullopt;
@@ -65,10 +88,17 @@ BlockSparseCholeskySolver<BlockType>::FactorAndCalcSchurComplement(
    associated with `eliminated_blocks` are eliminated first. There are
    many ordering that satisfy this requirement, and we look for one that reduces
    fill-in. */
-  const std::vector<int> elimination_ordering =
-      ComputeMinimumDegreeOrdering(A.sparsity_pattern(), eliminated_blocks);
-  SetMatrixImpl(A, elimination_ordering,
-                SymbolicFactor(A, elimination_ordering));
+  if (reuse_analysis) {
+    UpdateMatrix(A);
+  } else {
+    std::vector<int> ordering =
+        ComputeMinimumDegreeOrdering(A.sparsity_pattern(), eliminated_blocks);
+    SetMatrixImpl(A, ordering, SymbolicFactor(A, ordering));
+    schur_complement_analysis_ = SchurComplementAnalysis{
+        A.sparsity_pattern(), eliminated_blocks, std::move(ordering)};
+  }
+  const std::vector<int>& elimination_ordering =
+      schur_complement_analysis_->elimination_ordering;
 
   /* Reset solver mode and exit if factorization of the eliminated blocks fails.
    */
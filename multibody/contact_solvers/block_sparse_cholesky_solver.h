@@ -156,6 +156,11 @@ class BlockSparseCholeskySolver {
    If the factorization of A is successful, returns the Schur complement
    S = C - BᵀD⁻¹B.
 
+   The elimination ordering and the symbolic factorization computed in a call
+   to this function are reused by the next call if the sparsity pattern of `A`
+   and `eliminated_blocks` are both unchanged, in which case only the numeric
+   factorization is recomputed. A call to SetMatrix() discards them.
+
    @pre `eliminated_blocks` has all its entries in [0, A.block_cols()).
    @post solver_mode() is SolverMode::kFactored if factorization is successful
    and is SolverMode::kEmpty otherwise. */
@@ -264,6 +269,18 @@ class BlockSparseCholeskySolver {
    index into L_. */
   math::internal::PartialPermutation scalar_permutation_;
 
+  /* The inputs to FactorAndCalcSchurComplement() that the current symbolic
+   analysis (i.e. the permutations and the sparsity pattern of L) was computed
+   for. Empty if the analysis comes from SetMatrix() or if no analysis has been
+   performed. */
+  struct SchurComplementAnalysis {
+    BlockSparsityPattern A_pattern;
+    std::unordered_set<int> eliminated_blocks;
+    /* Empty when all blocks are eliminated. */
+    std::vector<int> elimination_ordering;
+  };
+  std::optional<SchurComplementAnalysis> schur_complement_analysis_;
+
   reset_after_move<SolverMode> solver_mode_{SolverMode::kEmpty};
 };
 
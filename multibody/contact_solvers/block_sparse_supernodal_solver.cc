@@ -34,12 +34,15 @@ bool MassMatrixPartitionEqualsJacobianPartition(
 }  // namespace
 
 BlockSparseSuperNodalSolver::BlockSparseSuperNodalSolver(
-    const std::vector<MatrixX<double>>& A, const BlockSparseMatrix<double>& J)
-    : BlockSparseSuperNodalSolver(J.block_rows(), J.get_blocks(), A) {}
+    const std::vector<MatrixX<double>>& A, const BlockSparseMatrix<double>& J,
+    SymbolicFactorizationCache* symbolic_cache)
+    : BlockSparseSuperNodalSolver(J.block_rows(), J.get_blocks(), A,
+                                  symbolic_cache) {}
 
 BlockSparseSuperNodalSolver::BlockSparseSuperNodalSolver(
     int num_jacobian_row_blocks, std::vector<BlockTriplet> jacobian_blocks,
-    std::vector<Eigen::MatrixXd> mass_matrices)
+    std::vector<Eigen::MatrixXd> mass_matrices,
+    SymbolicFactorizationCache* symbolic_cache)
     : jacobian_blocks_(std::move(jacobian_blocks)),
       mass_matrices_(std::move(mass_matrices)) {
   const std::vector<int> jacobian_column_block_size =
@@ -79,8 +82,18 @@ BlockSparseSuperNodalSolver::BlockSparseSuperNodalSolver(
       BlockSparsityPattern(std::move(block_sizes), std::move(sparsity)));
   /* The solver analyzes the sparsity pattern of the H_ (currently a zero
    matrix) so that subsequent updates to the matrix can use UpdateMatrix()
-   that doesn't perform symbolic factorization and allocation. */
-  solver_.SetMatrix(*H_);
+   that doesn't perform symbolic factorization and allocation. When the same
+   sparsity pattern was analyzed recently, we copy that analysis instead. */
+  if (symbolic_cache != nullptr) {
+    reused_symbolic_factorization_ =
+        symbolic_cache->Find(H_->sparsity_pattern(), &solver_);
+  }
+  if (!reused_symbolic_factorization_) {
+    solver_.SetMatrix(*H_);
+    if (symbolic_cache != nullptr) {
+      symbolic_cache->Insert(H_->sparsity_pattern(), solver_);
+    }
+  }
 }
 
 BlockSparseSuperNodalSolver::~BlockSparseSuperNodalSolver() = default;
@@ -8,6 +8,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
 #include "drake/multibody/contact_solvers/supernodal_solver.h"
+#include "drake/multibody/contact_solvers/symbolic_factorization_cache.h"
 
 namespace drake {
 namespace multibody {
@@ -29,12 +30,25 @@ class BlockSparseSuperNodalSolver final : public SuperNodalSolver {
      otherwise an exception is thrown.
    @param[in] J
      A BlockSparseMatrix specifying the Jacobian matrix. An exception is thrown
-     if there are more than two blocks within the same block row. */
-  BlockSparseSuperNodalSolver(const std::vector<MatrixX<double>>& A,
-                              const BlockSparseMatrix<double>& J);
+     if there are more than two blocks within the same block row.
+   @param[in] symbolic_cache
+     Optional cache of symbolic factorizations. When the sparsity pattern of
+     H = A + Jᵀ⋅G⋅J is found in the cache, the symbolic analysis is copied from
+     the cache instead of being recomputed. Otherwise the analysis is performed
+     and stored in the cache. If non-null, it must outlive the construction of
+     `this` solver (but need not outlive `this` solver). */
+  BlockSparseSuperNodalSolver(
+      const std::vector<MatrixX<double>>& A, const BlockSparseMatrix<double>& J,
+      SymbolicFactorizationCache* symbolic_cache = nullptr);
 
   ~BlockSparseSuperNodalSolver() final;
 
+  /* Returns `true` iff the symbolic analysis of H was obtained from the
+   `symbolic_cache` provided at construction. */
+  bool reused_symbolic_factorization() const {
+    return reused_symbolic_factorization_;
+  }
+
  private:
   /* Constructs a BlockSparseSuperNodalSolver.
    @param[in] num_jacobian_row_blocks
@@ -53,10 +67,13 @@ class BlockSparseSuperNodalSolver final : public SuperNodalSolver {
      columns of the mass matrix and the block columns of the Jacobian J both
      induce a partition of the set {0, 1, ..., nᵥ - 1}, where nᵥ denotes the
      number of scalar variables. These two partitions must be the same,
-     otherwise an exception is thrown. */
+     otherwise an exception is thrown.
+   @param[in] symbolic_cache
+     Optional cache of symbolic factorizations, see the public constructor. */
   BlockSparseSuperNodalSolver(int num_jacobian_row_blocks,
                               std::vector<BlockTriplet> jacobian_blocks,
-                              std::vector<Eigen::MatrixXd> mass_matrices);
+                              std::vector<Eigen::MatrixXd> mass_matrices,
+                              SymbolicFactorizationCache* symbolic_cache);
 
   /* NVI implementations. */
   bool DoSetWeightMatrix(
@@ -82,6 +99,7 @@ class BlockSparseSuperNodalSolver final : public SuperNodalSolver {
   std::vector<Eigen::MatrixXd> mass_matrices_;
 
   BlockSparseCholeskySolver<Eigen::MatrixXd> solver_;
+  bool reused_symbolic_factorization_{false};
 };
 
 }  // namespace internal
@@ -222,6 +222,9 @@ void IcfBuilder<T>::UpdateModel(
   // Set the model parameters before adding constraints.
   model->ResetParameters(std::move(params));
 
+  // Constraints are evaluated with the plant's degree of parallelism.
+  model->set_parallelism(plant_.get_parallelism());
+
   // Contact constraints
   if (plant_.geometry_source_is_registered()) {
     CalcGeometryContactData(context);
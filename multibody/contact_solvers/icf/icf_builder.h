@@ -44,7 +44,8 @@ class IcfBuilder {
          actuation forces τᵤ = clamp(-Kᵤ⋅v + b, e). May be nullptr.
   @param external_feedback linearization data (Kₑ, bₑ) for external
          forces τₑ = -Kₑ⋅v + bₑ. May be nullptr.
-  @param model The IcfModel to update.
+  @param model The IcfModel to update. Its parallelism is set to the plant's,
+         see MultibodyPlant::set_parallelism().
 
   Note that the presence/absence of actuation_feedback and external_feedback
   affects the allocation of gain constraints. In particular, passing nullptr to
@@ -1,6 +1,8 @@
 #include "drake/multibody/contact_solvers/icf/icf_data.h"
 
+#include <algorithm>
 #include <limits>
+#include <memory>
 
 namespace drake {
 namespace multibody {
@@ -29,12 +31,24 @@ void IcfData<T>::Scratch::Resize(const ResizeParams& params) {
 
   H_cc_pool.Resize(1, params.max_clique_size, params.max_clique_size);
 
-  H_BB_pool.Resize(1, params.max_clique_size, params.max_clique_size);
-  H_AA_pool.Resize(1, params.max_clique_size, params.max_clique_size);
-  H_AB_pool.Resize(1, params.max_clique_size, params.max_clique_size);
-  H_BA_pool.Resize(1, params.max_clique_size, params.max_clique_size);
-  GJa_pool.Resize(1, 6, params.max_clique_size);
-  GJb_pool.Resize(1, 6, params.max_clique_size);
+  // Like the pools, the per-thread scratch is grow-only.
+  const int num_threads = std::max(1, params.num_threads);
+  while (ssize(patch_hessian) < num_threads) {
+    patch_hessian.push_back(std::make_unique<PatchHessianScratch>());
+  }
+  for (int i = 0; i < num_threads; ++i) {
+    patch_hessian[i]->Resize(params.max_clique_size);
+  }
+}
+
+template <typename T>
+void IcfData<T>::Scratch::PatchHessianScratch::Resize(int max_clique_size) {
+  H_BB_pool.Resize(1, max_clique_size, max_clique_size);
+  H_AA_pool.Resize(1, max_clique_size, max_clique_size);
+  H_AB_pool.Resize(1, max_clique_size, max_clique_size);
+  H_BA_pool.Resize(1, max_clique_size, max_clique_size);
+  GJa_pool.Resize(1, 6, max_clique_size);
+  GJb_pool.Resize(1, 6, max_clique_size);
 }
 
 template <typename T>
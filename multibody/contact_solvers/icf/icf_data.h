@@ -1,6 +1,8 @@
 #pragma once
 
+#include <memory>
 #include <span>
+#include <vector>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
@@ -36,6 +38,8 @@ struct ResizeParams {
   std::span<const int>
       patch_sizes;  // Number of contact pairs for each patch constraint, of
                     // size equal to the number of patches.
+  int num_threads{1};  // Number of threads that evaluate constraints
+                       // concurrently, see IcfModel::parallelism().
 };
 
 /* Data for the ICF problem minᵥ ℓ(v; q₀, v₀, δt).
@@ -107,15 +111,26 @@ class IcfData {
     // one matrix of size max_clique_size() x max_clique_size().
     EigenPool<MatrixX<T>> H_cc_pool;
 
-    // Scratch space for Hessian accumulation. These pools will only hold at
-    // most one element, but using pools instead of a single MatrixX<T> allows
-    // us to avoid extra heap allocations, as their sizes change frequently.
-    EigenPool<MatrixX<T>> H_BB_pool;
-    EigenPool<MatrixX<T>> H_AA_pool;
-    EigenPool<MatrixX<T>> H_AB_pool;
-    EigenPool<MatrixX<T>> H_BA_pool;
-    EigenPool<Matrix6X<T>> GJa_pool;
-    EigenPool<Matrix6X<T>> GJb_pool;
+    // Scratch space for the Hessian accumulation of patch constraints.
+    struct PatchHessianScratch {
+      /* Resizes the scratch space, allocating memory as needed. */
+      void Resize(int max_clique_size);
+
+      // These pools will only hold at most one element, but using pools
+      // instead of a single MatrixX<T> allows us to avoid extra heap
+      // allocations, as their sizes change frequently.
+      EigenPool<MatrixX<T>> H_BB_pool;
+      EigenPool<MatrixX<T>> H_AA_pool;
+      EigenPool<MatrixX<T>> H_AB_pool;
+      EigenPool<MatrixX<T>> H_BA_pool;
+      EigenPool<Matrix6X<T>> GJa_pool;
+      EigenPool<Matrix6X<T>> GJb_pool;
+    };
+
+    // One PatchHessianScratch per thread, holds at least
+    // ResizeParams::num_threads elements. Serial evaluation uses the first
+    // one.
+    std::vector<std::unique_ptr<PatchHessianScratch>> patch_hessian;
   };
 
   /* Constructs empty data. */
@@ -108,7 +108,8 @@ void IcfModel<T>::ResizeData(IcfData<T>* data) const {
        .num_welds = weld_constraints_pool_.num_constraints(),
        .gain_sizes = gain_constraints_pool_.constraint_sizes(),
        .limit_sizes = limit_constraints_pool_.constraint_sizes(),
-       .patch_sizes = patch_constraints_pool_.patch_sizes()});
+       .patch_sizes = patch_constraints_pool_.patch_sizes(),
+       .num_threads = parallelism_.num_threads()});
 }
 
 template <typename T>
@@ -383,6 +384,10 @@ void IcfModel<T>::SetSparsityPattern() {
   // TODO(#23912): This line allocates.
   sparsity_pattern_ = std::make_unique<BlockSparsityPattern>(
       std::move(block_sizes), std::move(sparsity));
+
+  // Islands let us accumulate patch contributions concurrently.
+  partition_.Compute(*sparsity_pattern_);
+  patch_constraints_pool_.CalcIslands(partition_);
 }
 
 template <typename T>
@@ -427,6 +432,7 @@ void IcfModel<T>::ReduceInto(IcfModel<T>* reduced_model,
     mapping->velocity_subsequence.push(unlocked);
   }
 
+  reduced_model->set_parallelism(parallelism_);
   auto reduced_params = reduced_model->ReleaseParameters();
 
   // Reduce a bunch of easy params.
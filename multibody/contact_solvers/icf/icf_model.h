@@ -9,6 +9,7 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/block_sparse_lower_triangular_or_symmetric_matrix.h"
 #include "drake/multibody/contact_solvers/icf/ball_constraints_pool.h"
 #include "drake/multibody/contact_solvers/icf/coupler_constraints_pool.h"
@@ -16,6 +17,7 @@
 #include "drake/multibody/contact_solvers/icf/eigen_pool.h"
 #include "drake/multibody/contact_solvers/icf/gain_constraints_pool.h"
 #include "drake/multibody/contact_solvers/icf/icf_data.h"
+#include "drake/multibody/contact_solvers/icf/icf_partition.h"
 #include "drake/multibody/contact_solvers/icf/icf_search_direction_data.h"
 #include "drake/multibody/contact_solvers/icf/limit_constraints_pool.h"
 #include "drake/multibody/contact_solvers/icf/patch_constraints_pool.h"
@@ -379,6 +381,21 @@ class IcfModel {
     return *sparsity_pattern_;
   }
 
+  /* Returns the partition of the cliques into islands, computed along with
+  the sparsity pattern by SetSparsityPattern(). */
+  const IcfPartition& partition() const { return partition_; }
+
+  /* Sets the degree of parallelism used to evaluate the constraints. Currently
+  only patch (contact) constraints, typically the most numerous, are evaluated
+  concurrently. Their gradient and Hessian contributions are accumulated
+  concurrently across islands (see partition()) in a fixed order, so results
+  do not depend on the number of threads. Takes effect on data resized with
+  ResizeData() after this call. The default is Parallelism::None(). */
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  /* Returns the degree of parallelism set with set_parallelism(). */
+  Parallelism parallelism() const { return parallelism_; }
+
   /* Resizes `data` to fit this model.
   No allocations are required if `data`'s capacity is already enough. */
   void ResizeData(IcfData<T>* data) const;
@@ -523,6 +540,12 @@ class IcfModel {
   std::unique_ptr<contact_solvers::internal::BlockSparsityPattern>
       sparsity_pattern_;
 
+  // Islands of the sparsity pattern above. Storage is grow-only.
+  IcfPartition partition_;
+
+  // Degree of parallelism for constraint evaluation.
+  Parallelism parallelism_{Parallelism::None()};
+
   // Fixed set of constraints.
   BallConstraintsPool<T> ball_constraints_pool_;
   CouplerConstraintsPool<T> coupler_constraints_pool_;
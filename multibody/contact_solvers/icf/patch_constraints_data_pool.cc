@@ -21,6 +21,10 @@ void PatchConstraintsDataPool<T>::Resize(std::span<const int> patch_sizes) {
 
   // Data per pair.
   v_AcBc_W_.Resize(num_pairs_, 3, 1);
+  pair_cost_pool_.resize(num_pairs_);
+  gamma_Bc_W_.Resize(num_pairs_, 3, 1);
+  G_diagonal_.Resize(num_pairs_, 3, 1);
+  G_off_diagonal_.Resize(num_pairs_, 3, 1);
 }
 
 }  // namespace internal
@@ -56,6 +56,28 @@ class PatchConstraintsDataPool {
   const EigenPool<Vector3<T>>& v_AcBc_W_pool() const { return v_AcBc_W_; }
   EigenPool<Vector3<T>>& mutable_v_AcBc_W_pool() { return v_AcBc_W_; }
 
+  /* Returns the cost contribution for each pair. */
+  const std::vector<T>& pair_cost_pool() const { return pair_cost_pool_; }
+  std::vector<T>& mutable_pair_cost_pool() { return pair_cost_pool_; }
+
+  /* Returns the contact impulse on body B for each pair. */
+  const EigenPool<Vector3<T>>& gamma_Bc_W_pool() const { return gamma_Bc_W_; }
+  EigenPool<Vector3<T>>& mutable_gamma_Bc_W_pool() { return gamma_Bc_W_; }
+
+  /* Returns the diagonal entries (Gxx, Gyy, Gzz) of the contact Hessian for
+  each pair. */
+  const EigenPool<Vector3<T>>& G_diagonal_pool() const { return G_diagonal_; }
+  EigenPool<Vector3<T>>& mutable_G_diagonal_pool() { return G_diagonal_; }
+
+  /* Returns the off-diagonal entries (Gyz, Gxz, Gxy) of the (symmetric)
+  contact Hessian for each pair. */
+  const EigenPool<Vector3<T>>& G_off_diagonal_pool() const {
+    return G_off_diagonal_;
+  }
+  EigenPool<Vector3<T>>& mutable_G_off_diagonal_pool() {
+    return G_off_diagonal_;
+  }
+
   /* Returns constraint impulses (gradients) for each patch. */
   const EigenPool<Vector6<T>>& Gamma_Bo_W_pool() const { return Gamma_Bo_W_; }
   EigenPool<Vector6<T>>& mutable_Gamma_Bo_W_pool() { return Gamma_Bo_W_; }
@@ -78,8 +100,13 @@ class PatchConstraintsDataPool {
   EigenPool<Matrix6<T>> G_Bp_pool_;   // Constraint Hessian for patch p.
   EigenPool<Vector6<T>> Gamma_Bo_W_;  // Spatial impulse on body B.
 
-  // Data per patch and per pair.
-  EigenPool<Vector3<T>> v_AcBc_W_;  // Contact velocity.
+  // Data per patch and per pair. Per-pair scalars and vectors are stored in
+  // separate pools, so that they can be streamed contiguously by SIMD kernels.
+  EigenPool<Vector3<T>> v_AcBc_W_;        // Contact velocity.
+  std::vector<T> pair_cost_pool_;         // Constraint cost.
+  EigenPool<Vector3<T>> gamma_Bc_W_;      // Contact impulse on body B.
+  EigenPool<Vector3<T>> G_diagonal_;      // Contact Hessian, diagonal.
+  EigenPool<Vector3<T>> G_off_diagonal_;  // Contact Hessian, off-diagonal.
 };
 
 }  // namespace internal
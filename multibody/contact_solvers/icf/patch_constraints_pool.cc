@@ -3,11 +3,15 @@
 #include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <common_robotics_utilities/parallelism.hpp>
+
 #include "drake/math/cross_product.h"
 #include "drake/multibody/contact_solvers/icf/icf_model.h"
+#include "drake/multibody/contact_solvers/icf/patch_pair_kernels.h"
 
 namespace drake {
 namespace multibody {
@@ -15,9 +19,21 @@ namespace contact_solvers {
 namespace icf {
 namespace internal {
 
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
 using contact_solvers::internal::BlockSparseSymmetricMatrix;
 using math::VectorToSkewSymmetric;
 
+// Evaluating a patch is cheap; threads are only worth it when each of them
+// gets at least this many patches.
+constexpr int kMinPatchesPerThread = 32;
+
+// Pairs are handed to the SIMD kernels in chunks of this many pairs. This is a
+// multiple of any SIMD width so that, regardless of the number of threads,
+// every pair is evaluated with the same instructions.
+constexpr int kPairsPerChunk = 256;
+
 // Computes the soft norm ‖x‖ₛ = sqrt(xᵀx + ε²) - ε.
 template <typename T>
 T SoftNorm(const Vector3<T>& x, const T& eps) {
@@ -211,6 +227,9 @@ template <typename T>
 void PatchConstraintsPool<T>::Resize(std::span<const int> num_pairs_per_patch) {
   num_pairs_.assign(num_pairs_per_patch.begin(), num_pairs_per_patch.end());
 
+  // Patches might change; CalcIslands() must be called again.
+  patches_by_island_.Build(0, {});
+
   const int num_patches = num_pairs_.size();
   const int num_pairs =
       std::accumulate(num_pairs_.begin(), num_pairs_.end(), 0);
@@ -232,6 +251,8 @@ void PatchConstraintsPool<T>::Resize(std::span<const int> num_pairs_per_patch) {
   fe0_.resize(num_pairs);
   fn0_.resize(num_pairs);
   net_friction_.resize(num_pairs);
+  pair_dissipation_.resize(num_pairs);
+  pair_Rt_.resize(num_pairs);
 
   // Start indexes for each patch.
   pair_data_start_.resize(num_patches);
@@ -283,6 +304,8 @@ void PatchConstraintsPool<T>::SetPair(const int patch_index,
   v_b_W_[i] = v_b_W;
   fe0_[i] = fe0;
   stiffness_[i] = stiffness;
+  pair_dissipation_[i] = dissipation_[patch_index];
+  pair_Rt_[i] = Rt_[patch_index];
 
   // Pre-computed quantities.
   const int num_cliques = num_cliques_[patch_index];
@@ -356,15 +379,71 @@ void PatchConstraintsPool<T>::CalcSparsityPattern(
   }
 }
 
+template <typename T>
+void PatchConstraintsPool<T>::CalcIslands(const IcfPartition& partition) {
+  patch_to_island_.resize(num_patches());
+  for (int p = 0; p < num_patches(); ++p) {
+    // Both cliques of a patch are in the same island, and body B always has a
+    // valid clique.
+    const int c_b = model().body_to_clique(bodies_[p].first);
+    patch_to_island_[p] = partition.clique_to_island(c_b);
+  }
+  patches_by_island_.Build(partition.num_islands(), patch_to_island_);
+}
+
+template <typename T>
+int PatchConstraintsPool<T>::num_threads() const {
+  return std::clamp(num_patches() / kMinPatchesPerThread, 1,
+                    model().parallelism().num_threads());
+}
+
+template <typename T>
+template <typename PatchFunction>
+void PatchConstraintsPool<T>::ForEachPatch(
+    const PatchFunction& patch_function) const {
+  const int num_threads = this->num_threads();
+  if (num_threads > 1) {
+    StaticParallelForIndexLoop(DegreeOfParallelism(num_threads), 0,
+                               num_patches(), patch_function,
+                               ParallelForBackend::BEST_AVAILABLE);
+  } else {
+    for (int p = 0; p < num_patches(); ++p) {
+      patch_function(0, p);
+    }
+  }
+}
+
+template <typename T>
+template <typename PatchFunction>
+void PatchConstraintsPool<T>::ForEachPatchByIsland(
+    const PatchFunction& patch_function) const {
+  const int num_islands = patches_by_island_.num_islands();
+  const int num_threads = std::min(this->num_threads(), num_islands);
+  if (num_threads > 1 && patches_by_island_.num_items() == num_patches()) {
+    const auto island_function = [&](const int thread_num,
+                                     const int64_t island) {
+      for (const int p : patches_by_island_.items(island)) {
+        patch_function(thread_num, p);
+      }
+    };
+    StaticParallelForIndexLoop(DegreeOfParallelism(num_threads), 0,
+                               num_islands, island_function,
+                               ParallelForBackend::BEST_AVAILABLE);
+  } else {
+    for (int p = 0; p < num_patches(); ++p) {
+      patch_function(0, p);
+    }
+  }
+}
+
 template <typename T>
 void PatchConstraintsPool<T>::CalcData(
     const EigenPool<Vector6<T>>& V_WB,
     PatchConstraintsDataPool<T>* patch_data) const {
   DRAKE_ASSERT(patch_data != nullptr);
   CalcContactVelocities(V_WB, &patch_data->mutable_v_AcBc_W_pool());
-  CalcPatchQuantities(
-      patch_data->mutable_v_AcBc_W_pool(), &patch_data->mutable_cost_pool(),
-      &patch_data->mutable_Gamma_Bo_W_pool(), &patch_data->mutable_G_Bp_pool());
+  CalcPairQuantities(patch_data);
+  CalcPatchQuantities(patch_data);
   patch_data->mutable_cost() = std::accumulate(
       patch_data->cost_pool().begin(), patch_data->cost_pool().end(), T(0.0));
 }
@@ -376,7 +455,7 @@ void PatchConstraintsPool<T>::AccumulateGradient(const IcfData<T>& data,
   const PatchConstraintsDataPool<T>& patch_data = data.patch_constraints_data();
   const EigenPool<Vector6<T>>& Gamma_Bo_W_pool = patch_data.Gamma_Bo_W_pool();
 
-  for (int p = 0; p < num_patches(); ++p) {
+  ForEachPatchByIsland([&](const int, const int p) {
     const int body_a = bodies_[p].second;
     const int body_b = bodies_[p].first;
     const int c_b = model().body_to_clique(body_b);
@@ -410,7 +489,7 @@ void PatchConstraintsPool<T>::AccumulateGradient(const IcfData<T>& data,
         gradient_a.noalias() += J_WA.transpose() * minus_Gamma_Ao_W;
       }
     }
-  }
+  });
 }
 
 template <typename T>
@@ -420,93 +499,103 @@ void PatchConstraintsPool<T>::AccumulateHessian(
   DRAKE_ASSERT(hessian != nullptr);
 
   const PatchConstraintsDataPool<T>& patch_data = data.patch_constraints_data();
-
-  auto& H_BB_pool = data.scratch().H_BB_pool;
-  auto& H_AA_pool = data.scratch().H_AA_pool;
-  auto& H_AB_pool = data.scratch().H_AB_pool;
-  auto& H_BA_pool = data.scratch().H_BA_pool;
-  auto& GJa_pool = data.scratch().GJa_pool;
-  auto& GJb_pool = data.scratch().GJb_pool;
-
   const EigenPool<Matrix6<T>>& G_Bp_pool = patch_data.G_Bp_pool();
+  auto& scratch = data.scratch().patch_hessian;
+  // Each thread writes into its own scratch, indexed by thread number.
+  DRAKE_DEMAND(ssize(scratch) >= num_threads());
 
-  for (int p = 0; p < num_patches(); ++p) {
-    const int body_a = bodies_[p].second;
-    const int body_b = bodies_[p].first;
-    const int c_b = model().body_to_clique(body_b);
-    const int c_a = model().body_to_clique(body_a);  // negative if anchored.
-    const int nv_b = model().clique_size(c_b);
-    const int nv_a = model().clique_size(c_a);  // zero if anchored.
-
-    // First clique, body B.
-    DRAKE_ASSERT(!model().is_anchored(body_b));  // Body B is never anchored.
-
-    // Accumulate Hessian.
-    H_BB_pool.Resize(1, nv_b, nv_b);
-    auto H_BB = H_BB_pool[0];
+  ForEachPatchByIsland([&](const int thread_num, const int p) {
+    AccumulatePatchHessian(p, G_Bp_pool, scratch[thread_num].get(), hessian);
+  });
+}
 
-    const Matrix6<T>& G_Bp = G_Bp_pool[p];
-    ConstJacobianView J_WB = model().J_WB(body_b);
+template <typename T>
+void PatchConstraintsPool<T>::AccumulatePatchHessian(
+    int p, const EigenPool<Matrix6<T>>& G_Bp_pool,
+    typename IcfData<T>::Scratch::PatchHessianScratch* scratch,
+    BlockSparseSymmetricMatrix<MatrixX<T>>* hessian) const {
+  auto& H_BB_pool = scratch->H_BB_pool;
+  auto& H_AA_pool = scratch->H_AA_pool;
+  auto& H_AB_pool = scratch->H_AB_pool;
+  auto& H_BA_pool = scratch->H_BA_pool;
+  auto& GJa_pool = scratch->GJa_pool;
+  auto& GJb_pool = scratch->GJb_pool;
+
+  const int body_a = bodies_[p].second;
+  const int body_b = bodies_[p].first;
+  const int c_b = model().body_to_clique(body_b);
+  const int c_a = model().body_to_clique(body_a);  // negative if anchored.
+  const int nv_b = model().clique_size(c_b);
+  const int nv_a = model().clique_size(c_a);  // zero if anchored.
+
+  // First clique, body B.
+  DRAKE_ASSERT(!model().is_anchored(body_b));  // Body B is never anchored.
+
+  // Accumulate Hessian.
+  H_BB_pool.Resize(1, nv_b, nv_b);
+  auto H_BB = H_BB_pool[0];
+
+  const Matrix6<T>& G_Bp = G_Bp_pool[p];
+  ConstJacobianView J_WB = model().J_WB(body_b);
+  if (model().is_floating(body_b)) {
+    H_BB.noalias() = G_Bp;
+  } else {
+    GJb_pool.Resize(1, 6, nv_b);
+    auto GJb = GJb_pool[0];
+    GJb.noalias() = G_Bp * J_WB;
+    H_BB.noalias() = J_WB.transpose() * GJb;
+  }
+  hessian->AddToBlock(c_b, c_b, H_BB);
+
+  // Second clique, for body A, only contributes if not anchored.
+  if (!model().is_anchored(body_a)) {
+    GJa_pool.Resize(1, 6, nv_a);
+    auto GJa = GJa_pool[0];
+
+    const Vector3<T>& p_AB_W = p_AB_W_[p];
+    ConstJacobianView J_WA = model().J_WB(body_a);
+
+    // Accumulate (upper triangular) Hessian.
+    H_AA_pool.Resize(1, nv_a, nv_a);
+    auto H_AA = H_AA_pool[0];
+    const Matrix6<T> G_Phi = ShiftFromTheRight(G_Bp, p_AB_W);  // = Gₚ⋅Φ
+    const Matrix6<T> G_Ap = ShiftFromTheLeft(G_Phi, p_AB_W);   // = Φᵀ⋅Gₚ⋅Φ
+
+    // When c_a != c_b, we only write the lower triangular portion.
+    // If c_a == c_b, we must compute both terms.
+    GJa.noalias() = G_Phi * J_WA;
+    H_BA_pool.Resize(1, nv_b, nv_a);
+    auto H_BA = H_BA_pool[0];
     if (model().is_floating(body_b)) {
-      H_BB.noalias() = G_Bp;
+      H_BA.noalias() = -GJa;
     } else {
-      GJb_pool.Resize(1, 6, nv_b);
-      auto GJb = GJb_pool[0];
-      GJb.noalias() = G_Bp * J_WB;
-      H_BB.noalias() = J_WB.transpose() * GJb;
+      H_BA.noalias() = -J_WB.transpose() * GJa;
+    }
+    if (c_b > c_a) {
+      hessian->AddToBlock(c_b, c_a, H_BA);
+    }
+    if (c_a > c_b) {
+      // N.B. Doing:
+      // AddToBlock(c_a, c_b, H_BA.transpose()) allocates temp memory!!!.
+      H_AB_pool.Resize(1, nv_a, nv_b);
+      auto H_AB = H_AB_pool[0];
+      H_AB = H_BA.transpose();
+      hessian->AddToBlock(c_a, c_b, H_AB);
+    }
+    if (c_b == c_a) {
+      // We must add both. Additionally, AddToBlock assumes symmetric blocks
+      // for diagonal blocks.
+      H_BB.noalias() = H_BA + H_BA.transpose();  // Re-use H_BB.
+      hessian->AddToBlock(c_a, c_b, H_BB);
     }
-    hessian->AddToBlock(c_b, c_b, H_BB);
-
-    // Second clique, for body A, only contributes if not anchored.
-    if (!model().is_anchored(body_a)) {
-      GJa_pool.Resize(1, 6, nv_a);
-      auto GJa = GJa_pool[0];
-
-      const Vector3<T>& p_AB_W = p_AB_W_[p];
-      ConstJacobianView J_WA = model().J_WB(body_a);
-
-      // Accumulate (upper triangular) Hessian.
-      H_AA_pool.Resize(1, nv_a, nv_a);
-      auto H_AA = H_AA_pool[0];
-      const Matrix6<T> G_Phi = ShiftFromTheRight(G_Bp, p_AB_W);  // = Gₚ⋅Φ
-      const Matrix6<T> G_Ap = ShiftFromTheLeft(G_Phi, p_AB_W);   // = Φᵀ⋅Gₚ⋅Φ
-
-      // When c_a != c_b, we only write the lower triangular portion.
-      // If c_a == c_b, we must compute both terms.
-      GJa.noalias() = G_Phi * J_WA;
-      H_BA_pool.Resize(1, nv_b, nv_a);
-      auto H_BA = H_BA_pool[0];
-      if (model().is_floating(body_b)) {
-        H_BA.noalias() = -GJa;
-      } else {
-        H_BA.noalias() = -J_WB.transpose() * GJa;
-      }
-      if (c_b > c_a) {
-        hessian->AddToBlock(c_b, c_a, H_BA);
-      }
-      if (c_a > c_b) {
-        // N.B. Doing:
-        // AddToBlock(c_a, c_b, H_BA.transpose()) allocates temp memory!!!.
-        H_AB_pool.Resize(1, nv_a, nv_b);
-        auto H_AB = H_AB_pool[0];
-        H_AB = H_BA.transpose();
-        hessian->AddToBlock(c_a, c_b, H_AB);
-      }
-      if (c_b == c_a) {
-        // We must add both. Additionally, AddToBlock assumes symmetric blocks
-        // for diagonal blocks.
-        H_BB.noalias() = H_BA + H_BA.transpose();  // Re-use H_BB.
-        hessian->AddToBlock(c_a, c_b, H_BB);
-      }
 
-      if (model().is_floating(body_a)) {
-        H_AA.noalias() = G_Ap;
-      } else {
-        GJa.noalias() = G_Ap * J_WA;
-        H_AA.noalias() = J_WA.transpose() * GJa;
-      }
-      hessian->AddToBlock(c_a, c_a, H_AA);
+    if (model().is_floating(body_a)) {
+      H_AA.noalias() = G_Ap;
+    } else {
+      GJa.noalias() = G_Ap * J_WA;
+      H_AA.noalias() = J_WA.transpose() * GJa;
     }
+    hessian->AddToBlock(c_a, c_a, H_AA);
   }
 }
 
@@ -609,6 +698,8 @@ void PatchConstraintsPool<T>::ReduceInto(
       reduced_pool->fe0_.push_back(fe0_[from]);
       reduced_pool->fn0_.push_back(fn0_[from]);
       reduced_pool->net_friction_.push_back(net_friction_[from]);
+      reduced_pool->pair_dissipation_.push_back(dissipation_[k]);
+      reduced_pool->pair_Rt_.push_back(reduced_pool->Rt_[r_k]);
     }
   }
 }
@@ -672,7 +763,7 @@ void PatchConstraintsPool<T>::CalcConstraintVelocities(
   DRAKE_ASSERT(V_WB_pool.size() == model().num_bodies());
   DRAKE_ASSERT(V_AbB_W_pool->size() == num_patches());
 
-  for (int p = 0; p < num_patches(); ++p) {
+  ForEachPatch([&](const int, const int p) {
     const int num_cliques = num_cliques_[p];
 
     const int bodyB = bodies_[p].first;
@@ -696,14 +787,14 @@ void PatchConstraintsPool<T>::CalcConstraintVelocities(
       w_AbB_W -= w_WA;
       v_AbB_W -= (v_WA + w_WA.cross(p_AB_W));
     }
-  }
+  });
 }
 
 template <typename T>
 void PatchConstraintsPool<T>::CalcContactVelocities(
     const EigenPool<Vector6<T>>& V_WB_pool,
     EigenPool<Vector3<T>>* v_AcBc_W_pool) const {
-  for (int p = 0; p < num_patches(); ++p) {
+  ForEachPatch([&](const int, const int p) {
     const int num_cliques = num_cliques_[p];
     const int num_pairs = num_pairs_[p];
 
@@ -736,21 +827,90 @@ void PatchConstraintsPool<T>::CalcContactVelocities(
       // of cliques (an anchored body A can still carry a surface velocity).
       v_AcBc_W += v_b_W_[pk];
     }
+  });
+}
+
+template <typename T>
+void PatchConstraintsPool<T>::CalcPairQuantities(
+    PatchConstraintsDataPool<T>* patch_data) const {
+  const EigenPool<Vector3<T>>& v_AcBc_W_pool = patch_data->v_AcBc_W_pool();
+  std::vector<T>& cost_pool = patch_data->mutable_pair_cost_pool();
+  EigenPool<Vector3<T>>& gamma_Bc_W_pool =
+      patch_data->mutable_gamma_Bc_W_pool();
+  EigenPool<Vector3<T>>& G_diagonal_pool =
+      patch_data->mutable_G_diagonal_pool();
+  EigenPool<Vector3<T>>& G_off_diagonal_pool =
+      patch_data->mutable_G_off_diagonal_pool();
+
+  if constexpr (std::is_same_v<T, double>) {
+    const int num_pairs = total_num_pairs();
+    if (num_pairs == 0) {
+      return;
+    }
+    const LaggedHuntCrossleyPairsInput input{
+        .dt = model().time_step(),
+        .stiction_tolerance = stiction_tolerance_,
+        .v_AcBc_W = v_AcBc_W_pool[0].data(),
+        .normal_W = normal_W_[0].data(),
+        .mu = net_friction_.data(),
+        .dissipation = pair_dissipation_.data(),
+        .stiffness = stiffness_.data(),
+        .fe0 = fe0_.data(),
+        .fn0 = fn0_.data(),
+        .Rt = pair_Rt_.data()};
+    const LaggedHuntCrossleyPairsOutput output{
+        .cost = cost_pool.data(),
+        .gamma_Bc_W = gamma_Bc_W_pool[0].data(),
+        .G_diagonal = G_diagonal_pool[0].data(),
+        .G_off_diagonal = G_off_diagonal_pool[0].data()};
+
+    const int num_chunks = (num_pairs + kPairsPerChunk - 1) / kPairsPerChunk;
+    const auto calc_chunk = [&](const int, const int chunk) {
+      const int begin = chunk * kPairsPerChunk;
+      const int end = std::min(begin + kPairsPerChunk, num_pairs);
+      CalcLaggedHuntCrossleyPairs(begin, end, input, output);
+    };
+    if (num_threads() > 1) {
+      StaticParallelForIndexLoop(DegreeOfParallelism(num_threads()), 0,
+                                 num_chunks, calc_chunk,
+                                 ParallelForBackend::BEST_AVAILABLE);
+    } else {
+      for (int chunk = 0; chunk < num_chunks; ++chunk) {
+        calc_chunk(0, chunk);
+      }
+    }
+  } else {
+    ForEachPatch([&](const int, const int p) {
+      for (int k = 0; k < num_pairs_[p]; ++k) {
+        const int pk = patch_pair_index(p, k);
+        Vector3<T>& gamma_Bc_W = gamma_Bc_W_pool[pk];
+        Matrix3<T> Gk;
+        cost_pool[pk] = CalcLaggedHuntCrossleyModel(p, k, v_AcBc_W_pool[pk],
+                                                    &gamma_Bc_W, &Gk);
+        G_diagonal_pool[pk] = Gk.diagonal();
+        G_off_diagonal_pool[pk] = Vector3<T>(Gk(1, 2), Gk(0, 2), Gk(0, 1));
+      }
+    });
   }
 }
 
 template <typename T>
 void PatchConstraintsPool<T>::CalcPatchQuantities(
-    const EigenPool<Vector3<T>>& v_AcBc_W_pool, std::vector<T>* cost_pool,
-    EigenPool<Vector6<T>>* spatial_impulses_pool,
-    EigenPool<Matrix6<T>>* patch_hessians_pool) const {
-  EigenPool<Vector6<T>>& Gamma_Bo_W_pool = *spatial_impulses_pool;
-  EigenPool<Matrix6<T>>& G_Bp_pool = *patch_hessians_pool;
+    PatchConstraintsDataPool<T>* patch_data) const {
+  const std::vector<T>& pair_cost_pool = patch_data->pair_cost_pool();
+  const EigenPool<Vector3<T>>& gamma_Bc_W_pool = patch_data->gamma_Bc_W_pool();
+  const EigenPool<Vector3<T>>& G_diagonal_pool = patch_data->G_diagonal_pool();
+  const EigenPool<Vector3<T>>& G_off_diagonal_pool =
+      patch_data->G_off_diagonal_pool();
+  std::vector<T>& cost_pool = patch_data->mutable_cost_pool();
+  EigenPool<Vector6<T>>& Gamma_Bo_W_pool =
+      patch_data->mutable_Gamma_Bo_W_pool();
+  EigenPool<Matrix6<T>>& G_Bp_pool = patch_data->mutable_G_Bp_pool();
 
   Gamma_Bo_W_pool.SetZero();
   G_Bp_pool.SetZero();
 
-  for (int p = 0; p < num_patches(); ++p) {
+  ForEachPatch([&](const int, const int p) {
     const int num_pairs = num_pairs_[p];
 
     // Accumulate impulses on the patch for the first clique only. This is
@@ -758,25 +918,28 @@ void PatchConstraintsPool<T>::CalcPatchQuantities(
     Vector6<T>& Gamma_Bo_W = Gamma_Bo_W_pool[p];
     Matrix6<T>& G_Bp = G_Bp_pool[p];
 
-    cost_pool->at(p) = 0.0;
+    cost_pool[p] = 0.0;
+    Matrix3<T> Gk;
     for (int k = 0; k < num_pairs; ++k) {
       const int pk = patch_pair_index(p, k);
-      const Vector3<T>& v_AcBc_W = v_AcBc_W_pool[pk];
-
-      Vector3<T> gamma_Bc_W;
-      Matrix3<T> Gk;
-      cost_pool->at(p) +=
-          CalcLaggedHuntCrossleyModel(p, k, v_AcBc_W, &gamma_Bc_W, &Gk);
+      cost_pool[p] += pair_cost_pool[pk];
 
       // Shift from Ck to B and accumulate.
+      const Vector3<T>& gamma_Bc_W = gamma_Bc_W_pool[pk];
       const Vector3<T>& p_BC_W = p_BC_W_[pk];
       Gamma_Bo_W.template head<3>() += p_BC_W.cross(gamma_Bc_W);
       Gamma_Bo_W.template tail<3>() += gamma_Bc_W;
 
       // Accumulate onto the path Hessian Gp.
+      const Vector3<T>& G_diagonal = G_diagonal_pool[pk];
+      const Vector3<T>& G_off_diagonal = G_off_diagonal_pool[pk];
+      Gk.diagonal() = G_diagonal;
+      Gk(1, 2) = Gk(2, 1) = G_off_diagonal(0);
+      Gk(0, 2) = Gk(2, 0) = G_off_diagonal(1);
+      Gk(0, 1) = Gk(1, 0) = G_off_diagonal(2);
       G_Bp += ShiftSecondOrderTensor(Gk, p_BC_W);
     }
-  }
+  });
 }
 
 template <typename T>
@@ -11,6 +11,7 @@
 #include "drake/multibody/contact_solvers/icf/abstract_constraints_pool.h"
 #include "drake/multibody/contact_solvers/icf/eigen_pool.h"
 #include "drake/multibody/contact_solvers/icf/icf_data.h"
+#include "drake/multibody/contact_solvers/icf/icf_partition.h"
 #include "drake/multibody/contact_solvers/icf/patch_constraints_data_pool.h"
 #include "drake/multibody/contact_solvers/icf/reduced_mapping.h"
 
@@ -26,8 +27,7 @@ class IcfModel;
 
 // TODO(#23741): Consider sorting patches by body pair, to improve locality of
 // access of Jacobians.
-// TODO(#23742): Consider moving to a single flat index for patches and pairs,
-// as a step toward parallelization.
+// TODO(#23742): Consider moving to a single flat index for patches and pairs.
 
 /* A pool of contact constraints organized by patches. Each patch involves two
 bodies A and B, with one or more contact pairs per patch. We can think of each
@@ -57,6 +57,17 @@ simulations:
     an entire patch with a coherent access pattern, reducing cache misses and
     allowing us to load per-body-pair data only once.
 
+  - Per-patch quantities are evaluated concurrently when the parent model
+    allows it, see IcfModel::parallelism(). Gradient and Hessian contributions
+    are accumulated concurrently across islands of the parent model (see
+    IcfPartition), since patches in different islands never touch the same
+    clique. Within an island, patches are accumulated in increasing order, so
+    that results are bitwise identical to serial evaluation.
+
+  - Per-pair quantities are stored as structure-of-arrays, so that for T =
+    double the contact model is evaluated for several pairs at a time with
+    SIMD instructions, see CalcLaggedHuntCrossleyPairs().
+
 @tparam_nonsymbolic_scalar */
 template <typename T>
 class PatchConstraintsPool {
@@ -160,6 +171,14 @@ class PatchConstraintsPool {
   to clique j > i iff sparsity[i] contains j. */
   void CalcSparsityPattern(std::vector<std::vector<int>>* sparsity) const;
 
+  /* Groups patches by the island of their cliques in the given partition of
+  the parent model, so that gradient and Hessian contributions can be
+  accumulated concurrently. Resize() discards the grouping, in which case
+  contributions are accumulated serially.
+  @pre `partition` was computed for the sparsity pattern of the parent model,
+       including the cliques of every patch in this pool. */
+  void CalcIslands(const IcfPartition& partition);
+
   /* Computes constraint data for each patch, given the body spatial velocities
   V_WB. */
   void CalcData(const EigenPool<Vector6<T>>& V_WB,
@@ -209,6 +228,8 @@ class PatchConstraintsPool {
 
  private:
   /* Computes cost, gradient, and Hessian contributions for the given pair.
+  For T = double, CalcPairQuantities() evaluates the same model with
+  CalcLaggedHuntCrossleyPairs() instead.
 
   @param p Patch index.
   @param k Pair index within patch.
@@ -228,11 +249,35 @@ class PatchConstraintsPool {
   void CalcContactVelocities(const EigenPool<Vector6<T>>& V_WB_pool,
                              EigenPool<Vector3<T>>* v_AcBc_W_pool) const;
 
-  /* Computes cost, gradient, and Hessian contributions for each patch. */
-  void CalcPatchQuantities(const EigenPool<Vector3<T>>& v_AcBc_W_pool,
-                           std::vector<T>* cost_pool,
-                           EigenPool<Vector6<T>>* spatial_impulses_pool,
-                           EigenPool<Matrix6<T>>* patch_hessians_pool) const;
+  /* Computes cost, impulse, and Hessian contributions for each pair, given
+  the contact velocities in `patch_data`. */
+  void CalcPairQuantities(PatchConstraintsDataPool<T>* patch_data) const;
+
+  /* Computes cost, gradient, and Hessian contributions for each patch, given
+  the per-pair contributions in `patch_data`. */
+  void CalcPatchQuantities(PatchConstraintsDataPool<T>* patch_data) const;
+
+  /* Adds the Hessian contribution of patch p, using the given scratch. */
+  void AccumulatePatchHessian(
+      int p, const EigenPool<Matrix6<T>>& G_Bp_pool,
+      typename IcfData<T>::Scratch::PatchHessianScratch* scratch,
+      contact_solvers::internal::BlockSparseSymmetricMatrix<MatrixX<T>>*
+          hessian) const;
+
+  /* Returns the number of threads to use to evaluate per-patch quantities. */
+  int num_threads() const;
+
+  /* Calls patch_function(thread_num, p) for every patch p, possibly
+  concurrently (see num_threads()). */
+  template <typename PatchFunction>
+  void ForEachPatch(const PatchFunction& patch_function) const;
+
+  /* Calls patch_function(thread_num, p) for every patch p. Patches in
+  different islands (see CalcIslands()) may be visited concurrently, while
+  patches in the same island are visited by the same thread in increasing
+  order. */
+  template <typename PatchFunction>
+  void ForEachPatchByIsland(const PatchFunction& patch_function) const;
 
   /* Computes friction regularization Rₜ = σ⋅wₜ for a patch. */
   T CalcRt(int patch_index) const;
@@ -281,6 +326,18 @@ class PatchConstraintsPool {
   // between static and dynamic coefficients based on the relative contact
   // velocity of this pair at the previous time step.
   std::vector<T> net_friction_;
+
+  // Per-pair copies of dissipation_ and Rt_ for the patch of each pair, so that
+  // the contact model only reads contiguous per-pair data.
+  std::vector<T> pair_dissipation_;
+  std::vector<T> pair_Rt_;
+
+  // Patches grouped by island, see CalcIslands(). Only valid when it holds
+  // every patch.
+  IslandItemMap patches_by_island_;
+  // Scratch for CalcIslands(), the island of each patch. Kept here to reuse
+  // storage.
+  std::vector<int> patch_to_island_;
 };
 static_assert(IsAbstractConstraintsPool<PatchConstraintsPool>);
 
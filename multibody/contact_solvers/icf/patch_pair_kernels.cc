@@ -0,0 +1,249 @@
+#include "drake/multibody/contact_solvers/icf/patch_pair_kernels.h"
+
+#include <algorithm>
+#include <array>
+
+// This is the magic juju that compiles our impl functions for multiple CPUs.
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "multibody/contact_solvers/icf/patch_pair_kernels.cc"
+#include "hwy/foreach_target.h"
+#include "hwy/highway.h"
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/hwy_dynamic_impl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace icf {
+namespace internal {
+namespace {
+namespace HWY_NAMESPACE {
+// The hn namespace holds the CPU-specific function overloads. By defining it
+// using a substitute-able macro, we achieve per-CPU instruction selection.
+namespace hn = hwy::HWY_NAMESPACE;
+
+// Returns the diagonal entry Gᵢᵢ = a − a⋅tᵢ² − b⋅nᵢ² of the contact Hessian
+// (see CalcPairs).
+template <typename VecT>
+VecT HessianDiagonal(VecT a, VecT b, VecT t, VecT n) {
+  return hn::NegMulAdd(b, hn::Mul(n, n), hn::NegMulAdd(a, hn::Mul(t, t), a));
+}
+
+// Returns the off-diagonal entry Gᵢⱼ = −a⋅tᵢ⋅tⱼ − b⋅nᵢ⋅nⱼ of the contact
+// Hessian (see CalcPairs).
+template <typename VecT>
+VecT HessianOffDiagonal(VecT a, VecT b, VecT ti, VecT tj, VecT ni, VecT nj) {
+  return hn::Neg(hn::MulAdd(a, hn::Mul(ti, tj), hn::Mul(b, hn::Mul(ni, nj))));
+}
+
+// Evaluates the contact model for the Lanes(d) pairs starting at pair i. This
+// is the SIMD counterpart of
+// PatchConstraintsPool::CalcLaggedHuntCrossleyModel() and follows the same
+// notation; see that function for the derivation.
+template <class D>
+void CalcPairs(D d, int i, const LaggedHuntCrossleyPairsInput& input,
+               const LaggedHuntCrossleyPairsOutput& output) {
+  using VecT = hn::Vec<D>;
+  const VecT zero = hn::Zero(d);
+  const VecT one = hn::Set(d, 1.0);
+  const VecT dt = hn::Set(d, input.dt);
+
+  VecT vx, vy, vz, nx, ny, nz;
+  hn::LoadInterleaved3(d, input.v_AcBc_W + 3 * i, vx, vy, vz);
+  hn::LoadInterleaved3(d, input.normal_W + 3 * i, nx, ny, nz);
+  const VecT mu = hn::LoadU(d, input.mu + i);
+  const VecT dissipation = hn::LoadU(d, input.dissipation + i);
+  const VecT stiffness = hn::LoadU(d, input.stiffness + i);
+  const VecT fe0 = hn::LoadU(d, input.fe0 + i);
+  const VecT n0 = hn::Mul(hn::LoadU(d, input.fn0 + i), dt);
+  const VecT Rt = hn::LoadU(d, input.Rt + i);
+
+  // Regularization for the stiction tolerance.
+  const VecT mu_n0 = hn::Mul(mu, n0);
+  const VecT vs =
+      hn::Max(hn::Set(d, input.stiction_tolerance), hn::Mul(mu_n0, Rt));
+
+  // Normal velocity vₙ, positive when bodies move apart, and tangential
+  // velocity vₜ.
+  const VecT vn = hn::MulAdd(vz, nz, hn::MulAdd(vy, ny, hn::Mul(vx, nx)));
+  const VecT vtx = hn::NegMulAdd(vn, nx, vx);
+  const VecT vty = hn::NegMulAdd(vn, ny, vy);
+  const VecT vtz = hn::NegMulAdd(vn, nz, vz);
+
+  // Soft norm ‖vₜ‖ₛ and t̂ = vₜ/(‖vₜ‖ₛ + vₛ).
+  const VecT vt_squared =
+      hn::MulAdd(vtz, vtz, hn::MulAdd(vty, vty, hn::Mul(vtx, vtx)));
+  const VecT vt_soft = hn::Sub(hn::Sqrt(hn::MulAdd(vs, vs, vt_squared)), vs);
+  const VecT inv_den = hn::Div(one, hn::Add(vt_soft, vs));
+  const VecT tx = hn::Mul(vtx, inv_den);
+  const VecT ty = hn::Mul(vty, inv_den);
+  const VecT tz = hn::Mul(vtz, inv_den);
+
+  // Normal impulse γₙ(vₙ) and its derivative dγₙ/dvₙ, both zero unless the
+  // elastic and damping terms are positive.
+  const VecT dt_k = hn::Mul(dt, stiffness);
+  const VecT fe = hn::NegMulAdd(dt_k, vn, fe0);
+  const VecT damping = hn::NegMulAdd(dissipation, vn, one);
+  const auto active = hn::And(hn::Gt(fe, zero), hn::Gt(damping, zero));
+  const VecT gn = hn::IfThenElseZero(active, hn::Mul(dt, hn::Mul(fe, damping)));
+  const VecT dgn_dvn_sum = hn::MulAdd(dt_k, damping, hn::Mul(dissipation, fe));
+  const VecT dgn_dvn =
+      hn::IfThenElseZero(active, hn::Neg(hn::Mul(dt, dgn_dvn_sum)));
+
+  // Antiderivative N(vₙ) = N⁺(min(vₙ, v̂)).
+  const VecT tiny = hn::Set(d, 1.0e-20);
+  const VecT vd = hn::Div(one, hn::Add(dissipation, tiny));
+  const VecT ve = hn::Div(hn::Div(fe0, dt), hn::Add(stiffness, tiny));
+  const VecT v = hn::Min(vn, hn::Min(ve, vd));
+  const VecT df = hn::Neg(hn::Mul(dt_k, v));
+  const VecT elastic_term = hn::Mul(v, hn::MulAdd(hn::Set(d, 0.5), df, fe0));
+  const VecT dissipation_term =
+      hn::Mul(hn::Mul(dissipation, hn::Mul(hn::Mul(v, v), hn::Set(d, 0.5))),
+              hn::MulAdd(hn::Set(d, 2.0 / 3.0), df, fe0));
+  const VecT N = hn::Mul(dt, hn::Sub(elastic_term, dissipation_term));
+
+  // Constraint cost and impulse γ = −μ⋅n₀⋅t̂ + γₙ⋅n̂.
+  hn::StoreU(hn::MulSub(mu_n0, vt_soft, N), d, output.cost + i);
+  hn::StoreInterleaved3(hn::NegMulAdd(mu_n0, tx, hn::Mul(gn, nx)),
+                        hn::NegMulAdd(mu_n0, ty, hn::Mul(gn, ny)),
+                        hn::NegMulAdd(mu_n0, tz, hn::Mul(gn, nz)), d,
+                        output.gamma_Bc_W + 3 * i);
+
+  // Constraint Hessian G = a⋅(𝕀 − t̂⋅t̂ᵀ − n̂⋅n̂ᵀ) − dγₙ/dvₙ⋅n̂⋅n̂ᵀ, with
+  // a = μ⋅n₀/(‖vₜ‖ₛ + vₛ). We write it as G = a⋅𝕀 − a⋅t̂⋅t̂ᵀ − b⋅n̂⋅n̂ᵀ, with
+  // b = a + dγₙ/dvₙ.
+  const VecT a = hn::Mul(mu_n0, inv_den);
+  const VecT b = hn::Add(a, dgn_dvn);
+  hn::StoreInterleaved3(HessianDiagonal(a, b, tx, nx),
+                        HessianDiagonal(a, b, ty, ny),
+                        HessianDiagonal(a, b, tz, nz), d,
+                        output.G_diagonal + 3 * i);
+  hn::StoreInterleaved3(HessianOffDiagonal(a, b, ty, tz, ny, nz),
+                        HessianOffDiagonal(a, b, tx, tz, nx, nz),
+                        HessianOffDiagonal(a, b, tx, ty, nx, ny), d,
+                        output.G_off_diagonal + 3 * i);
+}
+
+// Evaluates the fewer than Lanes(d) pairs in [begin, end). The pairs are copied
+// into buffers padded to a full vector, so that they are evaluated with the
+// exact same instructions as any other pair. Padding lanes replicate the last
+// pair so that they always hold well-defined values.
+template <class D>
+void CalcRemainingPairs(D d, int begin, int end,
+                        const LaggedHuntCrossleyPairsInput& input,
+                        const LaggedHuntCrossleyPairsOutput& output) {
+  constexpr int kMaxLanes = HWY_MAX_BYTES / sizeof(double);
+  const int lanes = static_cast<int>(hn::Lanes(d));
+  const int count = end - begin;
+  DRAKE_ASSERT(0 < count && count < lanes && lanes <= kMaxLanes);
+
+  std::array<double, 3 * kMaxLanes> v_AcBc_W, normal_W;
+  std::array<double, kMaxLanes> mu, dissipation, stiffness, fe0, fn0, Rt;
+  for (int j = 0; j < lanes; ++j) {
+    const int pair = begin + std::min(j, count - 1);
+    for (int c = 0; c < 3; ++c) {
+      v_AcBc_W[3 * j + c] = input.v_AcBc_W[3 * pair + c];
+      normal_W[3 * j + c] = input.normal_W[3 * pair + c];
+    }
+    mu[j] = input.mu[pair];
+    dissipation[j] = input.dissipation[pair];
+    stiffness[j] = input.stiffness[pair];
+    fe0[j] = input.fe0[pair];
+    fn0[j] = input.fn0[pair];
+    Rt[j] = input.Rt[pair];
+  }
+  const LaggedHuntCrossleyPairsInput padded_input{
+      .dt = input.dt,
+      .stiction_tolerance = input.stiction_tolerance,
+      .v_AcBc_W = v_AcBc_W.data(),
+      .normal_W = normal_W.data(),
+      .mu = mu.data(),
+      .dissipation = dissipation.data(),
+      .stiffness = stiffness.data(),
+      .fe0 = fe0.data(),
+      .fn0 = fn0.data(),
+      .Rt = Rt.data()};
+
+  std::array<double, kMaxLanes> cost;
+  std::array<double, 3 * kMaxLanes> gamma_Bc_W, G_diagonal, G_off_diagonal;
+  const LaggedHuntCrossleyPairsOutput padded_output{
+      .cost = cost.data(),
+      .gamma_Bc_W = gamma_Bc_W.data(),
+      .G_diagonal = G_diagonal.data(),
+      .G_off_diagonal = G_off_diagonal.data()};
+
+  CalcPairs(d, 0, padded_input, padded_output);
+
+  std::copy_n(cost.begin(), count, output.cost + begin);
+  std::copy_n(gamma_Bc_W.begin(), 3 * count, output.gamma_Bc_W + 3 * begin);
+  std::copy_n(G_diagonal.begin(), 3 * count, output.G_diagonal + 3 * begin);
+  std::copy_n(G_off_diagonal.begin(), 3 * count,
+              output.G_off_diagonal + 3 * begin);
+}
+
+// See note in CalcLaggedHuntCrossleyPairs as to why the parameters are
+// pointers. We're simply assuming that they "can't" be null.
+void CalcLaggedHuntCrossleyPairsImpl(
+    int begin, int end, const LaggedHuntCrossleyPairsInput* input_ptr,
+    const LaggedHuntCrossleyPairsOutput* output_ptr) {
+  const LaggedHuntCrossleyPairsInput& input = *input_ptr;
+  const LaggedHuntCrossleyPairsOutput& output = *output_ptr;
+  const hn::ScalableTag<double> d;
+  const int lanes = static_cast<int>(hn::Lanes(d));
+  int i = begin;
+  for (; i + lanes <= end; i += lanes) {
+    CalcPairs(d, i, input, output);
+  }
+  if (i < end) {
+    CalcRemainingPairs(d, i, end, input, output);
+  }
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace
+}  // namespace internal
+}  // namespace icf
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+HWY_AFTER_NAMESPACE();
+
+// This part of the file is only compiled once total, instead of once per CPU.
+#if HWY_ONCE
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace icf {
+namespace internal {
+namespace {
+
+// Create the lookup tables for the per-CPU hwy implementation functions, and
+// required functors that select from the lookup tables.
+HWY_EXPORT(CalcLaggedHuntCrossleyPairsImpl);
+struct ChooseBestCalcLaggedHuntCrossleyPairsImpl {
+  auto operator()() {
+    return HWY_DYNAMIC_POINTER(CalcLaggedHuntCrossleyPairsImpl);
+  }
+};
+
+}  // namespace
+
+void CalcLaggedHuntCrossleyPairs(int begin, int end,
+                                 const LaggedHuntCrossleyPairsInput& input,
+                                 const LaggedHuntCrossleyPairsOutput& output) {
+  DRAKE_ASSERT(0 <= begin && begin <= end);
+  // Note: LateBoundFunction currently copies the parameters (with no obvious
+  // immediate solution). For that reason, the impl function takes pointers so
+  // the cost of the copy is negligible.
+  LateBoundFunction<ChooseBestCalcLaggedHuntCrossleyPairsImpl>::Call(
+      begin, end, &input, &output);
+}
+
+}  // namespace internal
+}  // namespace icf
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+#endif  // HWY_ONCE
@@ -0,0 +1,59 @@
+#pragma once
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace icf {
+namespace internal {
+
+/* Per-pair inputs of the lagged Hunt & Crossley contact model used by
+PatchConstraintsPool, in structure-of-arrays layout. Per-pair scalars hold one
+entry per contact pair. Per-pair vectors hold three contiguous entries (x, y, z)
+per contact pair, as laid out by EigenPool<Vector3d>. */
+struct LaggedHuntCrossleyPairsInput {
+  double dt{};                  // Time step δt.
+  double stiction_tolerance{};  // Stiction tolerance vₛ, in m/s.
+
+  // Per-pair vectors.
+  const double* v_AcBc_W{};  // Relative contact velocity.
+  const double* normal_W{};  // Contact normal.
+
+  // Per-pair scalars.
+  const double* mu{};           // Net friction coefficient μ.
+  const double* dissipation{};  // Hunt & Crossley dissipation d.
+  const double* stiffness{};    // Contact stiffness k.
+  const double* fe0{};          // Previous-step elastic force fₑ₀.
+  const double* fn0{};          // Previous-step normal force fₙ₀.
+  const double* Rt{};           // Friction regularization Rₜ.
+};
+
+/* Per-pair outputs of the lagged Hunt & Crossley contact model, with the same
+layout conventions as LaggedHuntCrossleyPairsInput. The contact Hessian G is
+symmetric and is stored as its diagonal (Gxx, Gyy, Gzz) and its off-diagonal
+(Gyz, Gxz, Gxy) entries. */
+struct LaggedHuntCrossleyPairsOutput {
+  // Per-pair scalars.
+  double* cost{};
+
+  // Per-pair vectors.
+  double* gamma_Bc_W{};      // Contact impulse on body B.
+  double* G_diagonal{};      // Diagonal of the contact Hessian.
+  double* G_off_diagonal{};  // Off-diagonal of the contact Hessian.
+};
+
+/* Evaluates the lagged Hunt & Crossley contact model for contact pairs in the
+range [begin, end), several pairs at a time using the widest SIMD instructions
+supported by the current CPU. See PatchConstraintsPool for the model itself.
+
+Each pair is evaluated with the same sequence of instructions regardless of
+its position within the range, so results do not depend on how a larger range
+of pairs is split into calls. */
+void CalcLaggedHuntCrossleyPairs(int begin, int end,
+                                 const LaggedHuntCrossleyPairsInput& input,
+                                 const LaggedHuntCrossleyPairsOutput& output);
+
+}  // namespace internal
+}  // namespace icf
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
@@ -24,12 +24,7 @@ GTEST_TEST(IcfData, DefaultConstructedIsEmpty) {
   EXPECT_EQ(data.scratch().Gw_gain.size(), 0);
   EXPECT_EQ(data.scratch().Gw_limit.size(), 0);
   EXPECT_EQ(data.scratch().U_AbB_W.size(), 0);
-  EXPECT_EQ(data.scratch().H_BB_pool.size(), 0);
-  EXPECT_EQ(data.scratch().H_AA_pool.size(), 0);
-  EXPECT_EQ(data.scratch().H_AB_pool.size(), 0);
-  EXPECT_EQ(data.scratch().H_BA_pool.size(), 0);
-  EXPECT_EQ(data.scratch().GJa_pool.size(), 0);
-  EXPECT_EQ(data.scratch().GJb_pool.size(), 0);
+  EXPECT_EQ(data.scratch().patch_hessian.size(), 0);
 }
 
 /* Checks that elements are the correct shape after a resize. */
@@ -88,16 +83,34 @@ GTEST_TEST(IcfData, ResizeAndAccessors) {
   EXPECT_EQ(data.scratch().weld_constraints_data.num_constraints(), num_welds);
   EXPECT_EQ(data.scratch().H_cc_pool[0].rows(), max_clique_size);
   EXPECT_EQ(data.scratch().H_cc_pool[0].cols(), max_clique_size);
-  EXPECT_EQ(data.scratch().H_BB_pool[0].rows(), max_clique_size);
-  EXPECT_EQ(data.scratch().H_BB_pool[0].cols(), max_clique_size);
-  EXPECT_EQ(data.scratch().H_AA_pool[0].rows(), max_clique_size);
-  EXPECT_EQ(data.scratch().H_AA_pool[0].cols(), max_clique_size);
-  EXPECT_EQ(data.scratch().H_AB_pool[0].rows(), max_clique_size);
-  EXPECT_EQ(data.scratch().H_AB_pool[0].cols(), max_clique_size);
-  EXPECT_EQ(data.scratch().H_BA_pool[0].rows(), max_clique_size);
-  EXPECT_EQ(data.scratch().H_BA_pool[0].cols(), max_clique_size);
-  EXPECT_EQ(data.scratch().GJa_pool[0].cols(), max_clique_size);
-  EXPECT_EQ(data.scratch().GJb_pool[0].cols(), max_clique_size);
+  ASSERT_EQ(data.scratch().patch_hessian.size(), 1);
+  const auto& patch_hessian = *data.scratch().patch_hessian[0];
+  EXPECT_EQ(patch_hessian.H_BB_pool[0].rows(), max_clique_size);
+  EXPECT_EQ(patch_hessian.H_BB_pool[0].cols(), max_clique_size);
+  EXPECT_EQ(patch_hessian.H_AA_pool[0].rows(), max_clique_size);
+  EXPECT_EQ(patch_hessian.H_AA_pool[0].cols(), max_clique_size);
+  EXPECT_EQ(patch_hessian.H_AB_pool[0].rows(), max_clique_size);
+  EXPECT_EQ(patch_hessian.H_AB_pool[0].cols(), max_clique_size);
+  EXPECT_EQ(patch_hessian.H_BA_pool[0].rows(), max_clique_size);
+  EXPECT_EQ(patch_hessian.H_BA_pool[0].cols(), max_clique_size);
+  EXPECT_EQ(patch_hessian.GJa_pool[0].cols(), max_clique_size);
+  EXPECT_EQ(patch_hessian.GJb_pool[0].cols(), max_clique_size);
+
+  // There is one patch Hessian scratch per thread.
+  data.Resize({.num_bodies = num_bodies,
+               .num_velocities = num_velocities,
+               .max_clique_size = max_clique_size,
+               .num_ball_constraints = num_ball_constraints,
+               .num_couplers = num_couplers,
+               .num_distance_constraints = num_distance_constraints,
+               .num_welds = num_welds,
+               .gain_sizes = gain_sizes,
+               .limit_sizes = limit_sizes,
+               .patch_sizes = patch_sizes,
+               .num_threads = 3});
+  ASSERT_EQ(data.scratch().patch_hessian.size(), 3);
+  EXPECT_EQ(data.scratch().patch_hessian[2]->H_BA_pool[0].rows(),
+            max_clique_size);
 }
 
 /* Checks that calling Resize doesn't cost heap allocations when the new size is
@@ -624,6 +624,63 @@ GTEST_TEST(IcfModel, UpdateTimeStep) {
                               MatrixCompareType::relative));
 }
 
+/* Checks that reducing a model and then updating the time step of the reduced
+model is the same as updating the time step first and then reducing. CENIC
+relies on this to reduce a model only once for solves that differ only in the
+time step. */
+GTEST_TEST(IcfModel, ReduceIntoCommutesWithUpdateTimeStep) {
+  const double new_time_step = 0.003;
+  auto make_model = [](IcfModel<double>* model) {
+    MakeUnconstrainedModel(model, false, 0.02);
+    AddCouplerConstraint(model);
+    AddGainConstraints(model);
+    AddLimitConstraints(model);
+    AddPatchConstraints(model);
+    AddWeldConstraints(model);
+    MakeModelReducible(model, {0, 17});
+    model->SetSparsityPattern();
+  };
+
+  // Reduce, then update the time step of the reduced model.
+  IcfModel<double> model_a, reduced_a;
+  ReducedMapping mapping_a;
+  make_model(&model_a);
+  ASSERT_TRUE(model_a.is_reducible());
+  model_a.ReduceInto(&reduced_a, &mapping_a);
+  reduced_a.SetSparsityPattern();
+  reduced_a.UpdateTimeStep(new_time_step);
+
+  // Update the time step of the full model, then reduce.
+  IcfModel<double> model_b, reduced_b;
+  ReducedMapping mapping_b;
+  make_model(&model_b);
+  model_b.UpdateTimeStep(new_time_step);
+  model_b.ReduceInto(&reduced_b, &mapping_b);
+  reduced_b.SetSparsityPattern();
+
+  EXPECT_EQ(reduced_a.time_step(), new_time_step);
+  EXPECT_EQ(reduced_b.time_step(), new_time_step);
+  EXPECT_EQ(mapping_a.velocity_subsequence.inverse_permutation(),
+            mapping_b.velocity_subsequence.inverse_permutation());
+  EXPECT_TRUE(CompareMatrices(reduced_a.r(), reduced_b.r(), 8 * kEpsilon,
+                              MatrixCompareType::relative));
+
+  IcfData<double> data_a, data_b;
+  reduced_a.ResizeData(&data_a);
+  reduced_b.ResizeData(&data_b);
+  const VectorXd v =
+      VectorXd::LinSpaced(reduced_a.num_velocities(), -10.0, 10.0);
+  reduced_a.CalcData(v, &data_a);
+  reduced_b.CalcData(v, &data_b);
+  EXPECT_NEAR(data_a.cost(), data_b.cost(),
+              8 * kEpsilon * std::abs(data_b.cost()));
+  EXPECT_TRUE(CompareMatrices(data_a.gradient(), data_b.gradient(),
+                              8 * kEpsilon, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(reduced_a.MakeHessian(data_a)->MakeDenseMatrix(),
+                              reduced_b.MakeHessian(data_b)->MakeDenseMatrix(),
+                              8 * kEpsilon, MatrixCompareType::relative));
+}
+
 /* Verifies that params() and ReleaseParams() use the same address. */
 GTEST_TEST(IcfModel, ParamsAccessors) {
   IcfModel<double> model;
@@ -10,8 +10,10 @@
 #include "drake/common/test_utilities/limit_malloc.h"
 #include "drake/multibody/contact_solvers/icf/icf_data.h"
 #include "drake/multibody/contact_solvers/icf/icf_model.h"
+#include "drake/multibody/contact_solvers/icf/icf_search_direction_data.h"
 #include "drake/multibody/contact_solvers/icf/test_utilities/icf_model_test_helpers.h"
 
+using Eigen::MatrixXd;
 using Eigen::Vector3d;
 using Eigen::VectorXd;
 
@@ -54,6 +56,10 @@ GTEST_TEST(PatchConstraintsPool, LimitMallocOnCalcData) {
   const int nv = model.num_velocities();
   const VectorXd v = VectorXd::LinSpaced(nv, -10.0, 10.0);
 
+  // The very first evaluation of the contact model selects the SIMD
+  // implementation for the current CPU, which may allocate once per process.
+  model.CalcData(v, &data);
+
   // Computing data should not cause any new allocations.
   {
     drake::test::LimitMalloc guard;
@@ -333,6 +339,75 @@ GTEST_TEST(PatchConstraintsPool, ReduceWithSurfaceVelocity) {
   check_reduced({6, 7, 8, 9, 10, 11});
 }
 
+/* Evaluating patches concurrently must give exactly the same results as the
+serial evaluation, regardless of the number of threads. We use enough patches
+for the pool to use several threads, spread over the two islands of the model:
+bodies 1 and 2 (in contact with each other) and body 3 (in contact with the
+world). */
+GTEST_TEST(PatchConstraintsPool, ParallelMatchesSerial) {
+  const int kNumPatches = 400;
+  const auto make_model = [&](IcfModel<double>* model) {
+    MakeUnconstrainedModel(model);
+    PatchConstraintsPool<double>& patches = model->patch_constraints_pool();
+    patches.Resize(std::vector<int>(kNumPatches, 2));
+    for (int p = 0; p < kNumPatches; ++p) {
+      const double s = 0.01 * p;
+      const Vector3d normal_W = Vector3d(1.0, s, -s).normalized();
+      const Vector3d p_AB_W = -0.1 * normal_W;
+      if (p % 3 == 0) {
+        patches.SetPatch(p, 0 /* World */, 3, 50.0, 0.5, 0.4, p_AB_W);
+      } else {
+        patches.SetPatch(p, p % 3, 3 - p % 3, 50.0, 0.5, 0.4, p_AB_W);
+      }
+      for (int k = 0; k < 2; ++k) {
+        patches.SetPair(p, k, Vector3d(0.05 * k, -s, 0.02), normal_W,
+                        1.0 + s * k, 1.0e5);
+      }
+    }
+    model->SetSparsityPattern();
+  };
+
+  IcfModel<double> serial_model;
+  make_model(&serial_model);
+  EXPECT_EQ(serial_model.partition().num_islands(), 2);
+  const int nv = serial_model.num_velocities();
+  const VectorXd v = VectorXd::LinSpaced(nv, -1.0, 1.0);
+  const VectorXd w = VectorXd::LinSpaced(nv, 0.5, -0.3);
+
+  IcfData<double> serial_data;
+  serial_model.ResizeData(&serial_data);
+  serial_model.CalcData(v, &serial_data);
+  const MatrixXd serial_hessian =
+      serial_model.MakeHessian(serial_data)->MakeDenseMatrix();
+  IcfSearchDirectionData<double> serial_search;
+  serial_model.CalcSearchDirectionData(serial_data, w, &serial_search);
+  double serial_dcost, serial_d2cost;
+  const double serial_cost = serial_model.CalcCostAlongLine(
+      0.3, serial_data, serial_search, &serial_dcost, &serial_d2cost);
+
+  for (int num_threads : {2, 4}) {
+    SCOPED_TRACE(fmt::format("num_threads = {}", num_threads));
+    IcfModel<double> model;
+    make_model(&model);
+    model.set_parallelism(Parallelism(num_threads));
+    IcfData<double> data;
+    model.ResizeData(&data);
+    model.CalcData(v, &data);
+    EXPECT_EQ(data.cost(), serial_data.cost());
+    EXPECT_TRUE(CompareMatrices(data.gradient(), serial_data.gradient(), 0.0));
+    EXPECT_TRUE(CompareMatrices(model.MakeHessian(data)->MakeDenseMatrix(),
+                                serial_hessian, 0.0));
+
+    IcfSearchDirectionData<double> search;
+    model.CalcSearchDirectionData(data, w, &search);
+    double dcost, d2cost;
+    EXPECT_EQ(model.CalcCostAlongLine(0.3, data, search, &dcost, &d2cost),
+              serial_cost);
+    EXPECT_EQ(dcost, serial_dcost);
+    EXPECT_EQ(d2cost, serial_d2cost);
+  }
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace icf
@@ -0,0 +1,187 @@
+#include "drake/multibody/contact_solvers/icf/patch_pair_kernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "hwy/tests/hwy_gtest.h"
+#include <gtest/gtest.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/hwy_dynamic.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace icf {
+namespace internal {
+namespace {
+
+using Eigen::Matrix3d;
+using Eigen::Vector3d;
+
+constexpr double kDt = 0.01;
+constexpr double kStictionTolerance = 1.0e-4;
+
+// An odd number of pairs exercises the remainder for any SIMD width.
+constexpr int kNumPairs = 37;
+
+// A reference scalar implementation of the lagged Hunt & Crossley model, as
+// documented in PatchConstraintsPool. Returns the cost and writes the impulse
+// and Hessian.
+double CalcReferencePair(const Vector3d& v, const Vector3d& n, double mu,
+                         double d, double k, double fe0, double fn0, double Rt,
+                         Vector3d* gamma, Matrix3d* G) {
+  const double n0 = fn0 * kDt;
+  const double vs = std::max(kStictionTolerance, mu * Rt * n0);
+  const double vn = v.dot(n);
+  const Vector3d vt = v - vn * n;
+  const double vt_soft = std::sqrt(vt.squaredNorm() + vs * vs) - vs;
+  const Vector3d t_hat = vt / (vt_soft + vs);
+
+  double gn = 0.0;
+  double dgn_dvn = 0.0;
+  const double fe = fe0 - kDt * k * vn;
+  const double damping = 1.0 - d * vn;
+  if (fe > 0.0 && damping > 0.0) {
+    gn = kDt * fe * damping;
+    dgn_dvn = -kDt * (k * kDt * damping + d * fe);
+  }
+
+  const double vd = 1.0 / (d + 1.0e-20);
+  const double vx = fe0 / kDt / (k + 1.0e-20);
+  const double vc = std::min(vn, std::min(vx, vd));
+  const double df = -kDt * k * vc;
+  const double N = kDt * (vc * (fe0 + 0.5 * df) -
+                          d * vc * vc / 2.0 * (fe0 + 2.0 / 3.0 * df));
+
+  *gamma = -mu * t_hat * n0 + gn * n;
+  const Matrix3d Pn = n * n.transpose();
+  const Matrix3d M = Matrix3d::Identity() - t_hat * t_hat.transpose() - Pn;
+  *G = mu * n0 / (vt_soft + vs) * M - dgn_dvn * Pn;
+  return mu * vt_soft * n0 - N;
+}
+
+/* This hwy-infused test fixture replicates every test case to be run against
+every target architecture variant (e.g., SSE4, AVX2, AVX512VL, etc). When run,
+it filters the suite to only run tests that the current CPU can handle. */
+class PatchPairKernelsTest : public hwy::TestWithParamTarget {
+ protected:
+  void SetUp() override {
+    // Reset Drake's dispatcher, to be sure that we run all of the target
+    // architectures.
+    drake::internal::HwyDynamicReset();
+    hwy::TestWithParamTarget::SetUp();
+
+    // The pairs sweep through approaching and separating velocities, sticking
+    // and sliding, and zero dissipation and stiffness.
+    for (int i = 0; i < kNumPairs; ++i) {
+      const double s = static_cast<double>(i) / (kNumPairs - 1);
+      const Vector3d n =
+          Vector3d(std::sin(3.0 * s), std::cos(5.0 * s), 0.5 + s).normalized();
+      const Vector3d v(std::cos(7.0 * s), 2.0 * s - 1.0, std::sin(11.0 * s));
+      const double scale = (i % 4 == 0) ? 1.0e-5 : 1.0;
+      for (int c = 0; c < 3; ++c) {
+        v_AcBc_W_.push_back(scale * v(c));
+        normal_W_.push_back(n(c));
+      }
+      mu_.push_back(0.2 + s);
+      dissipation_.push_back(i % 5 == 0 ? 0.0 : 10.0 * s);
+      stiffness_.push_back(i % 7 == 0 ? 0.0 : 1.0e4 * (1.0 + s));
+      fe0_.push_back(i % 6 == 0 ? -1.0 : 50.0 * s);
+      fn0_.push_back(40.0 * s);
+      Rt_.push_back(0.01 + s);
+    }
+  }
+
+  LaggedHuntCrossleyPairsInput MakeInput() const {
+    return LaggedHuntCrossleyPairsInput{
+        .dt = kDt,
+        .stiction_tolerance = kStictionTolerance,
+        .v_AcBc_W = v_AcBc_W_.data(),
+        .normal_W = normal_W_.data(),
+        .mu = mu_.data(),
+        .dissipation = dissipation_.data(),
+        .stiffness = stiffness_.data(),
+        .fe0 = fe0_.data(),
+        .fn0 = fn0_.data(),
+        .Rt = Rt_.data()};
+  }
+
+  std::vector<double> v_AcBc_W_, normal_W_;
+  std::vector<double> mu_, dissipation_, stiffness_, fe0_, fn0_, Rt_;
+};
+
+// Instantiate the suite for all CPU targets (using the HWY macro).
+HWY_TARGET_INSTANTIATE_TEST_SUITE_P(PatchPairKernelsTest);
+
+// Storage for the kernel outputs.
+struct Outputs {
+  Outputs()
+      : cost(kNumPairs),
+        gamma(3 * kNumPairs),
+        G_diagonal(3 * kNumPairs),
+        G_off_diagonal(3 * kNumPairs) {}
+
+  LaggedHuntCrossleyPairsOutput view() {
+    return LaggedHuntCrossleyPairsOutput{
+        .cost = cost.data(),
+        .gamma_Bc_W = gamma.data(),
+        .G_diagonal = G_diagonal.data(),
+        .G_off_diagonal = G_off_diagonal.data()};
+  }
+
+  std::vector<double> cost, gamma, G_diagonal, G_off_diagonal;
+};
+
+TEST_P(PatchPairKernelsTest, MatchesReference) {
+  Outputs outputs;
+  CalcLaggedHuntCrossleyPairs(0, kNumPairs, MakeInput(), outputs.view());
+
+  constexpr double kTolerance = 1.0e-12;
+  for (int i = 0; i < kNumPairs; ++i) {
+    SCOPED_TRACE(i);
+    Vector3d gamma;
+    Matrix3d G;
+    const double cost = CalcReferencePair(
+        Vector3d::Map(&v_AcBc_W_[3 * i]), Vector3d::Map(&normal_W_[3 * i]),
+        mu_[i], dissipation_[i], stiffness_[i], fe0_[i], fn0_[i], Rt_[i],
+        &gamma, &G);
+    EXPECT_NEAR(outputs.cost[i], cost,
+                kTolerance * std::max(1.0, std::abs(cost)));
+    const double scale = std::max(1.0, G.norm());
+    EXPECT_TRUE(CompareMatrices(Vector3d::Map(&outputs.gamma[3 * i]), gamma,
+                                kTolerance * std::max(1.0, gamma.norm())));
+    EXPECT_TRUE(CompareMatrices(Vector3d::Map(&outputs.G_diagonal[3 * i]),
+                                G.diagonal(), kTolerance * scale));
+    EXPECT_TRUE(CompareMatrices(Vector3d::Map(&outputs.G_off_diagonal[3 * i]),
+                                Vector3d(G(1, 2), G(0, 2), G(0, 1)),
+                                kTolerance * scale));
+  }
+}
+
+// Results must not depend on how pairs are split into ranges.
+TEST_P(PatchPairKernelsTest, IndependentOfRanges) {
+  Outputs whole;
+  CalcLaggedHuntCrossleyPairs(0, kNumPairs, MakeInput(), whole.view());
+
+  Outputs split;
+  const std::vector<int> bounds{0, 1, 6, 6, 19, 36, kNumPairs};
+  for (int r = 0; r + 1 < ssize(bounds); ++r) {
+    CalcLaggedHuntCrossleyPairs(bounds[r], bounds[r + 1], MakeInput(),
+                                split.view());
+  }
+
+  EXPECT_EQ(split.cost, whole.cost);
+  EXPECT_EQ(split.gamma, whole.gamma);
+  EXPECT_EQ(split.G_diagonal, whole.G_diagonal);
+  EXPECT_EQ(split.G_off_diagonal, whole.G_off_diagonal);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace icf
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
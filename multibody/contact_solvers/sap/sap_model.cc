@@ -20,13 +20,19 @@ using systems::Context;
 
 HessianFactorizationCache::HessianFactorizationCache(
     SapHessianFactorizationType type, const std::vector<MatrixX<double>>* A,
-    const BlockSparseMatrix<double>* J) {
+    const BlockSparseMatrix<double>* J,
+    SymbolicFactorizationCache* symbolic_cache) {
   DRAKE_DEMAND(A != nullptr);
   DRAKE_DEMAND(J != nullptr);
   switch (type) {
-    case SapHessianFactorizationType::kBlockSparseCholesky:
-      factorization_ = std::make_unique<BlockSparseSuperNodalSolver>(*A, *J);
+    case SapHessianFactorizationType::kBlockSparseCholesky: {
+      auto factorization =
+          std::make_unique<BlockSparseSuperNodalSolver>(*A, *J, symbolic_cache);
+      reused_symbolic_factorization_ =
+          factorization->reused_symbolic_factorization();
+      factorization_ = std::move(factorization);
       break;
+    }
     case SapHessianFactorizationType::kDense:
       factorization_ = std::make_unique<DenseSuperNodalSolver>(A, J);
       break;
@@ -65,8 +71,11 @@ void HessianFactorizationCache::SolveInPlace(
 
 template <typename T>
 SapModel<T>::SapModel(const SapContactProblem<T>* problem_ptr,
-                      SapHessianFactorizationType hessian_type)
-    : problem_(problem_ptr), hessian_type_(hessian_type) {
+                      SapHessianFactorizationType hessian_type,
+                      SymbolicFactorizationCache* symbolic_cache)
+    : problem_(problem_ptr),
+      hessian_type_(hessian_type),
+      symbolic_cache_(symbolic_cache) {
   // Graph to the original contact problem, including all cliques
   // (participating and non-participating).
   const ContactProblemGraph& graph = problem().graph();
@@ -331,7 +340,8 @@ void SapModel<double>::CalcHessianFactorizationCache(
   // sparse Hessians even when the factorization is not yet computed.
   if (hessian->is_empty()) {
     *hessian = HessianFactorizationCache(hessian_type_, &dynamics_matrix(),
-                                         &constraints_bundle().J());
+                                         &constraints_bundle().J(),
+                                         symbolic_cache_);
   }
   const std::vector<MatrixX<double>>& G = EvalConstraintsHessian(context);
   hessian->UpdateWeightMatrixAndFactor(G);
@@ -8,6 +8,7 @@
 #include "drake/multibody/contact_solvers/sap/sap_constraint_bundle.h"
 #include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
 #include "drake/multibody/contact_solvers/supernodal_solver.h"
+#include "drake/multibody/contact_solvers/symbolic_factorization_cache.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/leaf_system.h"
 
@@ -136,12 +137,16 @@ class HessianFactorizationCache {
   // @note is_empty() will be `false` after construction with this constructor.
   //
   // @warning This is a potentially expensive constructor, performing the
-  // necessary symbolic analysis for the case of sparse factorizations.
+  // necessary symbolic analysis for the case of sparse factorizations. For
+  // SapHessianFactorizationType::kBlockSparseCholesky, an optional
+  // `symbolic_cache` can be provided to reuse the analysis of a Hessian with
+  // the same sparsity pattern. It is ignored for other types.
   //
   // @pre A and J are not nullptr.
-  HessianFactorizationCache(SapHessianFactorizationType type,
-                            const std::vector<MatrixX<double>>* A,
-                            const BlockSparseMatrix<double>* J);
+  HessianFactorizationCache(
+      SapHessianFactorizationType type, const std::vector<MatrixX<double>>* A,
+      const BlockSparseMatrix<double>* J,
+      SymbolicFactorizationCache* symbolic_cache = nullptr);
 
   // @returns `true` if `this` factorization was never provided with a type and
   // matrices A and J.
@@ -153,6 +158,12 @@ class HessianFactorizationCache {
   // Mutable pointer to the underlying factorization. nullptr iff is_empty().
   SuperNodalSolver* mutable_factorization() { return factorization_.get(); }
 
+  // Returns `true` iff the symbolic analysis of the Hessian was obtained from
+  // the `symbolic_cache` provided at construction.
+  bool reused_symbolic_factorization() const {
+    return reused_symbolic_factorization_;
+  }
+
   // Updates the weight matrix G in H = A + Jᵀ⋅G⋅J and the factorization of H.
   // @pre is_empty() is false.
   void UpdateWeightMatrixAndFactor(const std::vector<MatrixX<double>>& G);
@@ -176,6 +187,7 @@ class HessianFactorizationCache {
 
  private:
   std::unique_ptr<SuperNodalSolver> factorization_;
+  bool reused_symbolic_factorization_{false};
 };
 
 /* This class represents the underlying computational model built by the SAP
@@ -212,10 +224,14 @@ class SapModel {
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SapModel);
 
   /* Constructs a model of `problem` optimized to be used by the SAP solver.
-   The input `problem` must outlive `this` model. */
+   The input `problem` must outlive `this` model. If non-null,
+   `symbolic_cache` is used to reuse the symbolic analysis of sparse Hessians
+   across models with the same sparsity pattern, see
+   SymbolicFactorizationCache. It must outlive `this` model. */
   explicit SapModel(const SapContactProblem<T>* problem,
                     SapHessianFactorizationType hessian_type =
-                        SapHessianFactorizationType::kBlockSparseCholesky);
+                        SapHessianFactorizationType::kBlockSparseCholesky,
+                    SymbolicFactorizationCache* symbolic_cache = nullptr);
 
   /* Returns a reference to the contact problem being modeled by this class. */
   const SapContactProblem<T>& problem() const {
@@ -226,6 +242,10 @@ class SapModel {
   /* Returns the type of factorization used for the Hessian. */
   SapHessianFactorizationType hessian_type() const { return hessian_type_; }
 
+  /* Returns the cache of symbolic factorizations provided at construction, or
+   nullptr if none was provided. */
+  SymbolicFactorizationCache* symbolic_cache() const { return symbolic_cache_; }
+
   /* Returns the number of (participating) cliques. */
   int num_cliques() const;
 
@@ -584,6 +604,7 @@ class SapModel {
   const SapContactProblem<T>* problem_{nullptr};
   SapHessianFactorizationType hessian_type_{
       SapHessianFactorizationType::kBlockSparseCholesky};
+  SymbolicFactorizationCache* symbolic_cache_{nullptr};
 
   /* TODO(amcastro-tri): Data below is heap allocated once per time step.
    Consider how to pre-allocate once to minimize heap allocation.
@@ -39,6 +39,12 @@ void SapSolver<T>::set_parameters(const SapSolverParameters& parameters) {
   parameters_ = parameters;
 }
 
+template <typename T>
+void SapSolver<T>::set_symbolic_factorization_cache(
+    SymbolicFactorizationCache* cache) {
+  symbolic_cache_ = cache;
+}
+
 template <typename T>
 const SapStatistics& SapSolver<T>::get_statistics() const {
   return stats_;
@@ -120,7 +126,7 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
     return SapSolverStatus::kSuccess;
   }
   auto model = std::make_unique<SapModel<double>>(
-      &problem, parameters_.linear_solver_type);
+      &problem, parameters_.linear_solver_type, symbolic_cache_);
   auto context = model->MakeContext();
   // Initialize context with v_guess.
   SetProblemVelocitiesIntoModelContext(*model, v_guess, context.get());
@@ -165,13 +171,14 @@ SapSolverStatus SapSolver<AutoDiffXd>::SolveWithGuess(
   // Create a <double> version of the problem and its model.
   std::unique_ptr<SapContactProblem<double>> problem = problem_ad.ToDouble();
   auto model = std::make_unique<SapModel<double>>(
-      problem.get(), parameters_.linear_solver_type);
+      problem.get(), parameters_.linear_solver_type, symbolic_cache_);
   auto context = model->MakeContext();
   const VectorX<double> v_guess = math::DiscardGradient(v_guess_ad);
 
   // Solve problem with T = double.
   SapSolver<double> sap;
   sap.set_parameters(parameters_);
+  sap.set_symbolic_factorization_cache(symbolic_cache_);
   sap.SetProblemVelocitiesIntoModelContext(*model, v_guess, context.get());
   const SapSolverStatus status = sap.SolveWithGuessImpl(*model, context.get());
   stats_ = sap.get_statistics();  // Report the <double> solver stats.
@@ -305,6 +312,19 @@ SapSolverStatus SapSolver<T>::SolveWithGuessImpl(const SapModel<T>& model,
     CalcSearchDirectionData(model, *context, &search_direction_data);
     const VectorX<double>& dv = search_direction_data.dv;
 
+    // The model creates its Hessian factorization only once, on the first
+    // iteration. Record whether that reused a cached symbolic analysis.
+    if (k == 0 && model.symbolic_cache() != nullptr &&
+        model.hessian_type() ==
+            SapHessianFactorizationType::kBlockSparseCholesky) {
+      if (model.EvalHessianFactorizationCache(*context)
+              .reused_symbolic_factorization()) {
+        ++stats_.num_symbolic_factorization_cache_hits;
+      } else {
+        ++stats_.num_symbolic_factorization_cache_misses;
+      }
+    }
+
     // Perform line search.
     switch (parameters_.line_search_type) {
       case SapSolverParameters::LineSearchType::kBackTracking:
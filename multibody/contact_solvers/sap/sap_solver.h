@@ -179,6 +179,8 @@ struct SapStatistics {
     momentum_scale.clear();
     cost.clear();
     alpha.clear();
+    num_symbolic_factorization_cache_hits = 0;
+    num_symbolic_factorization_cache_misses = 0;
   }
   int num_iters{0};              // Number of Newton iterations.
   int num_line_search_iters{0};  // Total number of line search iterations.
@@ -204,6 +206,13 @@ struct SapStatistics {
   // Dimensionless momentum scale at each SAP Newton iteration. Of size
   // num_iters + 1.
   std::vector<double> momentum_scale;
+
+  // Number of sparse Hessian factorizations that reused a symbolic analysis
+  // from the cache set with SapSolver::set_symbolic_factorization_cache()
+  // (hits), or that performed the analysis and added it to the cache (misses).
+  // Both are zero if no cache is set or if no factorization was needed.
+  int num_symbolic_factorization_cache_hits{0};
+  int num_symbolic_factorization_cache_misses{0};
 };
 
 // This class implements the Semi-Analytic Primal (SAP) solver described in
@@ -258,6 +267,14 @@ class SapSolver {
   // New parameters will affect the next call to SolveWithGuess().
   void set_parameters(const SapSolverParameters& parameters);
 
+  // Sets a cache used to reuse the symbolic analysis of the sparse Hessian
+  // whenever its sparsity pattern repeats, across calls to SolveWithGuess() and
+  // across solvers sharing the same cache. See SymbolicFactorizationCache. The
+  // cache is only used when SapSolverParameters::linear_solver_type is
+  // kBlockSparseCholesky. Passing nullptr (the default) disables reuse. If
+  // non-null, `cache` must outlive `this` solver.
+  void set_symbolic_factorization_cache(SymbolicFactorizationCache* cache);
+
   // Returns solver statistics from the last call to SolveWithGuess().
   // Statistics are reset with SapStatistics::Reset() on each new call to
   // SolveWithGuess().
@@ -445,6 +462,7 @@ class SapSolver {
     requires std::is_same_v<T, double>;
 
   SapSolverParameters parameters_;
+  SymbolicFactorizationCache* symbolic_cache_{nullptr};
   // Stats are mutable so we can update them from within const methods (e.g.
   // Eval() methods). Nothing in stats is allowed to affect the computation; it
   // is purely a passive observer.
@@ -14,6 +14,7 @@
 #include "drake/multibody/contact_solvers/contact_solver_utils.h"
 #include "drake/multibody/contact_solvers/sap/sap_friction_cone_constraint.h"
 #include "drake/multibody/contact_solvers/sap/sap_solver_results.h"
+#include "drake/multibody/contact_solvers/symbolic_factorization_cache.h"
 #include "drake/systems/framework/context.h"
 
 using drake::math::RotationMatrixd;
@@ -659,6 +660,53 @@ TEST_P(PizzaSaverTest, NoConstraints) {
   EXPECT_EQ(result.vc.size(), 0);
 }
 
+// The sparsity of the pizza saver problem does not change from step to step.
+// Therefore the symbolic analysis performed on the first step is reused on
+// every following step, with results identical to those without reuse.
+TEST_P(PizzaSaverTest, ReuseSymbolicFactorization) {
+  const PizzaSaverProblem problem = MakeStictionProblem();
+  const Vector4d tau(0.0, 0.0, -problem.mass() * problem.g(), 20.0);
+  SapSolverParameters params;  // Default set of parameters.
+  params.line_search_type = GetParam();
+
+  SymbolicFactorizationCache cache;
+  SapSolver<double> sap_with_cache;
+  sap_with_cache.set_parameters(params);
+  sap_with_cache.set_symbolic_factorization_cache(&cache);
+  SapSolver<double> sap;
+  sap.set_parameters(params);
+
+  const double theta = M_PI / 5;  // Arbitrary orientation.
+  VectorXd q = Vector4d(0.0, 0.0, 0.0, theta);
+  VectorXd v = Vector4d(1.0, 2.0, 3.0, 4.0);
+  SapSolverResults<double> result_with_cache;
+  SapSolverResults<double> result;
+  const int num_steps = 5;
+  for (int i = 0; i < num_steps; ++i) {
+    const auto contact_problem =
+        problem.MakeContactProblem(q, v, tau, 1.0, kDefaultSigma);
+    ASSERT_EQ(sap_with_cache.SolveWithGuess(*contact_problem, v,
+                                            &result_with_cache),
+              SapSolverStatus::kSuccess);
+    ASSERT_EQ(sap.SolveWithGuess(*contact_problem, v, &result),
+              SapSolverStatus::kSuccess);
+    EXPECT_EQ(result_with_cache.v, result.v);
+    EXPECT_EQ(result_with_cache.gamma, result.gamma);
+
+    const SapStatistics& stats = sap_with_cache.get_statistics();
+    ASSERT_GT(stats.num_iters, 0);
+    EXPECT_EQ(stats.num_symbolic_factorization_cache_hits, i == 0 ? 0 : 1);
+    EXPECT_EQ(stats.num_symbolic_factorization_cache_misses, i == 0 ? 1 : 0);
+    EXPECT_EQ(sap.get_statistics().num_symbolic_factorization_cache_hits, 0);
+    EXPECT_EQ(sap.get_statistics().num_symbolic_factorization_cache_misses, 0);
+
+    v = result.v;
+    q += problem.time_step() * v;
+  }
+  EXPECT_EQ(cache.num_hits(), num_steps - 1);
+  EXPECT_EQ(cache.num_misses(), 1);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     TestLineSearchMethods, PizzaSaverTest,
     testing::Values(SapSolverParameters::LineSearchType::kBackTracking,
@@ -96,6 +96,18 @@ class SchurComplement {
   SchurComplement(const BlockSparseSymmetricMatrix3d& A,
                   const std::unordered_set<int>& D_indices);
 
+  /* Recomputes `this` SchurComplement for the matrix A and the block indices
+   D_indices, with the same result as `*this = SchurComplement(A, D_indices)`.
+   Prefer this over constructing a new SchurComplement when computing the Schur
+   complements of a sequence of matrices: if A has the same sparsity pattern and
+   D_indices are the same as in the previous computation, the elimination
+   ordering and the symbolic factorization are reused and only the numeric
+   factorization is recomputed.
+   @pre D_indices is a subset of {0, ..., A.block_cols()-1}.
+   @throws std::exception if the factorization of A fails. */
+  void Update(const BlockSparseSymmetricMatrix3d& A,
+              const std::unordered_set<int>& D_indices);
+
   /* Returns the Schur complement for the block D of the matrix A,
    S = C - BᵀD⁻¹B. */
   const MatrixX<double>& get_D_complement() const { return S_; }
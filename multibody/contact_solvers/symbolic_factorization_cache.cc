@@ -0,0 +1,86 @@
+#include "drake/multibody/contact_solvers/symbolic_factorization_cache.h"
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+bool SamePattern(const BlockSparsityPattern& a, const BlockSparsityPattern& b) {
+  return a.block_sizes() == b.block_sizes() && a.neighbors() == b.neighbors();
+}
+
+}  // namespace
+
+SymbolicFactorizationCache::SymbolicFactorizationCache(int capacity)
+    : capacity_(capacity) {
+  DRAKE_THROW_UNLESS(capacity > 0);
+}
+
+SymbolicFactorizationCache::~SymbolicFactorizationCache() = default;
+
+int SymbolicFactorizationCache::size() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return ssize(entries_);
+}
+
+bool SymbolicFactorizationCache::Find(
+    const BlockSparsityPattern& pattern,
+    BlockSparseCholeskySolver<Eigen::MatrixXd>* solver) {
+  DRAKE_DEMAND(solver != nullptr);
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    if (SamePattern(it->first, pattern)) {
+      // Move the entry to the front to mark it as the most recently used.
+      entries_.splice(entries_.begin(), entries_, it);
+      *solver = entries_.front().second;
+      ++num_hits_;
+      return true;
+    }
+  }
+  ++num_misses_;
+  return false;
+}
+
+void SymbolicFactorizationCache::Insert(
+    const BlockSparsityPattern& pattern,
+    const BlockSparseCholeskySolver<Eigen::MatrixXd>& solver) {
+  using SolverMode = BlockSparseCholeskySolver<Eigen::MatrixXd>::SolverMode;
+  DRAKE_THROW_UNLESS(solver.solver_mode() == SolverMode::kAnalyzed);
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    if (SamePattern(it->first, pattern)) {
+      entries_.erase(it);
+      break;
+    }
+  }
+  if (ssize(entries_) == capacity_) {
+    entries_.pop_back();
+  }
+  entries_.emplace_front(pattern, solver);
+}
+
+int SymbolicFactorizationCache::num_hits() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return num_hits_;
+}
+
+int SymbolicFactorizationCache::num_misses() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return num_misses_;
+}
+
+void SymbolicFactorizationCache::Clear() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  entries_.clear();
+  num_hits_ = 0;
+  num_misses_ = 0;
+}
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <utility>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
+#include "drake/multibody/contact_solvers/block_sparse_lower_triangular_or_symmetric_matrix.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+/* A small cache of symbolic factorizations performed by
+ BlockSparseCholeskySolver, keyed on the sparsity pattern of the factored
+ matrix.
+
+ The symbolic analysis (fill-reducing ordering, elimination tree and the
+ allocation of the factor) performed by BlockSparseCholeskySolver::SetMatrix()
+ depends only on the sparsity pattern of the matrix. In time stepping
+ simulations the contact graph often persists over many consecutive steps and
+ therefore so does the sparsity pattern of the Hessian. This cache keeps the
+ analyzed solvers for the most recently seen patterns so that a new solver for
+ a matrix with one of those patterns can be obtained by copying an analyzed
+ solver and calling UpdateMatrix(), skipping the analysis altogether.
+
+ The cache stores at most `capacity` patterns and evicts the least recently
+ used one when full. All methods are thread safe so that a single cache can be
+ shared by solvers running concurrently. */
+class SymbolicFactorizationCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SymbolicFactorizationCache);
+
+  /* Constructs an empty cache that stores at most `capacity` patterns.
+   @pre capacity > 0. */
+  explicit SymbolicFactorizationCache(int capacity = 4);
+
+  ~SymbolicFactorizationCache();
+
+  int capacity() const { return capacity_; }
+
+  /* Returns the number of patterns currently stored. */
+  int size() const;
+
+  /* If the cache stores a symbolic factorization for `pattern`, copies it into
+   `solver` and returns `true`. Otherwise leaves `solver` untouched and returns
+   `false`. Either outcome is recorded in num_hits() and num_misses().
+   @pre solver != nullptr. */
+  bool Find(const BlockSparsityPattern& pattern,
+            BlockSparseCholeskySolver<Eigen::MatrixXd>* solver);
+
+  /* Stores a copy of `solver` as the symbolic factorization for `pattern`,
+   replacing any existing entry for the same pattern and evicting the least
+   recently used entry if the cache is full.
+   @pre The last call to SetMatrix() on `solver` was with a matrix whose
+   sparsity pattern is `pattern`.
+   @throws std::exception if solver.solver_mode() is not kAnalyzed. */
+  void Insert(const BlockSparsityPattern& pattern,
+              const BlockSparseCholeskySolver<Eigen::MatrixXd>& solver);
+
+  /* Total number of calls to Find() that found a stored factorization. */
+  int num_hits() const;
+
+  /* Total number of calls to Find() that did not find a stored
+   factorization. */
+  int num_misses() const;
+
+  /* Removes all stored factorizations and resets the hit/miss counters. */
+  void Clear();
+
+ private:
+  using Entry = std::pair<BlockSparsityPattern,
+                          BlockSparseCholeskySolver<Eigen::MatrixXd>>;
+
+  int capacity_{};
+  mutable std::mutex mutex_;
+  /* Entries sorted from most to least recently used. */
+  std::list<Entry> entries_;
+  int num_hits_{0};
+  int num_misses_{0};
+};
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
@@ -277,6 +277,57 @@ GTEST_TEST(BlockSparseCholeskySolverTest, FactorAndCalcSchurComplement) {
   }
 }
 
+/* Repeated calls to FactorAndCalcSchurComplement() reuse the symbolic analysis
+ when the sparsity pattern and the eliminated blocks don't change, and must
+ produce the same results as a fresh solver in all cases. */
+GTEST_TEST(BlockSparseCholeskySolverTest, ReuseSchurComplementAnalysis) {
+  BlockSparseCholeskySolver<MatrixXd> solver;
+  const std::unordered_set<int> eliminated_blocks = {0, 1, 3};
+  const BlockSparseSymmetricMatrixXd M1 = MakeSparseSpdMatrix(1.0);
+  const BlockSparseSymmetricMatrixXd M2 = MakeSparseSpdMatrix(2.0);
+  const VectorXd b = VectorXd::LinSpaced(M1.cols(), 0.0, 1.0);
+
+  auto verify = [&](const BlockSparseSymmetricMatrixXd& M,
+                    const std::unordered_set<int>& eliminated) {
+    BlockSparseCholeskySolver<MatrixXd> fresh_solver;
+    const std::optional<MatrixXd> expected =
+        fresh_solver.FactorAndCalcSchurComplement(M, eliminated);
+    const std::optional<MatrixXd> schur_complement =
+        solver.FactorAndCalcSchurComplement(M, eliminated);
+    ASSERT_TRUE(expected.has_value());
+    ASSERT_TRUE(schur_complement.has_value());
+    EXPECT_TRUE(CompareMatrices(schur_complement.value(), expected.value()));
+    EXPECT_TRUE(CompareMatrices(solver.Solve(b), fresh_solver.Solve(b)));
+  };
+
+  verify(M1, eliminated_blocks);
+  /* Same pattern and eliminated blocks; only the values change. */
+  verify(M2, eliminated_blocks);
+  /* The eliminated blocks change. */
+  verify(M2, {2});
+  /* All blocks are eliminated, twice in a row. */
+  verify(M1, {0, 1, 2, 3});
+  verify(M2, {0, 1, 2, 3});
+  /* SetMatrix() replaces the analysis. */
+  solver.SetMatrix(M1);
+  verify(M1, eliminated_blocks);
+  /* The sparsity pattern changes. */
+  std::vector<std::vector<int>> sparsity = {{0, 1}, {1, 2, 3}, {2}, {3}};
+  BlockSparseSymmetricMatrixXd M3(
+      BlockSparsityPattern({2, 3, 4, 3}, std::move(sparsity)));
+  const MatrixXd dense_M2 = M2.MakeDenseMatrix();
+  const std::vector<int>& starting_cols = M3.starting_cols();
+  const std::vector<int>& block_sizes = M3.sparsity_pattern().block_sizes();
+  for (int j = 0; j < M3.block_cols(); ++j) {
+    for (int i : M3.block_row_indices(j)) {
+      M3.SetBlock(i, j,
+                  dense_M2.block(starting_cols[i], starting_cols[j],
+                                 block_sizes[i], block_sizes[j]));
+    }
+  }
+  verify(M3, eliminated_blocks);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
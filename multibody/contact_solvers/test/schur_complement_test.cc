@@ -132,6 +132,32 @@ GTEST_TEST(SchurComplementTest, Solve) {
   EXPECT_TRUE(CompareMatrices(z, expected_z, kTolerance));
 }
 
+GTEST_TEST(SchurComplementTest, Update) {
+  const BlockSparseSymmetricMatrix3d A = MakeBlockSparseMatrix();
+  const VectorXd b = VectorXd::LinSpaced(9, 0.0, 12.0);
+  SchurComplement schur_complement = MakeSchurComplement();
+  const SchurComplement expected_with_D_indices_1 = MakeSchurComplement();
+  const SchurComplement expected_with_D_indices_0_2(A, {0, 2});
+
+  schur_complement.Update(A, {0, 2});
+  EXPECT_TRUE(CompareMatrices(schur_complement.get_D_complement(),
+                              expected_with_D_indices_0_2.get_D_complement()));
+  EXPECT_TRUE(CompareMatrices(schur_complement.Solve(b),
+                              expected_with_D_indices_0_2.Solve(b)));
+  const VectorXd y = VectorXd::LinSpaced(3, 0.0, 1.0);
+  EXPECT_TRUE(CompareMatrices(schur_complement.SolveForX(y),
+                              expected_with_D_indices_0_2.SolveForX(y)));
+
+  /* Updating twice with the same matrix and D indices reuses the analysis. */
+  for (int i = 0; i < 2; ++i) {
+    schur_complement.Update(A, {1});
+    EXPECT_TRUE(CompareMatrices(schur_complement.get_D_complement(),
+                                expected_with_D_indices_1.get_D_complement()));
+    EXPECT_TRUE(CompareMatrices(schur_complement.Solve(b),
+                                expected_with_D_indices_1.Solve(b)));
+  }
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
@@ -0,0 +1,150 @@
+#include "drake/multibody/contact_solvers/symbolic_factorization_cache.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/multibody/contact_solvers/block_sparse_supernodal_solver.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+/* Makes a block diagonal SPD mass matrix with three 2x2 blocks. */
+std::vector<MatrixXd> MakeMassMatrix() {
+  std::vector<MatrixXd> A(3);
+  for (int i = 0; i < 3; ++i) {
+    A[i] = (MatrixXd(2, 2) << 4 + i, 1, 1, 3 + i).finished();
+  }
+  return A;
+}
+
+/* Makes a Jacobian with two constraints of three equations each. The first
+ constraint couples cliques `first` and `second`, the second constraint acts on
+ the remaining clique. The `scale` changes the values but not the
+ sparsity. */
+BlockSparseMatrix<double> MakeJacobian(int first, int second, double scale) {
+  const int other = 3 - first - second;
+  BlockSparseMatrixBuilder<double> builder(2, 3, 3);
+  const MatrixXd J = scale * (MatrixXd(3, 2) << 1, 2, 0, 1, 3, 1).finished();
+  builder.PushBlock(0, first, MatrixBlock<double>(J));
+  builder.PushBlock(0, second, MatrixBlock<double>(-J));
+  builder.PushBlock(1, other, MatrixBlock<double>(2.0 * J));
+  return builder.Build();
+}
+
+std::vector<MatrixXd> MakeWeightMatrix(double scale) {
+  return std::vector<MatrixXd>(2, scale * MatrixXd::Identity(3, 3));
+}
+
+/* Solves H⋅x = b with H = A + Jᵀ⋅G⋅J using `solver`. */
+VectorXd Solve(SuperNodalSolver* solver, const std::vector<MatrixXd>& G) {
+  solver->SetWeightMatrix(G);
+  EXPECT_TRUE(solver->Factor());
+  return solver->Solve(VectorXd::LinSpaced(6, 1.0, 6.0));
+}
+
+GTEST_TEST(SymbolicFactorizationCacheTest, ReuseSamePattern) {
+  SymbolicFactorizationCache cache;
+  const std::vector<MatrixXd> A = MakeMassMatrix();
+  const BlockSparseMatrix<double> J1 = MakeJacobian(0, 1, 1.0);
+  const BlockSparseMatrix<double> J2 = MakeJacobian(0, 1, 2.5);
+
+  BlockSparseSuperNodalSolver first(A, J1, &cache);
+  EXPECT_FALSE(first.reused_symbolic_factorization());
+  EXPECT_EQ(cache.num_hits(), 0);
+  EXPECT_EQ(cache.num_misses(), 1);
+  EXPECT_EQ(cache.size(), 1);
+
+  // Different values with the same sparsity reuse the analysis.
+  BlockSparseSuperNodalSolver second(A, J2, &cache);
+  EXPECT_TRUE(second.reused_symbolic_factorization());
+  EXPECT_EQ(cache.num_hits(), 1);
+  EXPECT_EQ(cache.num_misses(), 1);
+  EXPECT_EQ(cache.size(), 1);
+
+  // The solution with a reused analysis is bit-identical to the solution
+  // without a cache.
+  BlockSparseSuperNodalSolver uncached(A, J2);
+  EXPECT_FALSE(uncached.reused_symbolic_factorization());
+  const std::vector<MatrixXd> G = MakeWeightMatrix(3.0);
+  const VectorXd x = Solve(&second, G);
+  EXPECT_TRUE(CompareMatrices(x, Solve(&uncached, G), 0.0));
+
+  // And it matches the dense solution.
+  MatrixXd H = MatrixXd::Zero(6, 6);
+  for (int i = 0; i < 3; ++i) H.block(2 * i, 2 * i, 2, 2) = A[i];
+  const MatrixXd J_dense = J2.MakeDenseMatrix();
+  H += J_dense.transpose() * 3.0 * J_dense;
+  EXPECT_TRUE(CompareMatrices(H * x, VectorXd::LinSpaced(6, 1.0, 6.0), 1e-12));
+
+  // The cached analysis is unaffected by factorizations of the solvers that
+  // copied it.
+  BlockSparseSuperNodalSolver third(A, J1, &cache);
+  EXPECT_TRUE(third.reused_symbolic_factorization());
+  BlockSparseSuperNodalSolver uncached_first(A, J1);
+  EXPECT_TRUE(CompareMatrices(Solve(&third, MakeWeightMatrix(0.5)),
+                              Solve(&uncached_first, MakeWeightMatrix(0.5)),
+                              0.0));
+}
+
+/* Returns `true` iff a solver for A and J constructed with `cache` reuses a
+ cached symbolic factorization. */
+bool ReusesAnalysis(const std::vector<MatrixXd>& A,
+                    const BlockSparseMatrix<double>& J,
+                    SymbolicFactorizationCache* cache) {
+  return BlockSparseSuperNodalSolver(A, J, cache)
+      .reused_symbolic_factorization();
+}
+
+GTEST_TEST(SymbolicFactorizationCacheTest, LeastRecentlyUsedEviction) {
+  SymbolicFactorizationCache cache(2);
+  EXPECT_EQ(cache.capacity(), 2);
+  const std::vector<MatrixXd> A = MakeMassMatrix();
+  // Coupling different pairs of cliques leads to different sparsity patterns.
+  const BlockSparseMatrix<double> J01 = MakeJacobian(0, 1, 1.0);
+  const BlockSparseMatrix<double> J02 = MakeJacobian(0, 2, 1.0);
+  const BlockSparseMatrix<double> J12 = MakeJacobian(1, 2, 1.0);
+
+  EXPECT_FALSE(ReusesAnalysis(A, J01, &cache));
+  EXPECT_FALSE(ReusesAnalysis(A, J02, &cache));
+  EXPECT_EQ(cache.size(), 2);
+  // Touch J01, so that J02 becomes the least recently used.
+  EXPECT_TRUE(ReusesAnalysis(A, J01, &cache));
+
+  // A third pattern evicts J02.
+  EXPECT_FALSE(ReusesAnalysis(A, J12, &cache));
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_TRUE(ReusesAnalysis(A, J01, &cache));
+  EXPECT_TRUE(ReusesAnalysis(A, J12, &cache));
+  EXPECT_FALSE(ReusesAnalysis(A, J02, &cache));
+  EXPECT_EQ(cache.num_hits(), 3);
+  EXPECT_EQ(cache.num_misses(), 4);
+
+  cache.Clear();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_EQ(cache.num_hits(), 0);
+  EXPECT_EQ(cache.num_misses(), 0);
+}
+
+GTEST_TEST(SymbolicFactorizationCacheTest, InsertRequiresAnalyzedSolver) {
+  SymbolicFactorizationCache cache;
+  BlockSparseCholeskySolver<MatrixXd> solver;
+  const BlockSparsityPattern pattern({2}, {{0}});
+  DRAKE_EXPECT_THROWS_MESSAGE(cache.Insert(pattern, solver),
+                              ".*kAnalyzed.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(SymbolicFactorizationCache(0), ".*capacity.*");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,179 @@
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/geometry/proximity/make_box_mesh.h"
+#include "drake/multibody/contact_solvers/eigen_block_3x3_sparse_symmetric_matrix.h"
+#include "drake/multibody/fem/corotated_model.h"
+#include "drake/multibody/fem/fem_solver.h"
+#include "drake/multibody/fem/linear_simplex_element.h"
+#include "drake/multibody/fem/simplex_gaussian_quadrature.h"
+#include "drake/multibody/fem/velocity_newmark_scheme.h"
+#include "drake/multibody/fem/volumetric_model.h"
+#include "drake/systems/framework/leaf_context.h"
+#include "drake/tools/performance/fixture_common.h"
+
+// These benchmarks compare solving the Newton iterations of a nonlinear FEM
+// model with the assembled tangent matrix and matrix-free, on box meshes of
+// increasing resolution. AdvanceOneTimeStep measures a full time step,
+// including the factorization for the Schur complement that both modes
+// perform once per step (its symbolic analysis is reused from the previous
+// benchmark iteration). TangentSolve measures only the linear solve of a
+// single Newton iteration.
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace {
+
+using contact_solvers::internal::EigenBlock3x3SparseSymmetricMatrix;
+
+constexpr double kBoxLength = 0.1;
+constexpr double kDt = 0.01;
+constexpr double kYoungsModulus = 1e5;
+constexpr double kPoissonsRatio = 0.4;
+constexpr double kDensity = 1e3;
+// Relative tolerance for the linear solves in TangentSolve.
+constexpr double kCgTolerance = 1e-4;
+
+using QuadratureType = SimplexGaussianQuadrature<3, 1>;
+using IsoparametricElementType =
+    LinearSimplexElement<double, 3, 3, QuadratureType::num_quadrature_points>;
+using ElementType = VolumetricElement<IsoparametricElementType, QuadratureType,
+                                      CorotatedModel<double>>;
+using ModelType = VolumetricModel<ElementType>;
+
+class FemSolverBenchmark : public benchmark::Fixture {
+ public:
+  FemSolverBenchmark() { tools::performance::AddMinMaxStatistics(this); }
+
+  // Builds a corotated box whose sides are subdivided into state.range(0)
+  // cells, i.e. 6⋅state.range(0)³ tetrahedra. The solver is matrix-free iff
+  // state.range(1) is nonzero, and uses state.range(2) threads.
+  void SetUp(const benchmark::State& state) override {
+    const int n = state.range(0);
+    const geometry::VolumeMesh<double> mesh =
+        geometry::internal::MakeBoxVolumeMesh<double>(
+            geometry::Box(kBoxLength, kBoxLength, kBoxLength), kBoxLength / n);
+    model_ = std::make_unique<ModelType>(integrator_.GetWeights());
+    ModelType::VolumetricBuilder builder(model_.get());
+    builder.AddLinearTetrahedralElements(
+        mesh, CorotatedModel<double>(kYoungsModulus, kPoissonsRatio), kDensity,
+        DampingModel<double>(0.0, 0.0));
+    builder.Build();
+    model_->set_parallelism(Parallelism(static_cast<int>(state.range(2))));
+
+    solver_ = std::make_unique<FemSolver<double>>(model_.get(), &integrator_);
+    solver_->set_matrix_free_element_threshold(
+        state.range(1) ? 0 : model_->num_elements() + 1);
+
+    // Start from a state that stretches the box along x so that the Newton
+    // solve takes a few iterations.
+    state0_ = model_->MakeFemState();
+    Eigen::VectorXd v = Eigen::VectorXd::Zero(model_->num_dofs());
+    const Eigen::VectorXd& q = state0_->GetPositions();
+    for (int i = 0; i < model_->num_nodes(); ++i) {
+      v(3 * i) = 5.0 * q(3 * i);
+    }
+    state0_->SetVelocities(v);
+    for (int i = 0; i < model_->num_nodes(); ++i) {
+      nonparticipating_vertices_.insert(i);
+    }
+  }
+
+  void TearDown(const benchmark::State&) override {
+    solver_.reset();
+    state0_.reset();
+    model_.reset();
+    nonparticipating_vertices_.clear();
+  }
+
+ protected:
+  VelocityNewmarkScheme<double> integrator_{kDt, 1.0, 0.5};
+  std::unique_ptr<ModelType> model_;
+  std::unique_ptr<FemSolver<double>> solver_;
+  std::unique_ptr<FemState<double>> state0_;
+  std::unordered_set<int> nonparticipating_vertices_;
+  const systems::LeafContext<double> dummy_context_;
+  const FemPlantData<double> dummy_data_{dummy_context_, {}};
+};
+
+BENCHMARK_DEFINE_F(FemSolverBenchmark, AdvanceOneTimeStep)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  int iterations = 0;
+  for (auto _ : state) {
+    iterations = solver_->AdvanceOneTimeStep(*state0_, dummy_data_,
+                                             nonparticipating_vertices_);
+  }
+  state.counters["elements"] = model_->num_elements();
+  state.counters["newton_iterations"] = iterations;
+}
+
+BENCHMARK_DEFINE_F(FemSolverBenchmark, TangentSolve)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  // Linearize about the state after one explicit step from state0_.
+  std::unique_ptr<FemState<double>> fem_state = model_->MakeFemState();
+  integrator_.AdvanceOneTimeStep(*state0_, integrator_.GetUnknowns(*state0_),
+                                 fem_state.get());
+  Eigen::VectorXd b(model_->num_dofs());
+  model_->CalcResidual(*fem_state, dummy_data_, &b);
+  b = -b;
+  Eigen::VectorXd dz(model_->num_dofs());
+  int cg_iterations = 0;
+  if (state.range(1)) {
+    for (auto _ : state) {
+      const TangentMatrixOperator<double> tangent_operator(model_.get(),
+                                                           fem_state.get());
+      cg_iterations = SolveWithConjugateGradient<double>(
+          tangent_operator, b, kCgTolerance, 2 * model_->num_dofs(), &dz);
+    }
+  } else {
+    auto tangent_matrix = model_->MakeTangentMatrix();
+    Eigen::ConjugateGradient<EigenBlock3x3SparseSymmetricMatrix,
+                             Eigen::Lower | Eigen::Upper>
+        cg;
+    cg.setTolerance(kCgTolerance);
+    for (auto _ : state) {
+      model_->CalcTangentMatrix(*fem_state, tangent_matrix.get());
+      const EigenBlock3x3SparseSymmetricMatrix wrapper(tangent_matrix.get(),
+                                                       model_->parallelism());
+      cg.compute(wrapper);
+      dz = cg.solve(b);
+      cg_iterations = cg.iterations();
+    }
+  }
+  state.counters["elements"] = model_->num_elements();
+  state.counters["cg_iterations"] = cg_iterations;
+}
+
+// Sweeps the assembled (0) and matrix-free (1) solvers on 1 and 4 threads
+// over the given mesh resolutions.
+void SolverSweep(benchmark::Benchmark* b, const std::vector<int64_t>& n) {
+  b->ArgsProduct({n, {0, 1}, {1, 4}})
+      ->Unit(benchmark::kMillisecond)
+      ->UseRealTime();
+}
+
+// A full time step is dominated by the factorization for the Schur complement
+// whose cost grows quickly with the mesh size, so we stop at about 25k
+// tetrahedra.
+BENCHMARK_REGISTER_F(FemSolverBenchmark, AdvanceOneTimeStep)
+    ->Apply([](benchmark::Benchmark* b) {
+      SolverSweep(b, {8, 16});
+    });
+// Meshes from about three thousand to about eighty thousand tetrahedra.
+BENCHMARK_REGISTER_F(FemSolverBenchmark, TangentSolve)
+    ->Apply([](benchmark::Benchmark* b) {
+      SolverSweep(b, {8, 16, 24});
+    });
+
+}  // namespace
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
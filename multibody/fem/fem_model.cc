@@ -70,6 +70,33 @@ void FemModel<T>::CalcTangentMatrix(
   }
 }
 
+template <typename T>
+void FemModel<T>::CalcTangentMatrixTimesVector(
+    const FemState<T>& fem_state, const Eigen::Ref<const VectorX<T>>& x,
+    EigenPtr<VectorX<T>> y) const {
+  DRAKE_DEMAND(y != nullptr);
+  DRAKE_THROW_UNLESS(x.size() == num_dofs());
+  DRAKE_THROW_UNLESS(y->size() == num_dofs());
+  ThrowIfModelStateIncompatible(__func__, fem_state);
+  DoCalcTangentMatrixTimesVector(fem_state, x, y);
+}
+
+template <typename T>
+void FemModel<T>::CalcTangentMatrixBlockDiagonal(
+    const FemState<T>& fem_state, std::vector<Matrix3<T>>* diagonal) const {
+  DRAKE_DEMAND(diagonal != nullptr);
+  ThrowIfModelStateIncompatible(__func__, fem_state);
+  diagonal->resize(num_nodes());
+  DoCalcTangentMatrixBlockDiagonal(fem_state, diagonal);
+  /* Mirror DirichletBoundaryCondition::ApplyBoundaryConditionToTangentMatrix()
+   which keeps only the diagonal entries of the diagonal blocks of nodes under
+   the boundary condition. */
+  for (const auto& it : dirichlet_bc_.index_to_boundary_state()) {
+    Matrix3<T>& block = (*diagonal)[it.first];
+    block = block.diagonal().eval().asDiagonal();
+  }
+}
+
 template <typename T>
 Vector3<T> FemModel<T>::CalcCenterOfMassPositionInWorld(
     const FemState<T>& fem_state) const {
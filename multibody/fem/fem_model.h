@@ -171,6 +171,33 @@ class FemModel {
       contact_solvers::internal::BlockSparseSymmetricMatrix3d* tangent_matrix)
       const;
 
+  /** Calculates y = A⋅x, where A is the tangent matrix computed by
+   CalcTangentMatrix() at the given FEM state, without assembling A. The product
+   is accumulated element by element from the tangent matrices of the
+   individual elements, so the cost of each product is linear in the number of
+   elements and no global sparse matrix needs to be allocated or filled.
+   @param[in] fem_state  The FemState used to evaluate the tangent matrix.
+   @param[in] x          The vector to multiply with, of size `num_dofs()`.
+   @param[out] y         The product A⋅x, of size `num_dofs()`.
+   @pre y != nullptr.
+   @throws std::exception if the FEM state is incompatible with this model.
+   @throws std::exception if the size of `x` or `y` is not `num_dofs()`. */
+  void CalcTangentMatrixTimesVector(const FemState<T>& fem_state,
+                                    const Eigen::Ref<const VectorX<T>>& x,
+                                    EigenPtr<VectorX<T>> y) const;
+
+  /** Calculates the 3x3 diagonal blocks of the tangent matrix computed by
+   CalcTangentMatrix() at the given FEM state, one per node, without assembling
+   the tangent matrix.
+   @param[in] fem_state  The FemState used to evaluate the tangent matrix.
+   @param[out] diagonal  On output, diagonal->at(n) is the diagonal block of the
+                         tangent matrix for the n-th node. Resized to
+                         `num_nodes()`.
+   @pre diagonal != nullptr.
+   @throws std::exception if the FEM state is incompatible with this model. */
+  void CalcTangentMatrixBlockDiagonal(const FemState<T>& fem_state,
+                                      std::vector<Matrix3<T>>* diagonal) const;
+
   /** Calculates the position vector from the world origin Wo to the center
    of mass of all bodies in this FemModel S, expressed in the world frame W.
    @param[in] fem_state The FemState used to evaluate the center of mass.
@@ -303,6 +330,24 @@ class FemModel {
       contact_solvers::internal::BlockSparseSymmetricMatrix3d* tangent_matrix)
       const = 0;
 
+  /** FemModelImpl must override this method to provide an implementation for
+   the NVI CalcTangentMatrixTimesVector(), including the effect of the
+   Dirichlet boundary condition. The input `fem_state` is guaranteed to be
+   compatible with `this` FEM model, and the inputs `x` and `y` are guaranteed
+   to be properly sized. */
+  virtual void DoCalcTangentMatrixTimesVector(
+      const FemState<T>& fem_state, const Eigen::Ref<const VectorX<T>>& x,
+      EigenPtr<VectorX<T>> y) const = 0;
+
+  /** FemModelImpl must override this method to provide an implementation for
+   the NVI CalcTangentMatrixBlockDiagonal() for the model without the Dirichlet
+   boundary condition; the NVI applies the boundary condition. The input
+   `fem_state` is guaranteed to be compatible with `this` FEM model, and the
+   input `diagonal` is guaranteed to be non-null and of size `num_nodes()`. */
+  virtual void DoCalcTangentMatrixBlockDiagonal(
+      const FemState<T>& fem_state,
+      std::vector<Matrix3<T>>* diagonal) const = 0;
+
   /** FemModelImpl must override this method to provide an implementation for
    the NVI CalcCenterOfMassPositionInWorld(). The input `fem_state` is
    guaranteed to be compatible with `this` FEM model. */
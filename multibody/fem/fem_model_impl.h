@@ -40,6 +40,16 @@ class FemModelImpl : public FemModel<typename Element::T> {
   /* Returns the number of FEM elements owned by this FEM model. */
   int num_elements() const final { return elements_.size(); }
 
+  /* Returns a partition of the elements of this model into "colors" such that
+   no two elements of the same color share a node. element_colors()[c] lists
+   the indices of the elements with color c in increasing order. Elements of
+   the same color scatter their contributions to the tangent matrix into
+   disjoint blocks and can therefore be assembled concurrently without
+   synchronization. */
+  const std::vector<std::vector<int>>& element_colors() const {
+    return element_colors_;
+  }
+
  protected:
   /* Creates an empty FemModelImpl with no elements. */
   explicit FemModelImpl(const Vector3<T>& tangent_matrix_weights)
@@ -51,6 +61,7 @@ class FemModelImpl : public FemModel<typename Element::T> {
    FemModelImpl. */
   void AddElement(Element&& element) {
     elements_.emplace_back(std::move(element));
+    ColorElement(num_elements() - 1);
   }
 
   /* Moves the input `elements`' entries into the vector of elements owned by
@@ -59,9 +70,13 @@ class FemModelImpl : public FemModel<typename Element::T> {
    @pre elements != nullptr */
   void AddElements(std::vector<Element>* elements) {
     DRAKE_DEMAND(elements != nullptr);
+    const int num_old_elements = num_elements();
     elements_.insert(elements_.end(),
                      std::make_move_iterator(elements->begin()),
                      std::make_move_iterator(elements->end()));
+    for (int e = num_old_elements; e < num_elements(); ++e) {
+      ColorElement(e);
+    }
   }
 
   /* Returns all elements stored in this model. */
@@ -75,6 +90,8 @@ class FemModelImpl : public FemModel<typename Element::T> {
    from the `other` FemModelImpl to `this` FemModelImpl . */
   void SetFrom(const FemModelImpl<Element>& other) {
     elements_ = other.elements_;
+    element_colors_ = other.element_colors_;
+    node_colors_ = other.node_colors_;
   }
 
  private:
@@ -193,30 +210,126 @@ class FemModelImpl : public FemModel<typename Element::T> {
 
       const std::vector<Data>& element_data =
           fem_state.template EvalElementData<Data>(element_data_index_);
-      for (int e = 0; e < num_elements(); ++e) {
+      [[maybe_unused]] const int num_threads =
+          this->parallelism().num_threads();
+      /* Elements of the same color write to disjoint blocks of the tangent
+       matrix, so they can be scattered concurrently without locks. The colors
+       are always visited in the same order, so the result doesn't depend on
+       the number of threads. */
+      for (const std::vector<int>& elements_in_color : element_colors_) {
+        const int num_elements_in_color = elements_in_color.size();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads)
+#endif
+        for (int k = 0; k < num_elements_in_color; ++k) {
+          const int e = elements_in_color[k];
+          const Eigen::Matrix<T, Element::num_dofs, Element::num_dofs>&
+              element_tangent_matrix = element_data[e].tangent_matrix;
+          const std::array<FemNodeIndex, Element::num_nodes>&
+              element_node_indices = elements_[e].node_indices();
+          for (int a = 0; a < Element::num_nodes; ++a) {
+            const int i = element_node_indices[a];
+            for (int b = 0; b <= a; ++b) {
+              const int j = element_node_indices[b];
+              if (i >= j) {
+                tangent_matrix->AddToBlock(
+                    i, j,
+                    element_tangent_matrix.template block<3, 3>(3 * a, 3 * b));
+              } else {
+                tangent_matrix->AddToBlock(
+                    j, i,
+                    element_tangent_matrix.template block<3, 3>(3 * b, 3 * a));
+              }
+            }
+          }
+        }
+      }
+    } else {
+      unused(fem_state, tangent_matrix);
+      DRAKE_UNREACHABLE();
+    }
+  }
+
+  void DoCalcTangentMatrixTimesVector(const FemState<T>& fem_state,
+                                      const Eigen::Ref<const VectorX<T>>& x,
+                                      EigenPtr<VectorX<T>> y) const final {
+    /* The values are accumulated in y, so it is important to clear the old
+     data. */
+    y->setZero();
+    const std::vector<Data>& element_data =
+        fem_state.template EvalElementData<Data>(element_data_index_);
+    /* The Dirichlet boundary condition zeros the rows and columns of the
+     tangent matrix for constrained nodes except for the diagonal entries of
+     their diagonal blocks (see CalcTangentMatrix()). */
+    std::vector<bool> is_constrained(this->num_nodes(), false);
+    for (const auto& it :
+         this->dirichlet_boundary_condition().index_to_boundary_state()) {
+      is_constrained[it.first] = true;
+    }
+    [[maybe_unused]] const int num_threads = this->parallelism().num_threads();
+    /* Elements of the same color write to disjoint entries of y. */
+    for (const std::vector<int>& elements_in_color : element_colors_) {
+      const int num_elements_in_color = elements_in_color.size();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads)
+#endif
+      for (int k = 0; k < num_elements_in_color; ++k) {
+        const int e = elements_in_color[k];
         const Eigen::Matrix<T, Element::num_dofs, Element::num_dofs>&
             element_tangent_matrix = element_data[e].tangent_matrix;
         const std::array<FemNodeIndex, Element::num_nodes>&
             element_node_indices = elements_[e].node_indices();
+        Vector<T, Element::num_dofs> element_x;
         for (int a = 0; a < Element::num_nodes; ++a) {
           const int i = element_node_indices[a];
-          for (int b = 0; b <= a; ++b) {
-            const int j = element_node_indices[b];
-            if (i >= j) {
-              tangent_matrix->AddToBlock(
-                  i, j,
-                  element_tangent_matrix.template block<3, 3>(3 * a, 3 * b));
-            } else {
-              tangent_matrix->AddToBlock(
-                  j, i,
-                  element_tangent_matrix.template block<3, 3>(3 * b, 3 * a));
-            }
+          if (is_constrained[i]) {
+            element_x.template segment<3>(3 * a).setZero();
+          } else {
+            element_x.template segment<3>(3 * a) = x.template segment<3>(3 * i);
+          }
+        }
+        const Vector<T, Element::num_dofs> element_y =
+            element_tangent_matrix * element_x;
+        for (int a = 0; a < Element::num_nodes; ++a) {
+          const int i = element_node_indices[a];
+          if (is_constrained[i]) {
+            y->template segment<3>(3 * i) +=
+                element_tangent_matrix.template block<3, 3>(3 * a, 3 * a)
+                    .diagonal()
+                    .cwiseProduct(x.template segment<3>(3 * i));
+          } else {
+            y->template segment<3>(3 * i) +=
+                element_y.template segment<3>(3 * a);
           }
         }
       }
-    } else {
-      unused(fem_state, tangent_matrix);
-      DRAKE_UNREACHABLE();
+    }
+  }
+
+  void DoCalcTangentMatrixBlockDiagonal(
+      const FemState<T>& fem_state,
+      std::vector<Matrix3<T>>* diagonal) const final {
+    for (Matrix3<T>& block : *diagonal) {
+      block.setZero();
+    }
+    const std::vector<Data>& element_data =
+        fem_state.template EvalElementData<Data>(element_data_index_);
+    [[maybe_unused]] const int num_threads = this->parallelism().num_threads();
+    for (const std::vector<int>& elements_in_color : element_colors_) {
+      const int num_elements_in_color = elements_in_color.size();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads)
+#endif
+      for (int k = 0; k < num_elements_in_color; ++k) {
+        const int e = elements_in_color[k];
+        const std::array<FemNodeIndex, Element::num_nodes>&
+            element_node_indices = elements_[e].node_indices();
+        for (int a = 0; a < Element::num_nodes; ++a) {
+          (*diagonal)[element_node_indices[a]] +=
+              element_data[e].tangent_matrix.template block<3, 3>(3 * a,
+                                                                  3 * a);
+        }
+      }
     }
   }
 
@@ -302,8 +415,35 @@ class FemModelImpl : public FemModel<typename Element::T> {
     }
   }
 
+  /* Assigns the element with index `e` the smallest color not used by any
+   element sharing a node with it (greedy coloring). */
+  void ColorElement(int e) {
+    const std::array<FemNodeIndex, Element::num_nodes>& element_node_indices =
+        elements_[e].node_indices();
+    std::vector<bool> used;
+    for (int a = 0; a < Element::num_nodes; ++a) {
+      const int node = element_node_indices[a];
+      if (node >= ssize(node_colors_)) node_colors_.resize(node + 1);
+      for (int c : node_colors_[node]) {
+        if (c >= ssize(used)) used.resize(c + 1, false);
+        used[c] = true;
+      }
+    }
+    const int color =
+        std::find(used.begin(), used.end(), false) - used.begin();
+    if (color == ssize(element_colors_)) element_colors_.emplace_back();
+    element_colors_[color].push_back(e);
+    for (int a = 0; a < Element::num_nodes; ++a) {
+      node_colors_[element_node_indices[a]].push_back(color);
+    }
+  }
+
   /* FemElements owned by this model. */
   std::vector<Element> elements_;
+  /* See element_colors(). */
+  std::vector<std::vector<int>> element_colors_;
+  /* node_colors_[n] lists the colors of the elements incident to node n. */
+  std::vector<std::vector<int>> node_colors_;
   systems::CacheIndex element_data_index_;
 };
 
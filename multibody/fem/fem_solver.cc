@@ -129,9 +129,8 @@ int FemSolver<T>::SolveLinearModel(
   model_->CalcResidual(state, plant_data, &b);
   T residual_norm = b.norm();
   model_->CalcTangentMatrix(state, &tangent_matrix);
-  next_state_and_schur_complement_.schur_complement =
-      contact_solvers::internal::SchurComplement(tangent_matrix,
-                                                 nonparticipating_vertices);
+  next_state_and_schur_complement_.schur_complement.Update(
+      tangent_matrix, nonparticipating_vertices);
   if (residual_norm < absolute_tolerance_) {
     return 0;
   }
@@ -158,6 +157,8 @@ int FemSolver<T>::SolveNonlinearModel(
                            Eigen::Lower | Eigen::Upper>
       cg;
   double prev_cg_tolerance = 0;
+  const bool matrix_free =
+      model_->num_elements() >= matrix_free_element_threshold_;
   int iter = 0;
   /* For non-linear FEM models, the system of equations is non-linear and we use
    a Newton-Raphson solver. We iterate until any of the following is true:
@@ -168,17 +169,26 @@ int FemSolver<T>::SolveNonlinearModel(
   while (iter < max_iterations_ &&
          /* On first iteration, this is equivalent to residual_norm < abs_tol */
          !solver_converged(residual_norm, initial_residual_norm)) {
-    model_->CalcTangentMatrix(state, &tangent_matrix);
-    const EigenBlock3x3SparseSymmetricMatrix wrapper(&tangent_matrix,
-                                                     model_->parallelism());
     const double cg_tolerance = ComputeLinearSolverTolerance(
         residual_norm, prev_residual_norm, prev_cg_tolerance);
-    cg.setTolerance(cg_tolerance);
-    cg.compute(wrapper);
-    if (cg.info() != Eigen::Success) {
-      return -1;
+    if (matrix_free) {
+      const TangentMatrixOperator<T> tangent_operator(model_, &state);
+      /* Same iteration limit as Eigen::ConjugateGradient. */
+      if (SolveWithConjugateGradient<T>(tangent_operator, -b, cg_tolerance,
+                                        2 * model_->num_dofs(), &dz) < 0) {
+        return -1;
+      }
+    } else {
+      model_->CalcTangentMatrix(state, &tangent_matrix);
+      const EigenBlock3x3SparseSymmetricMatrix wrapper(&tangent_matrix,
+                                                       model_->parallelism());
+      cg.setTolerance(cg_tolerance);
+      cg.compute(wrapper);
+      if (cg.info() != Eigen::Success) {
+        return -1;
+      }
+      dz = cg.solve(-b);
     }
-    dz = cg.solve(-b);
     integrator_->UpdateStateFromChangeInUnknowns(dz, &state);
     prev_residual_norm = residual_norm;
     prev_cg_tolerance = cg_tolerance;
@@ -192,9 +202,8 @@ int FemSolver<T>::SolveNonlinearModel(
   }
   /* Build the Schur complement after the Newton iterations have converged. */
   model_->CalcTangentMatrix(state, &tangent_matrix);
-  next_state_and_schur_complement_.schur_complement =
-      contact_solvers::internal::SchurComplement(tangent_matrix,
-                                                 nonparticipating_vertices);
+  next_state_and_schur_complement_.schur_complement.Update(
+      tangent_matrix, nonparticipating_vertices);
   return iter;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <unordered_set>
 #include <utility>
@@ -11,6 +12,7 @@
 #include "drake/multibody/fem/discrete_time_integrator.h"
 #include "drake/multibody/fem/fem_model.h"
 #include "drake/multibody/fem/fem_state.h"
+#include "drake/multibody/fem/tangent_matrix_operator.h"
 
 namespace drake {
 namespace multibody {
@@ -123,6 +125,37 @@ class FemSolver {
     return max_linear_solver_tolerance_;
   }
 
+  /* Sets the number of elements at and above which the Newton iterations for
+   nonlinear models are solved matrix-free. Below the threshold, the tangent
+   matrix is assembled on every Newton iteration and the linear systems are
+   solved with conjugate gradient on the assembled matrix. At or above the
+   threshold, the tangent matrix is not assembled during the Newton iterations;
+   instead, the linear systems are solved with a conjugate gradient method
+   preconditioned with the block diagonal of the tangent matrix, using
+   element-by-element tangent matrix-vector products (see
+   TangentMatrixOperator). The tangent matrix is still assembled once per time
+   step, after convergence, to compute the Schur complement. Linear models are
+   always solved directly.
+
+   For linear tetrahedral elements, an element-by-element product reads
+   several times more data than a product with the assembled matrix, so the
+   matrix-free solve only pays off when the cost of assembly outweighs the
+   cost of the slower products. The matrix-free solve is therefore disabled by
+   default. Use //multibody/fem/benchmarking:fem_solver_benchmark to pick a
+   threshold for a given machine and model. */
+  void set_matrix_free_element_threshold(int num_elements) {
+    DRAKE_THROW_UNLESS(num_elements >= 0);
+    matrix_free_element_threshold_ = num_elements;
+  }
+
+  /* Returns the number of elements at and above which nonlinear models are
+   solved matrix-free. See set_matrix_free_element_threshold(). The default
+   value is std::numeric_limits<int>::max(), i.e. matrix-free solves are
+   disabled. */
+  int matrix_free_element_threshold() const {
+    return matrix_free_element_threshold_;
+  }
+
   /* Computes the inexact Newton linear solver tolerance according to eq(2.6)
    from [Eisenstat and Walker, 1996]. We choose γ = 1 and α = 2.
 
@@ -169,6 +202,9 @@ class FemSolver {
     }
 
     copyable_unique_ptr<FemState<T>> state;
+    /* Updated in place at every time step so that the symbolic analysis of its
+     factorization is reused for as long as the nonparticipating vertices don't
+     change. */
     contact_solvers::internal::SchurComplement schur_complement;
   };
 
@@ -243,6 +279,8 @@ class FemSolver {
   /* Max number of Newton-Raphson iterations the solver takes before it gives
    up. */
   int max_iterations_{100};
+  /* See set_matrix_free_element_threshold(). */
+  int matrix_free_element_threshold_{std::numeric_limits<int>::max()};
   FemStateAndSchurComplement next_state_and_schur_complement_;
   Scratch scratch_;
 };
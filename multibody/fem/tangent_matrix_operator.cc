@@ -0,0 +1,105 @@
+#include "drake/multibody/fem/tangent_matrix_operator.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+
+template <typename T>
+TangentMatrixOperator<T>::TangentMatrixOperator(const FemModel<T>* model,
+                                                const FemState<T>* state)
+    : contact_solvers::internal::LinearOperator<T>("TangentMatrixOperator"),
+      model_(model),
+      state_(state) {
+  DRAKE_DEMAND(model != nullptr);
+  DRAKE_DEMAND(state != nullptr);
+  model_->CalcTangentMatrixBlockDiagonal(*state_, &block_diagonal_);
+  block_diagonal_inverse_.resize(block_diagonal_.size());
+  for (int n = 0; n < ssize(block_diagonal_); ++n) {
+    block_diagonal_inverse_[n] = block_diagonal_[n].inverse();
+  }
+}
+
+template <typename T>
+TangentMatrixOperator<T>::~TangentMatrixOperator() = default;
+
+template <typename T>
+void TangentMatrixOperator<T>::ApplyBlockJacobiPreconditioner(
+    const Eigen::Ref<const VectorX<T>>& r, EigenPtr<VectorX<T>> z) const {
+  DRAKE_DEMAND(z != nullptr);
+  DRAKE_DEMAND(r.size() == rows());
+  DRAKE_DEMAND(z->size() == rows());
+  for (int n = 0; n < ssize(block_diagonal_inverse_); ++n) {
+    z->template segment<3>(3 * n) =
+        block_diagonal_inverse_[n] * r.template segment<3>(3 * n);
+  }
+}
+
+template <typename T>
+void TangentMatrixOperator<T>::DoMultiply(const Eigen::Ref<const VectorX<T>>& x,
+                                          VectorX<T>* y) const {
+  model_->CalcTangentMatrixTimesVector(*state_, x, y);
+}
+
+template <typename T>
+void TangentMatrixOperator<T>::DoMultiply(
+    const Eigen::Ref<const Eigen::SparseVector<T>>& x,
+    Eigen::SparseVector<T>* y) const {
+  const VectorX<T> x_dense = x;
+  VectorX<T> y_dense(rows());
+  model_->CalcTangentMatrixTimesVector(*state_, x_dense, &y_dense);
+  *y = y_dense.sparseView();
+}
+
+template <typename T>
+int SolveWithConjugateGradient(const TangentMatrixOperator<T>& A,
+                               const Eigen::Ref<const VectorX<T>>& b,
+                               double tolerance, int max_iterations,
+                               VectorX<T>* x) {
+  DRAKE_DEMAND(x != nullptr);
+  DRAKE_DEMAND(b.size() == A.rows());
+  const int n = A.rows();
+  x->setZero(n);
+  /* Residual r = b - A⋅x, preconditioned residual z = P⋅r and search
+   direction p. */
+  VectorX<T> r = b;
+  VectorX<T> z(n);
+  A.ApplyBlockJacobiPreconditioner(r, &z);
+  VectorX<T> p = z;
+  VectorX<T> Ap(n);
+  T r_dot_z = r.dot(z);
+  const T threshold = tolerance * b.norm();
+  int iter = 0;
+  while (r.norm() > threshold) {
+    if (iter == max_iterations) {
+      return -1;
+    }
+    A.Multiply(p, &Ap);
+    const T p_dot_Ap = p.dot(Ap);
+    /* A positive definite A has p⋅A⋅p > 0 for every nonzero search direction,
+     so anything else (including NaN) means the iteration has broken down. */
+    if (!(p_dot_Ap > 0)) {
+      return -1;
+    }
+    const T alpha = r_dot_z / p_dot_Ap;
+    *x += alpha * p;
+    r -= alpha * Ap;
+    A.ApplyBlockJacobiPreconditioner(r, &z);
+    const T next_r_dot_z = r.dot(z);
+    p = z + (next_r_dot_z / r_dot_z) * p;
+    r_dot_z = next_r_dot_z;
+    ++iter;
+  }
+  return iter;
+}
+
+template int SolveWithConjugateGradient<double>(
+    const TangentMatrixOperator<double>&,
+    const Eigen::Ref<const VectorX<double>>&, double, int, VectorX<double>*);
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
+
+template class drake::multibody::fem::internal::TangentMatrixOperator<double>;
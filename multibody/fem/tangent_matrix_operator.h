@@ -0,0 +1,87 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/contact_solvers/linear_operator.h"
+#include "drake/multibody/fem/fem_model.h"
+#include "drake/multibody/fem/fem_state.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+
+/* A LinearOperator for the tangent matrix A of an FEM model evaluated at a
+ given FEM state (see FemModel::CalcTangentMatrix()) that never assembles A.
+ Products with A are computed element by element with
+ FemModel::CalcTangentMatrixTimesVector(). The 3x3 diagonal blocks of A are
+ computed at construction and their inverses serve as a block Jacobi
+ preconditioner for iterative solves with A; see SolveWithConjugateGradient().
+
+ This operator is intended to be short-lived: it keeps pointers to the model
+ and the state and reflects the tangent matrix at the value of the state at
+ construction.
+ @tparam_double_only */
+template <typename T>
+class TangentMatrixOperator final
+    : public contact_solvers::internal::LinearOperator<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TangentMatrixOperator);
+
+  /* Constructs the tangent matrix operator of `model` evaluated at `state`.
+   @pre model != nullptr and state != nullptr.
+   @pre The model and the state outlive this operator.
+   @throws std::exception if `state` is incompatible with `model`. */
+  TangentMatrixOperator(const FemModel<T>* model, const FemState<T>* state);
+
+  ~TangentMatrixOperator() final;
+
+  int rows() const final { return model_->num_dofs(); }
+  int cols() const final { return model_->num_dofs(); }
+
+  /* Returns the 3x3 diagonal blocks of the tangent matrix, one per node. */
+  const std::vector<Matrix3<T>>& block_diagonal() const {
+    return block_diagonal_;
+  }
+
+  /* Computes z = P⋅r where P is the block Jacobi preconditioner, i.e. the
+   inverse of the block diagonal of the tangent matrix.
+   @pre z != nullptr and r and z have size rows(). */
+  void ApplyBlockJacobiPreconditioner(const Eigen::Ref<const VectorX<T>>& r,
+                                      EigenPtr<VectorX<T>> z) const;
+
+ private:
+  void DoMultiply(const Eigen::Ref<const VectorX<T>>& x,
+                  VectorX<T>* y) const final;
+
+  void DoMultiply(const Eigen::Ref<const Eigen::SparseVector<T>>& x,
+                  Eigen::SparseVector<T>* y) const final;
+
+  const FemModel<T>* model_{nullptr};
+  const FemState<T>* state_{nullptr};
+  std::vector<Matrix3<T>> block_diagonal_;
+  std::vector<Matrix3<T>> block_diagonal_inverse_;
+};
+
+/* Solves A⋅x = b for the symmetric positive definite tangent matrix A with the
+ conjugate gradient method preconditioned with the block Jacobi preconditioner
+ of A. Starting from x = 0, iterates until ‖A⋅x − b‖ ≤ tolerance⋅‖b‖.
+ @returns the number of iterations performed, or -1 if the tolerance isn't met
+          within `max_iterations` iterations or the iteration breaks down
+          because A isn't positive definite. On failure, `x` holds the last
+          iterate.
+ @pre x != nullptr.
+ @pre b has size A.rows(). */
+template <typename T>
+int SolveWithConjugateGradient(const TangentMatrixOperator<T>& A,
+                               const Eigen::Ref<const VectorX<T>>& b,
+                               double tolerance, int max_iterations,
+                               VectorX<T>* x);
+
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
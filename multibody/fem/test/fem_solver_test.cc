@@ -148,6 +148,55 @@ TYPED_TEST_P(FemSolverTest, AdvanceOneTimeStep) {
                               kTolerance, MatrixCompareType::relative));
 }
 
+/* Tests that solving the Newton iterations matrix-free gives the same result as
+ solving them with the assembled tangent matrix. */
+TYPED_TEST_P(FemSolverTest, MatrixFree) {
+  constexpr bool is_linear = TypeParam::value;
+  typename DummyModel<is_linear>::DummyBuilder builder(&this->model_);
+  builder.AddTwoElementsWithSharedNodes();
+  builder.AddElementWithDistinctNodes();
+  builder.Build();
+  std::unique_ptr<FemState<double>> state0 = this->model_.MakeFemState();
+  const std::unordered_set<int> nonparticipating_vertices = {0, 1};
+  const systems::LeafContext<double> dummy_context;
+  const FemPlantData<double> dummy_data{dummy_context, {}};
+
+  EXPECT_EQ(this->solver_.matrix_free_element_threshold(),
+            std::numeric_limits<int>::max());
+  FemSolver<double> matrix_free_solver(&this->model_, &this->integrator_);
+  matrix_free_solver.set_matrix_free_element_threshold(0);
+  EXPECT_EQ(matrix_free_solver.matrix_free_element_threshold(), 0);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      matrix_free_solver.set_matrix_free_element_threshold(-1),
+      ".*num_elements >= 0.*");
+  /* A tight linear solver tolerance makes the two solvers agree closely. The
+   matrix-free solver reports a failure if conjugate gradient can't attain the
+   tolerance, so it can't be tighter than round-off allows. */
+  constexpr double kLinearSolverTolerance = 1e-10;
+  for (FemSolver<double>* solver : {&this->solver_, &matrix_free_solver}) {
+    solver->set_max_linear_solver_tolerance(kLinearSolverTolerance);
+    EXPECT_EQ(
+        solver->AdvanceOneTimeStep(*state0, dummy_data,
+                                   nonparticipating_vertices),
+        1);
+  }
+  const FemState<double>& expected_state = this->solver_.next_fem_state();
+  const FemState<double>& computed_state = matrix_free_solver.next_fem_state();
+  EXPECT_TRUE(CompareMatrices(expected_state.GetPositions(),
+                              computed_state.GetPositions(), kTolerance));
+  EXPECT_TRUE(CompareMatrices(expected_state.GetVelocities(),
+                              computed_state.GetVelocities(), kTolerance));
+  /* The accelerations are the unknowns of the linear solves, so they only agree
+   to about the linear solver tolerance. */
+  EXPECT_TRUE(CompareMatrices(expected_state.GetAccelerations(),
+                              computed_state.GetAccelerations(),
+                              kLinearSolverTolerance));
+  EXPECT_TRUE(CompareMatrices(
+      this->solver_.next_schur_complement().get_D_complement(),
+      matrix_free_solver.next_schur_complement().get_D_complement(),
+      kTolerance, MatrixCompareType::relative));
+}
+
 /* Tests that AdvanceOneTimeStep for nonlinear models throws an error message if
  the Newton solver doesn't converge within the max number of iterations. */
 TYPED_TEST_P(FemSolverTest, Nonconvergence) {
@@ -243,8 +292,8 @@ TYPED_TEST_P(FemSolverTest, SetNextFemState) {
 
 using AllTypes = ::testing::Types<BoolWrapper<true>, BoolWrapper<false>>;
 REGISTER_TYPED_TEST_SUITE_P(FemSolverTest, Tolerance, AdvanceOneTimeStep,
-                            Nonconvergence, DefaultStateAndSchurComplement,
-                            SetNextFemState);
+                            MatrixFree, Nonconvergence,
+                            DefaultStateAndSchurComplement, SetNextFemState);
 INSTANTIATE_TYPED_TEST_SUITE_P(LinearAndNonLinear, FemSolverTest, AllTypes);
 
 }  // namespace
@@ -0,0 +1,124 @@
+#include "drake/multibody/fem/tangent_matrix_operator.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/fem/acceleration_newmark_scheme.h"
+#include "drake/multibody/fem/test/dummy_model.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+constexpr double kTolerance = 1e-12;
+
+class TangentMatrixOperatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    DummyModel<false>::DummyBuilder builder(&model_);
+    builder.AddTwoElementsWithSharedNodes();
+    builder.AddElementWithDistinctNodes();
+    builder.Build();
+    state_ = model_.MakeFemState();
+  }
+
+  /* Constrains a node shared by two elements so that the boundary condition
+   affects off-diagonal blocks. */
+  void AddBoundaryCondition() {
+    DirichletBoundaryCondition<double> bc;
+    bc.AddBoundaryCondition(FemNodeIndex(2),
+                            {Vector3d(1, 1, 1), Vector3d(2, 2, 2),
+                             Vector3d(3, 3, 3)});
+    model_.SetDirichletBoundaryCondition(bc);
+  }
+
+  MatrixXd CalcDenseTangentMatrix() const {
+    auto tangent_matrix = model_.MakeTangentMatrix();
+    model_.CalcTangentMatrix(*state_, tangent_matrix.get());
+    return tangent_matrix->MakeDenseMatrix();
+  }
+
+  /* Verifies that the operator agrees with the assembled tangent matrix. */
+  void VerifyAgainstAssembledMatrix() const {
+    const MatrixXd A = CalcDenseTangentMatrix();
+    const TangentMatrixOperator<double> A_operator(&model_, state_.get());
+    ASSERT_EQ(A_operator.rows(), A.rows());
+    ASSERT_EQ(A_operator.cols(), A.cols());
+
+    const VectorXd x = VectorXd::LinSpaced(A.cols(), -1.0, 2.0);
+    VectorXd y(A.rows());
+    A_operator.Multiply(x, &y);
+    EXPECT_TRUE(CompareMatrices(y, A * x, kTolerance,
+                                MatrixCompareType::relative));
+
+    const std::vector<Eigen::Matrix3d>& block_diagonal =
+        A_operator.block_diagonal();
+    ASSERT_EQ(ssize(block_diagonal), model_.num_nodes());
+    for (int n = 0; n < model_.num_nodes(); ++n) {
+      EXPECT_TRUE(CompareMatrices(block_diagonal[n],
+                                  A.block<3, 3>(3 * n, 3 * n), kTolerance,
+                                  MatrixCompareType::relative));
+    }
+  }
+
+  AccelerationNewmarkScheme<double> integrator_{0.01, 0.5, 0.25};
+  DummyModel<false> model_{integrator_.GetWeights()};
+  std::unique_ptr<FemState<double>> state_;
+};
+
+TEST_F(TangentMatrixOperatorTest, MatchesAssembledMatrix) {
+  VerifyAgainstAssembledMatrix();
+}
+
+TEST_F(TangentMatrixOperatorTest, MatchesAssembledMatrixWithBoundaryCondition) {
+  AddBoundaryCondition();
+  VerifyAgainstAssembledMatrix();
+}
+
+TEST_F(TangentMatrixOperatorTest, ConjugateGradient) {
+  AddBoundaryCondition();
+  const MatrixXd A = CalcDenseTangentMatrix();
+  const TangentMatrixOperator<double> A_operator(&model_, state_.get());
+  VectorXd b = VectorXd::LinSpaced(A.rows(), 1.0, 3.0);
+  model_.dirichlet_boundary_condition().ApplyHomogeneousBoundaryCondition(&b);
+
+  VectorXd x;
+  const int iterations = SolveWithConjugateGradient<double>(
+      A_operator, b, kTolerance, 2 * A.rows(), &x);
+  EXPECT_GT(iterations, 0);
+  /* The residual is updated recursively in CG and may drift from the true
+   residual by round-off, so we allow for a slightly looser tolerance. */
+  EXPECT_LE((A * x - b).norm(), 10 * kTolerance * b.norm());
+  EXPECT_TRUE(CompareMatrices(x, A.llt().solve(b), 1e-10,
+                              MatrixCompareType::relative));
+
+  /* Running out of iterations is reported as a failure. With a zero
+   iteration budget, x is left at the initial guess x = 0. */
+  EXPECT_EQ(SolveWithConjugateGradient<double>(A_operator, b, kTolerance, 0,
+                                               &x),
+            -1);
+  EXPECT_TRUE(CompareMatrices(x, VectorXd::Zero(A.rows())));
+  EXPECT_EQ(SolveWithConjugateGradient<double>(A_operator, b, kTolerance,
+                                               iterations - 1, &x),
+            -1);
+
+  /* A zero right hand side converges immediately. */
+  EXPECT_EQ(SolveWithConjugateGradient<double>(
+                A_operator, VectorXd::Zero(A.rows()), kTolerance, 10, &x),
+            0);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
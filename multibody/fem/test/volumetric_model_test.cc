@@ -2,6 +2,7 @@
 
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -257,6 +258,52 @@ TEST_F(VolumetricModelTest, Clone) {
   EXPECT_EQ(state->num_nodes(), clone_state->num_nodes());
 }
 
+/* Tests that the element coloring is a valid coloring and that the tangent
+ matrix assembled concurrently from it is identical to the serial one. */
+TEST_F(VolumetricModelTest, ParallelTangentMatrix) {
+  using DoubleModel = VolumetricModel<DoubleElement>;
+  /* A box with 4x4x4 cells, where most nodes are shared by many elements. */
+  geometry::Box box(kBoxLength, kBoxLength, kBoxLength);
+  const geometry::VolumeMesh<double> mesh =
+      geometry::internal::MakeBoxVolumeMesh<double>(box, kBoxLength / 4);
+  DoubleModel model(double_integrator_.GetWeights());
+  const DoubleModel::ConstitutiveModel constitutive_model(kYoungsModulus,
+                                                          kPoissonRatio);
+  const DampingModel<double> damping_model(kMassDamping, kStiffnessDamping);
+  DoubleModel::VolumetricBuilder builder(&model);
+  builder.AddLinearTetrahedralElements(mesh, constitutive_model, kDensity,
+                                       damping_model);
+  builder.Build();
+
+  const std::vector<std::vector<int>>& colors = model.element_colors();
+  EXPECT_GT(ssize(colors), 1);
+  std::vector<int> num_times_colored(model.num_elements(), 0);
+  for (const std::vector<int>& elements_in_color : colors) {
+    std::vector<bool> node_used(model.num_nodes(), false);
+    for (int e : elements_in_color) {
+      ++num_times_colored[e];
+      /* The elements and nodes of the model are those of the mesh. */
+      for (int k = 0; k < 4; ++k) {
+        const int node = mesh.element(e).vertex(k);
+        EXPECT_FALSE(node_used[node]);
+        node_used[node] = true;
+      }
+    }
+  }
+  EXPECT_EQ(num_times_colored, std::vector<int>(model.num_elements(), 1));
+
+  unique_ptr<FemState<double>> state = MakeDeformedFemState(model);
+  auto serial_tangent_matrix = model.MakeTangentMatrix();
+  model.CalcTangentMatrix(*state, serial_tangent_matrix.get());
+  model.set_parallelism(Parallelism(2));
+  /* A fresh state so that the element data is also recomputed in parallel. */
+  unique_ptr<FemState<double>> parallel_state = MakeDeformedFemState(model);
+  auto parallel_tangent_matrix = model.MakeTangentMatrix();
+  model.CalcTangentMatrix(*parallel_state, parallel_tangent_matrix.get());
+  EXPECT_EQ(parallel_tangent_matrix->MakeDenseMatrix(),
+            serial_tangent_matrix->MakeDenseMatrix());
+}
+
 /* Tests the get_total_mass() function for VolumetricModel. */
 TEST_F(VolumetricModelTest, TotalMass) {
   using DoubleModel = VolumetricModel<DoubleElement>;
@@ -0,0 +1,121 @@
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/multibody/mpm/particle_data.h"
+#include "drake/multibody/mpm/sparse_grid.h"
+#include "drake/multibody/mpm/transfer.h"
+#include "drake/tools/performance/fixture_common.h"
+
+// These benchmarks measure how the MPM transfers between particles and grid
+// scale with the number of particles and the number of threads.
+
+namespace drake {
+namespace multibody {
+namespace mpm {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+
+constexpr double kDx = 0.01;
+constexpr double kDt = 1e-4;
+
+class MpmTransferBenchmark : public benchmark::Fixture {
+ public:
+  MpmTransferBenchmark() { tools::performance::AddMinMaxStatistics(this); }
+
+  // Samples a cube of particles with state.range(0) particles per side, two
+  // particles per grid cell along each axis, and reads the number of threads
+  // from state.range(1).
+  void SetUp(const benchmark::State& state) override {
+    const int n = state.range(0);
+    std::vector<Vector3d> x;
+    x.reserve(n * n * n);
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        for (int k = 0; k < n; ++k) {
+          x.emplace_back(Vector3d(i, j, k) * 0.5 * kDx);
+        }
+      }
+    }
+    particles_ = ParticleData<double>();
+    const double volume = n * n * n * 0.125 * kDx * kDx * kDx;
+    particles_.AddParticles(x, volume, fem::DeformableBodyConfig<double>());
+    grid_ = std::make_unique<SparseGrid<double>>(kDx);
+    grid_->Allocate(particles_.x());
+    parallelism_ = Parallelism(static_cast<int>(state.range(1)));
+  }
+
+  void TearDown(const benchmark::State&) override { grid_.reset(); }
+
+ protected:
+  void RecordParticleCount(benchmark::State* state) const {
+    state->counters["particles"] = particles_.num_particles();
+    state->SetItemsProcessed(state->iterations() * particles_.num_particles());
+  }
+
+  ParticleData<double> particles_;
+  std::unique_ptr<SparseGrid<double>> grid_;
+  Transfer<SparseGrid<double>> transfer_{kDt, kDx};
+  Parallelism parallelism_;
+};
+
+// Sorts the particles into the grid and transfers them to the grid, as done
+// at the beginning of every MPM time step.
+BENCHMARK_DEFINE_F(MpmTransferBenchmark, ParticleToGrid)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    grid_->Allocate(particles_.x());
+    transfer_.ParticleToGrid(particles_, grid_.get(), parallelism_);
+  }
+  RecordParticleCount(&state);
+}
+
+BENCHMARK_DEFINE_F(MpmTransferBenchmark, GridToParticle)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  transfer_.ParticleToGrid(particles_, grid_.get(), parallelism_);
+  for (auto _ : state) {
+    transfer_.GridToParticle(*grid_, &particles_, parallelism_);
+  }
+  RecordParticleCount(&state);
+}
+
+BENCHMARK_DEFINE_F(MpmTransferBenchmark, IterateGrid)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  transfer_.ParticleToGrid(particles_, grid_.get(), parallelism_);
+  const Vector3d dv(0.0, 0.0, -9.81 * kDt);
+  for (auto _ : state) {
+    grid_->IterateGrid(
+        [&dv](GridData<double>* node) {
+          if (node->m > 0.0) node->v += dv;
+        },
+        parallelism_);
+  }
+  RecordParticleCount(&state);
+}
+
+// Sweeps particle counts from 1000 to about a quarter million and thread
+// counts from 1 to 8.
+void ParticleAndThreadSweep(benchmark::Benchmark* b) {
+  b->ArgsProduct({{10, 20, 40, 64}, {1, 2, 4, 8}})
+      ->Unit(benchmark::kMillisecond)
+      ->UseRealTime();
+}
+
+BENCHMARK_REGISTER_F(MpmTransferBenchmark, ParticleToGrid)
+    ->Apply(ParticleAndThreadSweep);
+BENCHMARK_REGISTER_F(MpmTransferBenchmark, GridToParticle)
+    ->Apply(ParticleAndThreadSweep);
+BENCHMARK_REGISTER_F(MpmTransferBenchmark, IterateGrid)
+    ->Apply(ParticleAndThreadSweep);
+
+}  // namespace
+}  // namespace internal
+}  // namespace mpm
+}  // namespace multibody
+}  // namespace drake
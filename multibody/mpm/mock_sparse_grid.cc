@@ -129,7 +129,7 @@ MassAndMomentum<T> MockSparseGrid<T>::ComputeTotalMassAndMomentum() const {
 
 template <typename T>
 void MockSparseGrid<T>::IterateGrid(
-    const std::function<void(GridData<T>*)>& func) {
+    const std::function<void(GridData<T>*)>& func, Parallelism) {
   for (auto& [_, data] : grid_data_) {
     func(&data);
   }
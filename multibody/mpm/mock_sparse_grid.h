@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/math/partial_permutation.h"
 #include "drake/multibody/mpm/grid_data.h"
 #include "drake/multibody/mpm/mass_and_momentum.h"
@@ -79,11 +80,14 @@ class MockSparseGrid {
 
   int num_blocks() const { return spgrid_.num_blocks(); }
 
+  /* The mock grid is not thread safe, so the kernels are always applied
+   serially and `parallelism` is ignored. */
   void ApplyGridToParticleKernel(
       ParticleData<T>* particle_data,
       const std::function<void(int, const Pad<Vector3<double>>&,
                                const Pad<GridData<T>>&, ParticleData<T>*)>&
-          kernel) const {
+          kernel,
+      Parallelism = false) const {
     particle_sorter_.Iterate(this, particle_data, kernel);
   }
 
@@ -91,7 +95,8 @@ class MockSparseGrid {
       const ParticleData<T>& particle_data,
       const std::function<void(int, const Pad<Vector3<double>>&,
                                const ParticleData<T>&, Pad<GridData<T>>*)>&
-          kernel) {
+          kernel,
+      Parallelism = false) {
     particle_sorter_.Iterate(this, &particle_data, kernel);
   }
 
@@ -103,7 +108,8 @@ class MockSparseGrid {
     particle_sorter_.Iterate(this, &particle_data, kernel);
   }
 
-  void IterateGrid(const std::function<void(GridData<T>*)>& func);
+  void IterateGrid(const std::function<void(GridData<T>*)>& func,
+                   Parallelism = false);
 
   void IterateGrid(const std::function<void(const GridData<T>&)>& func) const;
 
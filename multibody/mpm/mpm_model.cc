@@ -11,16 +11,18 @@ namespace mpm {
 namespace internal {
 
 template <typename T, typename Grid>
-MpmModel<T, Grid>::MpmModel(T dt, double dx, ParticleData<T> particle_data)
+MpmModel<T, Grid>::MpmModel(T dt, double dx, ParticleData<T> particle_data,
+                            Parallelism parallelism)
     : dt_(dt),
       dx_(dx),
       particle_data_(std::move(particle_data)),
+      parallelism_(parallelism),
       grid_(std::make_unique<Grid>(dx)),
       transfer_(dt, dx) {
   DRAKE_DEMAND(dt > 0);
   DRAKE_DEMAND(dx > 0);
   grid_->Allocate(particle_data_.x());
-  transfer_.ParticleToGrid(particle_data_, grid_.get_mutable());
+  transfer_.ParticleToGrid(particle_data_, grid_.get_mutable(), parallelism_);
   ConvertGridMomentumToVelocity();
   index_permutation_ = grid_->SetNodeIndices();
 }
@@ -112,13 +114,13 @@ void MpmModel<T, Grid>::Update(const SolverState<T, Grid>& solver_state) {
       node->v += dv.template segment<kDim>(kDim * node->index_or_flag.index());
     }
   };
-  grid_->IterateGrid(update_grid_velocity);
-  transfer_.GridToParticle(grid(), &particle_data_);
+  grid_->IterateGrid(update_grid_velocity, parallelism_);
+  transfer_.GridToParticle(grid(), &particle_data_, parallelism_);
   particle_data_.ComputeKirchhoffStress(
       particle_data_.F(), &particle_data_.mutable_deformation_gradient_data(),
-      &particle_data_.mutable_tau_volume());
+      &particle_data_.mutable_tau_volume(), parallelism_);
   grid_->Allocate(particle_data_.x());
-  transfer_.ParticleToGrid(particle_data_, grid_.get_mutable());
+  transfer_.ParticleToGrid(particle_data_, grid_.get_mutable(), parallelism_);
   ConvertGridMomentumToVelocity();
   index_permutation_ = grid_->SetNodeIndices();
 }
@@ -130,7 +132,7 @@ void MpmModel<T, Grid>::ConvertGridMomentumToVelocity() {
       node->v /= node->m;
     }
   };
-  grid_->IterateGrid(convert_momentum_to_velocity);
+  grid_->IterateGrid(convert_momentum_to_velocity, parallelism_);
 }
 
 }  // namespace internal
@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "drake/common/copyable_unique_ptr.h"
+#include "drake/common/parallelism.h"
 #include "drake/math/partial_permutation.h"
 #include "drake/multibody/mpm/particle_data.h"
 #include "drake/multibody/mpm/sparse_grid.h"
@@ -60,8 +61,12 @@ class MpmModel {
    @param[in] dt         The time step used in this MpmModel (in seconds).
    @param[in] dx         The grid spacing (in meters).
    @param[in] particles  The particle data.
+   @param[in] parallelism  The degree of parallelism used for the transfers
+                           between particles and grid and for the grid and
+                           particle updates. The results do not depend on it.
    @pre dt > 0 and dx > 0. */
-  MpmModel(T dt, double dx, ParticleData<T> particles);
+  MpmModel(T dt, double dx, ParticleData<T> particles,
+           Parallelism parallelism = false);
 
   T dt() const { return dt_; }
 
@@ -69,6 +74,8 @@ class MpmModel {
 
   int num_particles() const { return particle_data_.num_particles(); }
 
+  Parallelism parallelism() const { return parallelism_; }
+
   /* Computes the energy at the given solver state using the formula
    E(v) = ½ (v − vⁿ)ᵀ M (v − vⁿ) + ∑ₚ Ψ(Fₚ(v; Fₚⁿ)) ⋅ volₚ. */
   T CalcCost(const SolverState<T, Grid>& solver_state) const;
@@ -99,6 +106,7 @@ class MpmModel {
   T dt_{};
   double dx_{};
   ParticleData<T> particle_data_{};
+  Parallelism parallelism_{false};
   copyable_unique_ptr<Grid> grid_{};
   Transfer<Grid> transfer_;
   math::internal::VertexPartialPermutation index_permutation_;
@@ -8,6 +8,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/mpm/bspline_weights.h"
 #include "drake/multibody/mpm/spgrid_flags.h"
@@ -218,6 +219,12 @@ class ParticleSorter {
    associated with the pad. If a const grid pointer is provided, no grid update
    is performed (but particle update might be performed by the kernel).
 
+   Blocks are processed concurrently with the given `parallelism`. When the
+   grid is mutable, blocks are processed one color at a time (see
+   colored_ranges()) so that concurrent threads never write to the same grid
+   node. The colors are visited in the same order regardless of `parallelism`,
+   so the accumulated grid data does not depend on the number of threads.
+
    @tparam Grid          MPM Grid type (e.g., SparseGrid<double> or
                          const SparseGrid<float>).
    @tparam ParticleData  ParticleData type (e.g., ParticleData<double>, or
@@ -226,21 +233,20 @@ class ParticleSorter {
                          Must be either G2PKernelType or P2GKernelType.
    @param grid_ptr           Pointer to the grid object.
    @param particle_data_ptr  Pointer to the particle data object.
-   @param func               A function to be applied to each particle.
+   @param func               A function to be applied to each particle. It
+                             must be safe to call concurrently for different
+                             particles.
+   @param parallelism        The degree of parallelism to use.
    @pre  Exactly one of the grid/particle pointer is const and the other is
    mutable. When the grid pointer is mutable, the Func signature is
    P2GKernelType; when the particle pointer is mutable, the Func signature is
    G2PKernelType. */
   template <typename Grid, typename ParticleData, typename Func>
   void Iterate(Grid* grid_ptr, ParticleData* particle_data_ptr,
-               const Func& func) const {
+               const Func& func, Parallelism parallelism = false) const {
     const int num_blocks = grid_ptr->num_blocks();
     DRAKE_DEMAND(ssize(sentinel_particles_) == num_blocks + 1);
 
-    /* Deduce types for pad nodes and pad data. */
-    using PadNodeType = typename Grid::PadNodeType;
-    using PadDataType = typename Grid::PadDataType;
-
     constexpr bool const_grid = std::is_const_v<Grid>;
     constexpr bool const_particle = std::is_const_v<ParticleData>;
 
@@ -263,6 +269,49 @@ class ParticleSorter {
           "signature for traverse operations.");
     }
 
+    [[maybe_unused]] const int num_threads = parallelism.num_threads();
+    if constexpr (is_p2g) {
+      /* Particles in ranges of the same color write to disjoint pads. */
+      for (int color = 0; color < 8; ++color) {
+        const RangeVector& ranges = colored_ranges_[color];
+        const int num_ranges = ssize(ranges);
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads)
+#endif
+        for (int r = 0; r < num_ranges; ++r) {
+          IterateRange(grid_ptr, particle_data_ptr, func, ranges[r].start(),
+                       ranges[r].end());
+        }
+      }
+    } else {
+      /* The grid is read-only and each particle is only modified by the
+       kernel invoked with its index, so all blocks are independent. */
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads)
+#endif
+      for (int b = 0; b < num_blocks; ++b) {
+        IterateRange(grid_ptr, particle_data_ptr, func, sentinel_particles_[b],
+                     sentinel_particles_[b + 1]);
+      }
+    }
+  }
+
+ private:
+  /* Helper for Iterate() that processes the sorted particles in
+   [particle_start, particle_end), all of which belong to the same block. */
+  template <typename Grid, typename ParticleData, typename Func>
+  void IterateRange(Grid* grid_ptr, ParticleData* particle_data_ptr,
+                    const Func& func, int particle_start,
+                    int particle_end) const {
+    /* Deduce types for pad nodes and pad data. */
+    using PadNodeType = typename Grid::PadNodeType;
+    using PadDataType = typename Grid::PadDataType;
+
+    constexpr bool is_g2p =
+        std::is_const_v<Grid> && !std::is_const_v<ParticleData>;
+    constexpr bool is_p2g =
+        !std::is_const_v<Grid> && std::is_const_v<ParticleData>;
+
     /* Temporary variables for pad nodes and pad data. */
     PadNodeType grid_nodes{};
     PadDataType grid_data{};
@@ -270,48 +319,38 @@ class ParticleSorter {
     /* Flag indicating when to fetch new pad data. */
     bool need_new_pad = true;
 
-    /* Iterate over each block. */
-    for (int b = 0; b < num_blocks; ++b) {
-      const int particle_start = sentinel_particles_[b];
-      const int particle_end = sentinel_particles_[b + 1];
-
-      /* Process each particle within the current block. */
-      for (int p = particle_start; p < particle_end; ++p) {
-        const int data_index = data_indices_[p];
+    for (int p = particle_start; p < particle_end; ++p) {
+      const int data_index = data_indices_[p];
 
-        /* Fetch new pad data and nodes when we meet particles belonging to a
-         new pad. */
-        if (need_new_pad) {
-          grid_data = grid_ptr->GetPadData(base_node_offsets_[p]);
-          grid_nodes =
-              grid_ptr->GetPadNodes(particle_data_ptr->x()[data_index]);
-        }
+      /* Fetch new pad data and nodes when we meet particles belonging to a
+       new pad. */
+      if (need_new_pad) {
+        grid_data = grid_ptr->GetPadData(base_node_offsets_[p]);
+        grid_nodes = grid_ptr->GetPadNodes(particle_data_ptr->x()[data_index]);
+      }
 
-        /* Apply the provided function to the current particle. */
-        if constexpr (is_g2p) {
-          func(data_index, grid_nodes, grid_data, particle_data_ptr);
-        } else if constexpr (is_p2g) {
-          func(data_index, grid_nodes, *particle_data_ptr, &grid_data);
-        } else {
-          static_assert(is_traverse);
-          func(data_index, grid_nodes, grid_data, *particle_data_ptr);
-        }
+      /* Apply the provided function to the current particle. */
+      if constexpr (is_g2p) {
+        func(data_index, grid_nodes, grid_data, particle_data_ptr);
+      } else if constexpr (is_p2g) {
+        func(data_index, grid_nodes, *particle_data_ptr, &grid_data);
+      } else {
+        func(data_index, grid_nodes, grid_data, *particle_data_ptr);
+      }
 
-        /* Determine if the next particle requires new pad data. */
-        need_new_pad = (p + 1 == particle_end) ||
-                       (base_node_offsets_[p] != base_node_offsets_[p + 1]);
+      /* Determine if the next particle requires new pad data. */
+      need_new_pad = (p + 1 == particle_end) ||
+                     (base_node_offsets_[p] != base_node_offsets_[p + 1]);
 
-        /* Write to the pad if this is a P2G operation. */
-        if constexpr (is_p2g) {
-          if (need_new_pad) {
-            grid_ptr->SetPadData(base_node_offsets_[p], grid_data);
-          }
+      /* Write to the pad if this is a P2G operation. */
+      if constexpr (is_p2g) {
+        if (need_new_pad) {
+          grid_ptr->SetPadData(base_node_offsets_[p], grid_data);
         }
       }
     }
   }
 
- private:
   /* Helper for Sort(). Resizes all containers and clear old data. */
   void Initialize(int num_particles);
 
@@ -141,15 +141,19 @@ class SparseGrid {
                                  kernel. As output, this provides the particle
                                  data to be modified by the kernel. This data
                                  may be modified by the kernel.
-   @param[in] kernel             The grid-to-particle kernel to apply.
+   @param[in] kernel             The grid-to-particle kernel to apply. It must
+                                 be safe to invoke concurrently for different
+                                 particles.
+   @param[in] parallelism        The degree of parallelism to use.
    @pre The grid's Allocate() method must have been called with the positions
    contained in the given particle_data. */
   void ApplyGridToParticleKernel(
       ParticleData<T>* particle_data,
       const std::function<void(int, const Pad<Vector3<T>>&,
                                const Pad<GridData<T>>&, ParticleData<T>*)>&
-          kernel) const {
-    particle_sorter_.Iterate(this, particle_data, kernel);
+          kernel,
+      Parallelism parallelism = false) const {
+    particle_sorter_.Iterate(this, particle_data, kernel, parallelism);
   }
 
   /* Iterates over all particles and the grid nodes supported by them, applying
@@ -207,7 +211,11 @@ class SparseGrid {
 
    @param[in] particle_data  A const reference to the particle data to iterate
                              over.
-   @param[in] kernel         The particle-to-grid kernel to apply.
+   @param[in] kernel         The particle-to-grid kernel to apply. It must be
+                             safe to invoke concurrently for different
+                             particles.
+   @param[in] parallelism    The degree of parallelism to use. The result does
+                             not depend on it; see ParticleSorter::Iterate().
    @post The grid data corresponding to each particle's support is updated with
    any modifications performed by the kernel.
    @pre The grid's Allocate() method must have been called with the
@@ -216,14 +224,17 @@ class SparseGrid {
       const ParticleData<T>& particle_data,
       const std::function<void(int, const Pad<Vector3<T>>&,
                                const ParticleData<T>&, Pad<GridData<T>>*)>&
-          kernel) {
-    particle_sorter_.Iterate(this, &particle_data, kernel);
+          kernel,
+      Parallelism parallelism = false) {
+    particle_sorter_.Iterate(this, &particle_data, kernel, parallelism);
   }
 
   /* Iterates over all grid nodes in the grid and applies the given function
-   `func` to each grid node. */
-  void IterateGrid(const std::function<void(GridData<T>*)>& func) {
-    spgrid_.IterateGrid(func);
+   `func` to each grid node, concurrently with the given `parallelism`. `func`
+   must only modify the grid node it is given. */
+  void IterateGrid(const std::function<void(GridData<T>*)>& func,
+                   Parallelism parallelism = false) {
+    spgrid_.IterateGrid(func, parallelism);
   }
 
   /* Iterates over all grid nodes in the grid and applies the given function
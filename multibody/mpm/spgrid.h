@@ -14,6 +14,7 @@
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/mpm/spgrid_flags.h"
 
 namespace drake {
@@ -242,14 +243,24 @@ class SpGrid {
     }
   }
 
-  // TODO(xuchenhan-tri): Add a parallel version of IterateGrid.
   /* Iterates over all grid nodes in the grid and applies the given function
-   `func` to each grid node. */
-  void IterateGrid(const std::function<void(GridData*)>& func) {
+   `func` to each grid node. Blocks of grid nodes are processed concurrently
+   with the given `parallelism`, and therefore `func` must only modify the
+   grid node it is given. */
+  void IterateGrid(const std::function<void(GridData*)>& func,
+                   Parallelism parallelism = false) {
     const uint64_t data_size = 1 << kDataBits;
     Array grid_data = allocator_.Get_Array();
-    auto [block_offsets, num_blocks] = blocks_.Get_Blocks();
-    for (int b = 0; b < static_cast<int>(num_blocks); ++b) {
+    /* N.B. We avoid structured bindings, which can't be shared in OpenMP
+     parallel regions with some compilers. */
+    const std::pair<const uint64_t*, unsigned> blocks = blocks_.Get_Blocks();
+    const uint64_t* block_offsets = blocks.first;
+    const int num_blocks = static_cast<int>(blocks.second);
+    [[maybe_unused]] const int num_threads = parallelism.num_threads();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads)
+#endif
+    for (int b = 0; b < num_blocks; ++b) {
       const uint64_t block_offset = block_offsets[b];
       uint64_t node_offset = block_offset;
       /* The coordinate of the origin of this block. */
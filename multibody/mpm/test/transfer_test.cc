@@ -210,6 +210,58 @@ GTEST_TEST(TransferTest, MomentumConservation) {
                             expected);
 }
 
+/* Verifies that P2G and G2P performed in parallel produce exactly the same
+ results as the serial transfers, with many particles spread over many blocks
+ so that concurrent threads would collide if the transfers were not properly
+ partitioned. */
+GTEST_TEST(TransferTest, ParallelTransferMatchesSerial) {
+  const double dx = 0.05;
+  ParticleData<double> particle_data;
+  for (int i = 0; i < 20; ++i) {
+    for (int j = 0; j < 20; ++j) {
+      for (int k = 0; k < 20; ++k) {
+        /* Jitter the positions so that particles land at different offsets
+         within their cells. */
+        const Vector3d x(0.031 * i + 0.001 * (j % 3), 0.029 * j - 0.2,
+                         0.033 * k + 0.002 * (i % 5));
+        AddParticle(&particle_data, x);
+      }
+    }
+  }
+
+  const double dt = 0.01;
+  Transfer transfer(dt, dx);
+  SparseGrid<double> serial_grid(dx);
+  SparseGrid<double> parallel_grid(dx);
+  serial_grid.Allocate(particle_data.x());
+  parallel_grid.Allocate(particle_data.x());
+  ASSERT_GT(serial_grid.num_blocks(), 8);
+  transfer.ParticleToGrid(particle_data, &serial_grid);
+  transfer.ParticleToGrid(particle_data, &parallel_grid, Parallelism(2));
+  ConvertMomentumToVelocity(&serial_grid);
+  ConvertMomentumToVelocity(&parallel_grid);
+
+  const std::vector<std::pair<Vector3<int>, GridData<double>>> serial_data =
+      serial_grid.GetGridData();
+  const std::vector<std::pair<Vector3<int>, GridData<double>>> parallel_data =
+      parallel_grid.GetGridData();
+  ASSERT_EQ(serial_data.size(), parallel_data.size());
+  for (int i = 0; i < ssize(serial_data); ++i) {
+    EXPECT_EQ(serial_data[i].first, parallel_data[i].first);
+    EXPECT_EQ(serial_data[i].second.m, parallel_data[i].second.m);
+    EXPECT_EQ(serial_data[i].second.v, parallel_data[i].second.v);
+  }
+
+  ParticleData<double> serial_particles = particle_data;
+  ParticleData<double> parallel_particles = particle_data;
+  transfer.GridToParticle(serial_grid, &serial_particles);
+  transfer.GridToParticle(parallel_grid, &parallel_particles, Parallelism(2));
+  EXPECT_EQ(serial_particles.x(), parallel_particles.x());
+  EXPECT_EQ(serial_particles.v(), parallel_particles.v());
+  EXPECT_EQ(serial_particles.C(), parallel_particles.C());
+  EXPECT_EQ(serial_particles.F(), parallel_particles.F());
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace mpm
@@ -18,7 +18,7 @@ Transfer<Grid>::Transfer(T dt, double dx) : dt_(dt), dx_(dx) {
 
 template <typename Grid>
 void Transfer<Grid>::ParticleToGrid(const ParticleData<T>& particle,
-                                    Grid* grid) {
+                                    Grid* grid, Parallelism parallelism) {
   /* U == T when Grid == SparseGrid<T>.
      U == double when Grid == MockSparseGrid<T>. */
   using U = typename Grid::NodeScalarType;
@@ -80,12 +80,13 @@ void Transfer<Grid>::ParticleToGrid(const ParticleData<T>& particle,
       }
     }
   };
-  grid->ApplyParticleToGridKernel(particle, p2g_kernel);
+  grid->ApplyParticleToGridKernel(particle, p2g_kernel, parallelism);
 }
 
 template <typename Grid>
 void Transfer<Grid>::GridToParticle(const Grid& grid,
-                                    ParticleData<T>* particle) {
+                                    ParticleData<T>* particle,
+                                    Parallelism parallelism) {
   /* U == T when Grid == SparseGrid<T>.
      U == double when Grid == MockSparseGrid<T>. */
   using U = typename Grid::NodeScalarType;
@@ -120,7 +121,7 @@ void Transfer<Grid>::GridToParticle(const Grid& grid,
     C *= D_inverse_;
     F += C * dt_ * F;
   };
-  grid.ApplyGridToParticleKernel(particle, g2p_kernel);
+  grid.ApplyGridToParticleKernel(particle, g2p_kernel, parallelism);
 }
 
 }  // namespace internal
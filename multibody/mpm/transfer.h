@@ -1,5 +1,6 @@
 #pragma once
 
+#include "drake/common/parallelism.h"
 #include "drake/multibody/mpm/particle_data.h"
 #include "drake/multibody/mpm/sparse_grid.h"
 
@@ -46,14 +47,19 @@ class Transfer {
    process, also mark the grid nodes that are in support of any particle that is
    participating in a constraint with the "participating" flag.
    @note The `v` attribute of the grid data at the end of the operation stores
-   the momentum, not velocity, of the grid node. */
-  void ParticleToGrid(const ParticleData<T>& particle, Grid* grid);
+   the momentum, not velocity, of the grid node.
+   The transfer is performed concurrently with the given `parallelism`; the
+   result does not depend on the number of threads used. */
+  void ParticleToGrid(const ParticleData<T>& particle, Grid* grid,
+                      Parallelism parallelism = false);
 
   /* Grid to particle transfer (G2P). After the call to G2P, the particles store
    the mass and momentum transfered from the grid using APIC.
    @pre the grid stores mass and velocity (not momentum). Hence, the velocity
-   from the grid needs to be processed after P2G and before G2P. */
-  void GridToParticle(const Grid& grid, ParticleData<T>* particle);
+   from the grid needs to be processed after P2G and before G2P.
+   The transfer is performed concurrently with the given `parallelism`. */
+  void GridToParticle(const Grid& grid, ParticleData<T>* particle,
+                      Parallelism parallelism = false);
 
   T D_inverse() const { return D_inverse_; }
 
@@ -1,6 +1,7 @@
 #include "drake/multibody/plant/deformable_driver.h"
 
 #include <array>
+#include <exception>
 #include <limits>
 #include <map>
 #include <memory>
@@ -19,6 +20,7 @@
 #include "drake/multibody/plant/discrete_update_manager.h"
 #include "drake/multibody/plant/hydroelastic_quadrature_point_data.h"
 #include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/force_density_field.h"
 #include "drake/systems/framework/context.h"
 
 using drake::geometry::GeometryId;
@@ -199,6 +201,7 @@ template <typename T>
 void DeformableDriver<T>::AppendLinearDynamicsMatrix(
     const systems::Context<T>& context, std::vector<MatrixX<T>>* A) const {
   DRAKE_DEMAND(A != nullptr);
+  EvalFreeMotionFemSolvers(context);
   const int num_bodies = deformable_model_->num_bodies();
   for (DeformableBodyIndex index(0); index < num_bodies; ++index) {
     const DeformableBodyId body_id = deformable_model_->GetBodyId(index);
@@ -840,6 +843,7 @@ template <typename T>
 void DeformableDriver<T>::CalcDiscreteStates(
     const systems::Context<T>& context,
     systems::DiscreteValues<T>* next_states) const {
+  EvalFreeMotionFemSolvers(context);
   const int num_bodies = deformable_model_->num_bodies();
   for (DeformableBodyIndex index(0); index < num_bodies; ++index) {
     const FemState<T>& next_fem_state = EvalNextFemState(context, index);
@@ -960,6 +964,84 @@ void DeformableDriver<T>::CalcFreeMotionFemSolver(
                                  nonparticipating_vertices);
 }
 
+template <typename T>
+void DeformableDriver<T>::EvalFreeMotionFemSolvers(
+    const systems::Context<T>& context) const {
+  const int num_bodies = deformable_model_->num_bodies();
+  /* Each FemModel parallelizes its own element computations. Solving bodies
+   concurrently disables that nested parallelism, so we only do it when there
+   are enough bodies to keep all threads busy. Moreover, external force fields
+   other than gravity may evaluate their own cache entries and input ports in
+   the shared `context` (or be implemented in Python), which can't be done
+   from several threads at once, so we only solve bodies concurrently when
+   gravity is the only external force. */
+  const int num_threads = deformable_model_->parallelism().num_threads();
+  bool only_gravity = true;
+  for (DeformableBodyIndex i(0); i < num_bodies && only_gravity; ++i) {
+    for (const ForceDensityFieldBase<T>* force :
+         deformable_model_->GetExternalForces(
+             deformable_model_->GetBodyId(i))) {
+      if (dynamic_cast<const GravityForceField<T>*>(force) == nullptr) {
+        only_gravity = false;
+        break;
+      }
+    }
+  }
+  /* Only the bodies whose own solver is out of date need to be solved. */
+  std::vector<DeformableBodyIndex> stale_bodies;
+  if (num_threads > 1 && num_bodies >= num_threads && only_gravity) {
+    for (DeformableBodyIndex i(0); i < num_bodies; ++i) {
+      if (manager_->plant()
+              .get_cache_entry(cache_indexes_.fem_solvers[i])
+              .is_out_of_date(context)) {
+        stale_bodies.push_back(i);
+      }
+    }
+  }
+  const int num_stale_bodies = ssize(stale_bodies);
+  if (num_stale_bodies < num_threads) {
+    for (DeformableBodyIndex i(0); i < num_bodies; ++i) {
+      EvalFreeMotionFemSolver(context, i);
+    }
+    return;
+  }
+  /* Evaluate the cache entries shared by the bodies up front, and grab the
+   values to be computed, so that the per-body computations below only read
+   from the context. */
+  std::vector<systems::CacheEntryValue*> values(num_stale_bodies);
+  std::vector<FemSolver<T>*> fem_solvers(num_stale_bodies);
+  for (int k = 0; k < num_stale_bodies; ++k) {
+    const DeformableBodyIndex i = stale_bodies[k];
+    EvalFemState(context, i);
+    EvalVertexPermutation(context, deformable_model_->GetGeometryId(
+                                       deformable_model_->GetBodyId(i)));
+    values[k] = &manager_->plant()
+                     .get_cache_entry(cache_indexes_.fem_solvers[i])
+                     .get_mutable_cache_entry_value(context);
+    fem_solvers[k] =
+        &values[k]->template GetMutableValueOrThrow<FemSolver<T>>();
+  }
+  /* Exceptions must not escape a parallel region. Instead, we capture them
+   and re-throw the first one (in body order) once all bodies are done, so
+   that the caller sees the same exception as with serial evaluation. A body
+   that failed is left out of date. */
+  std::vector<std::exception_ptr> errors(num_stale_bodies);
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+  for (int k = 0; k < num_stale_bodies; ++k) {
+    try {
+      CalcFreeMotionFemSolver(context, stale_bodies[k], fem_solvers[k]);
+      values[k]->mark_up_to_date();
+    } catch (...) {
+      errors[k] = std::current_exception();
+    }
+  }
+  for (const std::exception_ptr& error : errors) {
+    if (error != nullptr) std::rethrow_exception(error);
+  }
+}
+
 template <typename T>
 const FemSolver<T>& DeformableDriver<T>::EvalFreeMotionFemSolver(
     const systems::Context<T>& context, DeformableBodyIndex index) const {
@@ -1192,6 +1274,7 @@ template <typename T>
 void DeformableDriver<T>::CalcParticipatingFreeMotionVelocities(
     const Context<T>& context, VectorX<T>* result) const {
   DRAKE_DEMAND(result != nullptr);
+  EvalFreeMotionFemSolvers(context);
   const int num_bodies = deformable_model_->num_bodies();
   std::vector<VectorX<T>> participating_v_star(num_bodies);
   for (DeformableBodyIndex i(0); i < num_bodies; ++i) {
@@ -288,6 +288,13 @@ class DeformableDriver : public ScalarConvertibleComponent<T> {
                                DeformableBodyIndex index,
                                fem::internal::FemSolver<T>* fem_solver) const;
 
+  /* Brings the free motion FEM solvers of all deformable bodies up to date in
+   the given `context`. Out of date bodies are solved concurrently when the
+   parallelism of the DeformableModel allows it and gravity is the only
+   external force on any body. Each body keeps its own cache entry, so bodies
+   whose solvers are up to date are not solved again. */
+  void EvalFreeMotionFemSolvers(const systems::Context<T>& context) const;
+
   /* Eval version of CalcFreeMotionFemState(). */
   const fem::internal::FemSolver<T>& EvalFreeMotionFemSolver(
       const systems::Context<T>& context, DeformableBodyIndex index) const;
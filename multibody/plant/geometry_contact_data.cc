@@ -13,6 +13,19 @@ void GeometryContactData<T>::Clear() {
 
 template <typename T>
 NestedGeometryContactData<T>& GeometryContactData<T>::Allocate() {
+  // Anyone holding a Share() of the current storage relies on it never
+  // changing, so we can only reuse it when we are its sole owner.
+  if (data_ != nullptr && data_.use_count() == 1) {
+    auto& data = const_cast<NestedGeometryContactData<T>&>(*data_);
+    data.point_pairs.clear();
+    if constexpr (requires { data.surfaces; }) {
+      data.surfaces.clear();
+    }
+    if constexpr (requires { data.deformable; }) {
+      data.deformable = {};
+    }
+    return data;
+  }
   data_ = std::make_shared<NestedGeometryContactData<T>>();
   return const_cast<NestedGeometryContactData<T>&>(*data_);
 }
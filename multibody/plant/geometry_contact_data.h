@@ -68,7 +68,10 @@ class GeometryContactData {
   /* Set this object back to its default-constructed, empty state. */
   void Clear();
 
-  /* Resets this to fresh storage and returns a mutable reference to it. */
+  /* Resets this to empty storage and returns a mutable reference to it. When
+  the current storage is not shared with anyone else (see Share()), it is
+  cleared and reused, so that its vectors keep their capacity; otherwise, fresh
+  storage is allocated. */
   NestedGeometryContactData<T>& Allocate();
 
   /* Returns a shared_ptr to the data. Note that this aliases the *current* data
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "absl/base/casts.h"
+#include <common_robotics_utilities/parallelism.hpp>
 #include <fmt/ranges.h>
 
 #include "drake/common/drake_assert.h"
@@ -51,6 +52,9 @@ namespace multibody {
 // pre-finalize.
 #define DRAKE_MBP_THROW_IF_NOT_FINALIZED() ThrowIfNotFinalized(__func__)
 
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
 using drake::geometry::CollisionFilterDeclaration;
 using drake::geometry::CollisionFilterScope;
 using drake::geometry::ContactSurface;
@@ -1691,6 +1695,202 @@ MultibodyPlant<T>::MakeActuationMatrixPseudoinverse() const {
   return Bplus;
 }
 
+template <typename T>
+void MultibodyPlant<T>::CalcInverseDynamicsDerivatives(
+    const systems::Context<T>& context, const VectorX<T>& known_vdot,
+    const MultibodyForces<T>& external_forces, EigenPtr<MatrixX<T>> dtau_dq,
+    EigenPtr<MatrixX<T>> dtau_dv, EigenPtr<MatrixX<T>> dtau_dvdot) const {
+  this->ValidateContext(context);
+  const int nv = num_velocities();
+  DRAKE_THROW_UNLESS(known_vdot.size() == nv);
+  DRAKE_THROW_UNLESS(external_forces.CheckHasRightSizeForModel(*this));
+  for (const EigenPtr<MatrixX<T>>& dtau : {dtau_dq, dtau_dv, dtau_dvdot}) {
+    DRAKE_THROW_UNLESS(dtau != nullptr);
+    DRAKE_THROW_UNLESS(dtau->rows() == nv && dtau->cols() == nv);
+  }
+  internal_tree().CalcInverseDynamicsDerivatives(
+      context, known_vdot, external_forces, dtau_dq, dtau_dv, dtau_dvdot);
+}
+
+template <typename T>
+void MultibodyPlant<T>::CalcForwardDynamicsDerivatives(
+    const systems::Context<T>& context, const MultibodyForces<T>& forces,
+    EigenPtr<VectorX<T>> vdot, EigenPtr<MatrixX<T>> dvdot_dq,
+    EigenPtr<MatrixX<T>> dvdot_dv, EigenPtr<MatrixX<T>> dvdot_dtau) const {
+  this->ValidateContext(context);
+  const int nv = num_velocities();
+  DRAKE_THROW_UNLESS(forces.CheckHasRightSizeForModel(*this));
+  DRAKE_THROW_UNLESS(vdot != nullptr && vdot->size() == nv);
+  for (const EigenPtr<MatrixX<T>>& dvdot : {dvdot_dq, dvdot_dv, dvdot_dtau}) {
+    DRAKE_THROW_UNLESS(dvdot != nullptr);
+    DRAKE_THROW_UNLESS(dvdot->rows() == nv && dvdot->cols() == nv);
+  }
+  internal_tree().CalcForwardDynamicsDerivatives(context, forces, vdot,
+                                                 dvdot_dq, dvdot_dv, dvdot_dtau);
+}
+
+namespace {
+
+// Lazily creates a clone of a plant's Context for each worker thread of the
+// batch methods. When the plant's Context is a subcontext of a Diagram's
+// Context, the whole root Context is cloned, so that in each clone the plant's
+// input ports remain connected to their (cloned) sources.
+template <typename T>
+class BatchContextPool {
+ public:
+  BatchContextPool(const MultibodyPlant<T>& plant,
+                   const Context<T>& root_context, int num_threads)
+      : plant_(plant),
+        root_context_(root_context),
+        roots_(num_threads),
+        contexts_(num_threads) {}
+
+  // Returns the plant's Context within the clone for `thread_num`, creating
+  // the clone on first use.
+  Context<T>& get(int thread_num) {
+    if (contexts_[thread_num] == nullptr) {
+      roots_[thread_num] = root_context_.Clone();
+      contexts_[thread_num] =
+          &plant_.GetMyMutableContextFromRoot(roots_[thread_num].get());
+    }
+    return *contexts_[thread_num];
+  }
+
+ private:
+  const MultibodyPlant<T>& plant_;
+  const Context<T>& root_context_;
+  std::vector<std::unique_ptr<Context<T>>> roots_;
+  std::vector<Context<T>*> contexts_;
+};
+
+}  // namespace
+
+template <typename T>
+std::vector<MatrixX<T>> MultibodyPlant<T>::CalcMassMatrixBatch(
+    const systems::Context<T>& context,
+    const Eigen::Ref<const MatrixX<T>>& q_batch,
+    Parallelism parallelize) const {
+  this->ValidateContext(context);
+  DRAKE_THROW_UNLESS(q_batch.rows() == num_positions());
+  const int num_samples = q_batch.cols();
+  const int nv = num_velocities();
+
+  // The output matrices are allocated up front so that worker threads only
+  // write into preallocated memory.
+  std::vector<MatrixX<T>> M_batch(num_samples, MatrixX<T>(nv, nv));
+
+  const int num_threads = parallelize.num_threads();
+  BatchContextPool<T> context_pool(
+      *this, static_cast<const Context<T>&>(this->GetRootContextBase(context)),
+      num_threads);
+
+  const auto calc_mass_matrix = [&](const int thread_num, const int64_t i) {
+    Context<T>& thread_context = context_pool.get(thread_num);
+    SetPositions(&thread_context, q_batch.col(i));
+    internal_tree().CalcMassMatrix(thread_context, &M_batch[i]);
+  };
+
+  StaticParallelForIndexLoop(DegreeOfParallelism(num_threads), 0, num_samples,
+                             calc_mass_matrix,
+                             ParallelForBackend::BEST_AVAILABLE);
+
+  return M_batch;
+}
+
+namespace {
+
+// Per-thread storage for CalcInverseDynamicsBatch(), allocated once per thread
+// and reused for every sample that thread processes.
+template <typename T>
+struct InverseDynamicsBatchScratch {
+  InverseDynamicsBatchScratch(int num_mobods, int nv)
+      : A_WB(num_mobods), F_BMo_W(num_mobods), vdot(nv), tau(nv) {}
+
+  std::vector<SpatialAcceleration<T>> A_WB;
+  std::vector<SpatialForce<T>> F_BMo_W;
+  VectorX<T> vdot;
+  VectorX<T> tau;
+};
+
+}  // namespace
+
+template <typename T>
+MatrixX<T> MultibodyPlant<T>::CalcInverseDynamicsBatch(
+    const systems::Context<T>& context,
+    const Eigen::Ref<const MatrixX<T>>& x_batch,
+    const Eigen::Ref<const MatrixX<T>>& vdot_batch,
+    Parallelism parallelize) const {
+  this->ValidateContext(context);
+  DRAKE_THROW_UNLESS(x_batch.rows() == num_multibody_states());
+  DRAKE_THROW_UNLESS(vdot_batch.rows() == num_velocities());
+  DRAKE_THROW_UNLESS(vdot_batch.cols() == x_batch.cols());
+  const int num_samples = x_batch.cols();
+  const int nv = num_velocities();
+  const int num_mobods = internal_tree().num_mobods();
+
+  MatrixX<T> tau_batch(nv, num_samples);
+
+  const int num_threads = parallelize.num_threads();
+  BatchContextPool<T> context_pool(
+      *this, static_cast<const Context<T>&>(this->GetRootContextBase(context)),
+      num_threads);
+  std::vector<std::unique_ptr<InverseDynamicsBatchScratch<T>>> scratch_pool(
+      num_threads);
+
+  const auto calc_inverse_dynamics = [&](const int thread_num,
+                                         const int64_t i) {
+    if (!scratch_pool[thread_num]) {
+      scratch_pool[thread_num] =
+          std::make_unique<InverseDynamicsBatchScratch<T>>(num_mobods, nv);
+    }
+    Context<T>& thread_context = context_pool.get(thread_num);
+    InverseDynamicsBatchScratch<T>& scratch = *scratch_pool[thread_num];
+    SetPositionsAndVelocities(&thread_context, x_batch.col(i));
+    scratch.vdot = vdot_batch.col(i);
+    // Empty applied forces indicate there are no applied forces.
+    internal_tree().CalcInverseDynamics(thread_context, scratch.vdot, {},
+                                        VectorX<T>(), &scratch.A_WB,
+                                        &scratch.F_BMo_W, &scratch.tau);
+    tau_batch.col(i) = scratch.tau;
+  };
+
+  StaticParallelForIndexLoop(DegreeOfParallelism(num_threads), 0, num_samples,
+                             calc_inverse_dynamics,
+                             ParallelForBackend::BEST_AVAILABLE);
+
+  return tau_batch;
+}
+
+template <typename T>
+MatrixX<T> MultibodyPlant<T>::CalcForwardDynamicsBatch(
+    const systems::Context<T>& context,
+    const Eigen::Ref<const MatrixX<T>>& x_batch,
+    Parallelism parallelize) const {
+  this->ValidateContext(context);
+  DRAKE_THROW_UNLESS(x_batch.rows() == num_multibody_states());
+  const int num_samples = x_batch.cols();
+
+  MatrixX<T> vdot_batch(num_velocities(), num_samples);
+
+  const int num_threads = parallelize.num_threads();
+  BatchContextPool<T> context_pool(
+      *this, static_cast<const Context<T>&>(this->GetRootContextBase(context)),
+      num_threads);
+
+  const auto calc_forward_dynamics = [&](const int thread_num,
+                                         const int64_t i) {
+    Context<T>& thread_context = context_pool.get(thread_num);
+    SetPositionsAndVelocities(&thread_context, x_batch.col(i));
+    vdot_batch.col(i) = this->EvalForwardDynamics(thread_context).get_vdot();
+  };
+
+  StaticParallelForIndexLoop(DegreeOfParallelism(num_threads), 0, num_samples,
+                             calc_forward_dynamics,
+                             ParallelForBackend::BEST_AVAILABLE);
+
+  return vdot_batch;
+}
+
 namespace {
 
 void ThrowForDisconnectedGeometryPort(std::string_view explanation) {
@@ -3138,22 +3338,24 @@ void MultibodyPlant<T>::CalcGeometryContactData(
     return;
   }
 
-  // Replace the result with newly-allocated (empty) storage, keeping around a
-  // mutable reference for us to fill in. After we return, the geometry contact
-  // data is forevermore immutable.
+  // Reset the result to empty storage, keeping around a mutable reference for
+  // us to fill in. After we return, the geometry contact data is forevermore
+  // immutable. Unless someone still shares the previous data, the storage is
+  // reused and the queries below write into vectors that keep their capacity
+  // from the previous evaluation.
   NestedGeometryContactData<T>& storage = result->Allocate();
 
   // Add all of the contacts to `result`.
   const auto& query_object = EvalGeometryQueryInput(context, __func__);
   switch (contact_model_) {
     case ContactModel::kPoint: {
-      storage.point_pairs = query_object.ComputePointPairPenetration();
+      query_object.ComputePointPairPenetration(&storage.point_pairs);
       break;
     }
     case ContactModel::kHydroelastic: {
       if constexpr (scalar_predicate<T>::is_bool) {
-        storage.surfaces = query_object.ComputeContactSurfaces(
-            get_contact_surface_representation());
+        query_object.ComputeContactSurfaces(
+            get_contact_surface_representation(), &storage.surfaces);
         break;
       } else {
         // TODO(SeanCurtis-TRI): Special case the QueryObject scalar support
@@ -16,6 +16,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_export.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/random.h"
 #include "drake/geometry/scene_graph.h"
 #include "drake/math/rigid_transform.h"
@@ -1414,6 +1415,27 @@ class MultibodyPlant final : public internal::MultibodyTreeSystem<T> {
   /// %MultibodyPlant is not a discrete model (is_discrete() == false).
   void SetUseSampledOutputPorts(bool use_sampled_output_ports);
 
+  /// (Advanced) Sets the degree of parallelism used to evaluate the multibody
+  /// recursions of this plant: position and velocity kinematics, composite
+  /// body inertias, inverse dynamics and the articulated body algorithm.
+  /// The model is partitioned into kinematically independent trees (e.g.,
+  /// each free body is its own tree) and each recursion is distributed over
+  /// up to `parallelism.num_threads()` threads, one tree at a time. A model
+  /// with a single tree is always evaluated serially, and so is a model with
+  /// T = symbolic::Expression. Since there is a fixed cost to dispatch work
+  /// to other threads, this is only worthwhile for models with many trees,
+  /// such as scenes with a large number of free bodies.
+  /// The default is Parallelism::None(). This can be changed at any time,
+  /// either pre- or post-finalize, and does not affect the results.
+  void set_parallelism(Parallelism parallelism) {
+    this->mutable_tree().set_parallelism(parallelism);
+  }
+
+  /// Returns the degree of parallelism set with set_parallelism().
+  Parallelism get_parallelism() const {
+    return internal_tree().parallelism();
+  }
+
   /// Creates a rigid body with the provided name and spatial inertia.  This
   /// method returns a constant reference to the body just added, which will
   /// remain valid for the lifetime of `this` %MultibodyPlant.
@@ -4355,6 +4377,98 @@ class MultibodyPlant final : public internal::MultibodyTreeSystem<T> {
                                                external_forces);
   }
 
+  /// Computes the partial derivatives of inverse dynamics with respect to the
+  /// generalized positions, velocities and accelerations, using analytic
+  /// recursive algorithms instead of automatic differentiation
+  /// [Carpentier and Mansard, 2018]. The differentiated quantity is <pre>
+  ///   tau = M(q)v̇ + C(q, v)v - tau_g(q) - tau_app - ∑ J_WBᵀ(q) Fapp_Bo_W
+  /// </pre>
+  /// That is, the generalized forces computed by CalcInverseDynamics() minus
+  /// the generalized forces due to gravity, see
+  /// CalcGravityGeneralizedForces(). Gravity is included so that the
+  /// derivatives capture its dependence on q; therefore `external_forces`
+  /// must not include the gravity forces. The applied forces in
+  /// `external_forces` are held constant, that is, the spatial forces
+  /// `Fapp_Bo_W` are fixed in the world frame W and applied at each body
+  /// origin Bo.
+  ///
+  /// Partial derivatives with respect to q are taken along perturbations of
+  /// the configuration expressed in generalized velocity coordinates, i.e.,
+  /// on output `dtau_dq` stores `∂tau/∂q⋅N(q)`, where `N(q)` is the matrix
+  /// that maps generalized velocities to time derivatives of generalized
+  /// positions, see MapVelocityToQDot(). For models in which q̇ = v (see
+  /// IsVelocityEqualToQDot()) this is exactly `∂tau/∂q`.
+  ///
+  /// The cost of this method is `O(n⋅d)`, with n the number of bodies and d
+  /// the depth of the model's trees, as opposed to the `O(n²)` cost of
+  /// differentiating CalcInverseDynamics() with AutoDiffXd.
+  ///
+  /// - [Carpentier and Mansard, 2018] Carpentier, J. and Mansard, N., 2018.
+  ///   Analytical derivatives of rigid body dynamics algorithms. Robotics:
+  ///   Science and Systems.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[in] known_vdot
+  ///   A vector with the known generalized accelerations `vdot` for the full
+  ///   model.
+  /// @param[in] external_forces
+  ///   A set of forces, excluding gravity, to be applied to the system either
+  ///   as body spatial forces `Fapp_Bo_W` or generalized forces `tau_app`.
+  /// @param[out] dtau_dq
+  ///   On output, the `nv x nv` matrix `∂tau/∂q⋅N(q)`.
+  /// @param[out] dtau_dv
+  ///   On output, the `nv x nv` matrix `∂tau/∂v`.
+  /// @param[out] dtau_dvdot
+  ///   On output, the `nv x nv` matrix `∂tau/∂v̇`, i.e., the mass matrix M(q).
+  /// @throws std::exception if any of the output matrices is nullptr or is
+  ///   not of size `nv x nv`, with nv = num_velocities().
+  void CalcInverseDynamicsDerivatives(const systems::Context<T>& context,
+                                      const VectorX<T>& known_vdot,
+                                      const MultibodyForces<T>& external_forces,
+                                      EigenPtr<MatrixX<T>> dtau_dq,
+                                      EigenPtr<MatrixX<T>> dtau_dv,
+                                      EigenPtr<MatrixX<T>> dtau_dvdot) const;
+
+  /// Computes the generalized accelerations <pre>
+  ///   v̇ = M(q)⁻¹⋅(tau_g(q) + tau_app + ∑ J_WBᵀ(q) Fapp_Bo_W - C(q, v)v)
+  /// </pre>
+  /// due to gravity and the applied forces in `forces`, together with their
+  /// partial derivatives with respect to the generalized positions, the
+  /// generalized velocities and the applied generalized forces `tau_app`. The
+  /// derivatives are computed analytically from those of inverse dynamics,
+  /// see CalcInverseDynamicsDerivatives() for the conventions used, in
+  /// particular for the partial derivatives with respect to q and for the
+  /// treatment of applied forces.
+  ///
+  /// Note that, unlike the generalized accelerations output port, `v̇` only
+  /// includes the effect of gravity and of `forces`; force elements, joint
+  /// damping, actuation and contact forces must be included in `forces` if
+  /// desired, though their derivatives will be neglected.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[in] forces
+  ///   A set of forces, excluding gravity, to be applied to the system either
+  ///   as body spatial forces `Fapp_Bo_W` or generalized forces `tau_app`.
+  /// @param[out] vdot
+  ///   On output, the generalized accelerations v̇.
+  /// @param[out] dvdot_dq
+  ///   On output, the `nv x nv` matrix `∂v̇/∂q⋅N(q)`.
+  /// @param[out] dvdot_dv
+  ///   On output, the `nv x nv` matrix `∂v̇/∂v`.
+  /// @param[out] dvdot_dtau
+  ///   On output, the `nv x nv` matrix `∂v̇/∂tau_app`, i.e., M(q)⁻¹.
+  /// @throws std::exception if any of the outputs is nullptr or has the wrong
+  ///   size.
+  /// @throws std::exception if the mass matrix is not positive definite.
+  void CalcForwardDynamicsDerivatives(const systems::Context<T>& context,
+                                      const MultibodyForces<T>& forces,
+                                      EigenPtr<VectorX<T>> vdot,
+                                      EigenPtr<MatrixX<T>> dvdot_dq,
+                                      EigenPtr<MatrixX<T>> dvdot_dv,
+                                      EigenPtr<MatrixX<T>> dvdot_dtau) const;
+
 #ifdef DRAKE_DOXYGEN_CXX
   // MultibodyPlant uses the NVI implementation of
   // CalcImplicitTimeDerivativesResidual from
@@ -4740,6 +4854,113 @@ class MultibodyPlant final : public internal::MultibodyTreeSystem<T> {
   }
   /// @} <!-- System matrix computations -->
 
+  /// @anchor mbp_batch_computations
+  /// @name                Batched dynamics computations
+  /// Methods in this section evaluate the same dynamics quantity at many
+  /// configurations or states at once, as is common in sampling-based
+  /// planning, model-predictive control, and dataset generation. Each column
+  /// of the input matrices corresponds to a single sample. Rather than
+  /// requiring the caller to loop over samples (setting the state on a
+  /// Context, and paying for cache invalidation and fresh scratch storage each
+  /// time), these methods clone the given Context at most once per thread,
+  /// reuse all per-sample scratch storage, and optionally spread the samples
+  /// across threads.
+  ///
+  /// The given `context` supplies all quantities that are not part of the
+  /// batch, e.g., parameters, input port values and (for discrete plants)
+  /// discrete state other than the multibody state. It is never modified. It
+  /// may be a root Context or the plant's subcontext within a Diagram's
+  /// Context.
+  ///
+  /// @note Each thread works with its own clone of the root Context that
+  /// `context` belongs to, so that the plant's input ports remain connected
+  /// within the clone. For a plant in a large Diagram, that clone costs more
+  /// than the clone of the plant's Context alone would.
+  /// @{
+
+  /// Computes the mass matrix `M(q)` for each column of `q_batch`. See
+  /// CalcMassMatrix() for details on the quantity being computed.
+  ///
+  /// @param[in] context
+  ///   A Context for `this` plant, providing parameters. The generalized
+  ///   positions stored in it are ignored.
+  /// @param[in] q_batch
+  ///   A `num_positions() x N` matrix of generalized positions, one sample per
+  ///   column.
+  /// @param[in] parallelize
+  ///   The parallelism to use across samples.
+  /// @returns a vector of N mass matrices, each of size
+  ///   `num_velocities() x num_velocities()`, in the same order as the columns
+  ///   of `q_batch`.
+  /// @throws std::exception if `q_batch.rows() != num_positions()`.
+  std::vector<MatrixX<T>> CalcMassMatrixBatch(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      Parallelism parallelize = Parallelism::None()) const;
+
+  /// Computes inverse dynamics for each column of `x_batch` and `vdot_batch`,
+  /// with no externally applied forces. That is, for each sample i this
+  /// computes <pre>
+  ///   tauᵢ = M(qᵢ)v̇ᵢ + C(qᵢ, vᵢ)vᵢ
+  /// </pre>
+  /// See CalcInverseDynamics() for details on the quantity being computed.
+  /// Applied forces that are a function of the state only, e.g. gravity, can be
+  /// accounted for by the caller via CalcGravityGeneralizedForces() or
+  /// CalcForceElementsContribution() at the same samples.
+  ///
+  /// @param[in] context
+  ///   A Context for `this` plant, providing parameters. The multibody state
+  ///   stored in it is ignored.
+  /// @param[in] x_batch
+  ///   A `num_multibody_states() x N` matrix of states `x = [q; v]`, one
+  ///   sample per column.
+  /// @param[in] vdot_batch
+  ///   A `num_velocities() x N` matrix of generalized accelerations, one sample
+  ///   per column.
+  /// @param[in] parallelize
+  ///   The parallelism to use across samples.
+  /// @returns a `num_velocities() x N` matrix of generalized forces, one sample
+  ///   per column.
+  /// @throws std::exception if the shapes of `x_batch` and `vdot_batch` are
+  ///   inconsistent with each other or with `this` plant.
+  MatrixX<T> CalcInverseDynamicsBatch(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& x_batch,
+      const Eigen::Ref<const MatrixX<T>>& vdot_batch,
+      Parallelism parallelize = Parallelism::None()) const;
+
+  /// Computes forward dynamics for each column of `x_batch`. For each sample,
+  /// the generalized accelerations `v̇ᵢ` are those of the plant at a context
+  /// with the multibody state set to `xᵢ` and all other quantities
+  /// (parameters, inputs, etc.) as given by `context`. This includes all
+  /// forces applied on the plant through its input ports.
+  ///
+  /// For a continuous plant, `v̇ᵢ` is what
+  /// get_generalized_acceleration_output_port() reports at that context. For a
+  /// discrete plant, `v̇ᵢ = (vᵢⁿ⁺¹ − vᵢ)/δt` is the acceleration of a single
+  /// discrete step taken from `xᵢ`, including the effect of contact and
+  /// constraints as resolved by the discrete solver. The output port reports
+  /// that value only when the plant doesn't use sampled output ports (see
+  /// SetUseSampledOutputPorts()); otherwise it reports the acceleration of
+  /// the most recent step, which doesn't depend on the current state.
+  ///
+  /// @param[in] context
+  ///   A Context for `this` plant, providing parameters and input port values.
+  ///   The multibody state stored in it is ignored.
+  /// @param[in] x_batch
+  ///   A `num_multibody_states() x N` matrix of states `x = [q; v]`, one
+  ///   sample per column.
+  /// @param[in] parallelize
+  ///   The parallelism to use across samples.
+  /// @returns a `num_velocities() x N` matrix of generalized accelerations, one
+  ///   sample per column.
+  /// @throws std::exception if `x_batch.rows() != num_multibody_states()`.
+  MatrixX<T> CalcForwardDynamicsBatch(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& x_batch,
+      Parallelism parallelize = Parallelism::None()) const;
+  /// @} <!-- Batched dynamics computations -->
+
   /// @anchor Jacobian_functions
   /// @name Jacobian functions
   /// Herein, a Jacobian is a matrix that contains the partial derivatives of a
@@ -25,6 +25,7 @@ struct MultibodyPlantConfig {
     a->Visit(DRAKE_NVP(sap_near_rigid_threshold));
     a->Visit(DRAKE_NVP(contact_surface_representation));
     a->Visit(DRAKE_NVP(adjacent_bodies_collision_filters));
+    a->Visit(DRAKE_NVP(num_threads));
   }
 
   /// Configures the MultibodyPlant::MultibodyPlant() constructor time_step.
@@ -95,6 +96,11 @@ struct MultibodyPlantConfig {
 
   /// Configures the MultibodyPlant::set_adjacent_bodies_collision_filters().
   bool adjacent_bodies_collision_filters{true};
+
+  /// Configures the MultibodyPlant::set_parallelism(), i.e., the number of
+  /// threads used to evaluate the independent trees of the model concurrently.
+  /// Must be >= 1; the default of 1 evaluates everything serially.
+  int num_threads{1};
 };
 
 }  // namespace multibody
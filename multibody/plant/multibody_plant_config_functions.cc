@@ -58,6 +58,7 @@ void ApplyMultibodyPlantConfig(const MultibodyPlantConfig& config,
           config.contact_surface_representation));
   plant->set_adjacent_bodies_collision_filters(
       config.adjacent_bodies_collision_filters);
+  plant->set_parallelism(Parallelism(config.num_threads));
 }
 
 namespace internal {
@@ -1091,6 +1091,7 @@ void SapDriver<T>::CalcSapSolverResults(
   // Solve the reduced DOF locked problem.
   SapSolver<T> sap;
   sap.set_parameters(sap_parameters_);
+  sap.set_symbolic_factorization_cache(&symbolic_factorization_cache_);
 
   SapSolverStatus status;
   if (has_locked_dofs) {
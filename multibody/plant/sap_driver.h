@@ -13,6 +13,7 @@
 #include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
 #include "drake/multibody/contact_solvers/sap/sap_solver.h"
 #include "drake/multibody/contact_solvers/sap/sap_solver_results.h"
+#include "drake/multibody/contact_solvers/symbolic_factorization_cache.h"
 #include "drake/multibody/plant/discrete_contact_pair.h"
 #include "drake/multibody/topology/forest.h"
 #include "drake/multibody/tree/multibody_forces.h"
@@ -298,6 +299,12 @@ class SapDriver {
   systems::CacheIndex sap_results_;
   // Parameters for SAP.
   contact_solvers::internal::SapSolverParameters sap_parameters_;
+  // Symbolic analyses of the SAP Hessian, reused across time steps whose
+  // contact problems have the same sparsity. The cache is thread safe and
+  // therefore it can be used from const methods, even when evaluated
+  // concurrently on different contexts.
+  mutable contact_solvers::internal::SymbolicFactorizationCache
+      symbolic_factorization_cache_;
 };
 
 }  // namespace internal
@@ -1,10 +1,13 @@
 #include "drake/multibody/plant/deformable_driver.h"
 
+#include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "drake/common/parallelism.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/proximity_properties.h"
@@ -216,6 +219,97 @@ TEST_F(DeformableDriverTest, CalcDiscreteStates) {
   EXPECT_EQ(discrete_state.tail(num_dofs), fem_state.GetAccelerations());
 }
 
+/* Fixture with several deformable bodies that are only subject to gravity, so
+ that the DeformableDriver may solve them concurrently. */
+class DeformableDriverParallelTest : public ::testing::Test {
+ protected:
+  static constexpr double kDt = 0.01;
+  static constexpr int kNumBodies = 4;
+
+  /* Builds a plant whose DeformableModel uses `num_threads` threads. The
+   bodies are far enough apart to never be in contact. */
+  void Build(int num_threads) {
+    diagram_context_.reset();
+    diagram_.reset();
+    systems::DiagramBuilder<double> builder;
+    plant_ = &AddMultibodyPlantSceneGraph(&builder, kDt).plant;
+    DeformableModel<double>& deformable_model =
+        plant_->mutable_deformable_model();
+    for (int i = 0; i < kNumBodies; ++i) {
+      auto geometry = make_unique<GeometryInstance>(
+          RigidTransformd(Vector3<double>(3.0 * i, 0, 0)),
+          make_unique<Sphere>(1), fmt::format("sphere{}", i));
+      geometry::ProximityProperties props;
+      geometry::AddContactMaterial({}, {}, CoulombFriction<double>(1.0, 1.0),
+                                   &props);
+      geometry->set_proximity_properties(std::move(props));
+      fem::DeformableBodyConfig<double> body_config;
+      body_config.set_youngs_modulus(1e6);
+      /* Use a nonlinear material so that a body can fail to converge. */
+      body_config.set_material_model(fem::MaterialModel::kCorotated);
+      deformable_model.RegisterDeformableBody(std::move(geometry), body_config,
+                                              0.5);
+    }
+    deformable_model.SetParallelism(Parallelism(num_threads));
+    model_ = &deformable_model;
+    plant_->set_discrete_contact_approximation(
+        DiscreteContactApproximation::kSap);
+    plant_->Finalize();
+    plant_->SetDiscreteUpdateManager(
+        make_unique<CompliantContactManager<double>>());
+    diagram_ = builder.Build();
+    diagram_context_ = diagram_->CreateDefaultContext();
+    plant_context_ =
+        &plant_->GetMyMutableContextFromRoot(diagram_context_.get());
+  }
+
+  /* Returns the discrete state of the body with `index` after one step. */
+  VectorX<double> CalcNextState(DeformableBodyIndex index) const {
+    const DeformableBodyId id = model_->GetBodyId(index);
+    return plant_->EvalUniquePeriodicDiscreteUpdate(*plant_context_)
+        .value(model_->GetDiscreteStateIndex(id));
+  }
+
+  MultibodyPlant<double>* plant_{nullptr};
+  const DeformableModel<double>* model_{nullptr};
+  std::unique_ptr<systems::Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> diagram_context_;
+  Context<double>* plant_context_{nullptr};
+};
+
+/* Solving the bodies concurrently gives the same result as solving them one
+ after another. */
+TEST_F(DeformableDriverParallelTest, MatchesSerial) {
+  Build(1);
+  std::vector<VectorX<double>> expected;
+  for (DeformableBodyIndex i(0); i < kNumBodies; ++i) {
+    expected.push_back(CalcNextState(i));
+  }
+  Build(2);
+  for (DeformableBodyIndex i(0); i < kNumBodies; ++i) {
+    EXPECT_TRUE(CompareMatrices(CalcNextState(i), expected[i], 1e-12));
+  }
+}
+
+/* A failure to solve one of the bodies propagates out of the concurrent
+ solve as an exception. */
+TEST_F(DeformableDriverParallelTest, FailurePropagates) {
+  Build(2);
+  /* Non-finite velocities keep the Newton solve of one body from
+   converging. */
+  const DeformableBodyId id = model_->GetBodyId(DeformableBodyIndex(2));
+  const int num_dofs = model_->GetFemModel(id).num_dofs();
+  VectorX<double> state_value(3 * num_dofs);
+  state_value << model_->GetReferencePositions(id),
+      VectorX<double>::Constant(num_dofs,
+                                std::numeric_limits<double>::quiet_NaN()),
+      VectorX<double>::Zero(num_dofs);
+  plant_context_->SetDiscreteState(model_->GetDiscreteStateIndex(id),
+                                   state_value);
+  DRAKE_EXPECT_THROWS_MESSAGE(CalcNextState(DeformableBodyIndex(0)),
+                              ".*failed to converge.*");
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace multibody
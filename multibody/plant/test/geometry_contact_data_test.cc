@@ -0,0 +1,62 @@
+#include "drake/multibody/plant/geometry_contact_data.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+using geometry::GeometryId;
+using geometry::PenetrationAsPointPair;
+
+PenetrationAsPointPair<double> MakePointPair() {
+  PenetrationAsPointPair<double> result;
+  result.id_A = GeometryId::get_new_id();
+  result.id_B = GeometryId::get_new_id();
+  return result;
+}
+
+// Allocate() reuses the storage (and the capacity of its vectors) unless the
+// previous data is shared.
+GTEST_TEST(GeometryContactDataTest, Allocate) {
+  GeometryContactData<double> dut;
+  EXPECT_TRUE(dut.get().point_pairs.empty());
+
+  NestedGeometryContactData<double>& data = dut.Allocate();
+  EXPECT_EQ(&dut.get(), &data);
+  data.point_pairs.push_back(MakePointPair());
+  data.point_pairs.push_back(MakePointPair());
+  const int capacity = data.point_pairs.capacity();
+
+  // No one else shares the data, so it is cleared and reused.
+  NestedGeometryContactData<double>& reused = dut.Allocate();
+  EXPECT_EQ(&reused, &data);
+  EXPECT_TRUE(reused.point_pairs.empty());
+  EXPECT_EQ(reused.point_pairs.capacity(), capacity);
+  reused.point_pairs.push_back(MakePointPair());
+  const GeometryId id_A = reused.point_pairs[0].id_A;
+
+  // Shared data is never modified by subsequent allocations.
+  const std::shared_ptr<const NestedGeometryContactData<double>> shared =
+      dut.Share();
+  NestedGeometryContactData<double>& fresh = dut.Allocate();
+  EXPECT_NE(&fresh, shared.get());
+  EXPECT_TRUE(fresh.point_pairs.empty());
+  ASSERT_EQ(shared->point_pairs.size(), 1);
+  EXPECT_EQ(shared->point_pairs[0].id_A, id_A);
+
+  // Likewise for copies.
+  const GeometryContactData<double> copy = dut;
+  EXPECT_NE(&dut.Allocate(), &copy.get());
+
+  dut.Clear();
+  EXPECT_TRUE(dut.get().point_pairs.empty());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,174 @@
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/primitives/constant_vector_source.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using systems::Context;
+
+constexpr double kTolerance = 1.0e-12;
+
+// We verify the batched computations by comparing them against the result of
+// calling the single-sample APIs in a loop.
+class MultibodyPlantBatchTest : public ::testing::TestWithParam<int> {
+ public:
+  void SetUp() override {
+    Parser parser(&plant_);
+    parser.AddModelsFromUrl(
+        "package://drake_models/iiwa_description/sdf/"
+        "iiwa14_no_collision.sdf");
+    plant_.WeldFrames(plant_.world_frame(),
+                      plant_.GetFrameByName("iiwa_link_0"));
+    plant_.Finalize();
+    context_ = plant_.CreateDefaultContext();
+
+    // Arbitrary, yet distinct, samples.
+    const int nq = plant_.num_positions();
+    const int nv = plant_.num_velocities();
+    x_batch_.resize(plant_.num_multibody_states(), kNumSamples);
+    vdot_batch_.resize(nv, kNumSamples);
+    for (int i = 0; i < kNumSamples; ++i) {
+      x_batch_.col(i).head(nq) = VectorX<double>::LinSpaced(nq, -1.0, 1.0) * i;
+      x_batch_.col(i).tail(nv) = VectorX<double>::LinSpaced(nv, 0.5, -0.5) * i;
+      vdot_batch_.col(i) = VectorX<double>::LinSpaced(nv, 1.0, 2.0) * i;
+    }
+  }
+
+ protected:
+  static constexpr int kNumSamples = 5;
+
+  Parallelism parallelize() const { return Parallelism(GetParam()); }
+
+  MultibodyPlant<double> plant_{0.0};
+  std::unique_ptr<Context<double>> context_;
+  MatrixX<double> x_batch_;
+  MatrixX<double> vdot_batch_;
+};
+
+TEST_P(MultibodyPlantBatchTest, MassMatrix) {
+  const int nq = plant_.num_positions();
+  const int nv = plant_.num_velocities();
+  const std::vector<MatrixX<double>> M_batch = plant_.CalcMassMatrixBatch(
+      *context_, x_batch_.topRows(nq), parallelize());
+  ASSERT_EQ(ssize(M_batch), kNumSamples);
+
+  MatrixX<double> M_expected(nv, nv);
+  for (int i = 0; i < kNumSamples; ++i) {
+    plant_.SetPositions(context_.get(), x_batch_.col(i).head(nq));
+    plant_.CalcMassMatrix(*context_, &M_expected);
+    EXPECT_TRUE(CompareMatrices(M_batch[i], M_expected, kTolerance));
+  }
+}
+
+TEST_P(MultibodyPlantBatchTest, InverseDynamics) {
+  const MatrixX<double> tau_batch = plant_.CalcInverseDynamicsBatch(
+      *context_, x_batch_, vdot_batch_, parallelize());
+  ASSERT_EQ(tau_batch.rows(), plant_.num_velocities());
+  ASSERT_EQ(tau_batch.cols(), kNumSamples);
+
+  const MultibodyForces<double> no_forces(plant_);
+  for (int i = 0; i < kNumSamples; ++i) {
+    plant_.SetPositionsAndVelocities(context_.get(), x_batch_.col(i));
+    const VectorX<double> tau_expected =
+        plant_.CalcInverseDynamics(*context_, vdot_batch_.col(i), no_forces);
+    EXPECT_TRUE(CompareMatrices(tau_batch.col(i), tau_expected, kTolerance));
+  }
+}
+
+TEST_P(MultibodyPlantBatchTest, ForwardDynamics) {
+  const MatrixX<double> vdot_batch =
+      plant_.CalcForwardDynamicsBatch(*context_, x_batch_, parallelize());
+  ASSERT_EQ(vdot_batch.rows(), plant_.num_velocities());
+  ASSERT_EQ(vdot_batch.cols(), kNumSamples);
+
+  for (int i = 0; i < kNumSamples; ++i) {
+    plant_.SetPositionsAndVelocities(context_.get(), x_batch_.col(i));
+    const VectorX<double> vdot_expected =
+        plant_.get_generalized_acceleration_output_port().Eval(*context_);
+    EXPECT_TRUE(CompareMatrices(vdot_batch.col(i), vdot_expected, kTolerance));
+  }
+}
+
+// The batch methods accept the plant's subcontext within a Diagram's Context,
+// in which case the plant's input ports are evaluated from their sources in the
+// Diagram.
+TEST_P(MultibodyPlantBatchTest, PlantInDiagram) {
+  systems::DiagramBuilder<double> builder;
+  auto& plant = *builder.AddSystem<MultibodyPlant<double>>(0.0);
+  Parser(&plant).AddModelsFromUrl(
+      "package://drake_models/iiwa_description/sdf/iiwa14_no_collision.sdf");
+  plant.WeldFrames(plant.world_frame(), plant.GetFrameByName("iiwa_link_0"));
+  plant.Finalize();
+  const int nq = plant.num_positions();
+  const int nv = plant.num_velocities();
+  auto& actuation = *builder.AddSystem<systems::ConstantVectorSource<double>>(
+      VectorX<double>::LinSpaced(plant.num_actuators(), 1.0, 10.0));
+  builder.Connect(actuation.get_output_port(),
+                  plant.get_actuation_input_port());
+  const auto diagram = builder.Build();
+  const auto diagram_context = diagram->CreateDefaultContext();
+  Context<double>& context =
+      plant.GetMyMutableContextFromRoot(diagram_context.get());
+
+  const std::vector<MatrixX<double>> M_batch =
+      plant.CalcMassMatrixBatch(context, x_batch_.topRows(nq), parallelize());
+  const MatrixX<double> tau_batch = plant.CalcInverseDynamicsBatch(
+      context, x_batch_, vdot_batch_, parallelize());
+  const MatrixX<double> vdot_batch =
+      plant.CalcForwardDynamicsBatch(context, x_batch_, parallelize());
+
+  MatrixX<double> M_expected(nv, nv);
+  const MultibodyForces<double> no_forces(plant);
+  for (int i = 0; i < kNumSamples; ++i) {
+    plant.SetPositionsAndVelocities(&context, x_batch_.col(i));
+    plant.CalcMassMatrix(context, &M_expected);
+    EXPECT_TRUE(CompareMatrices(M_batch[i], M_expected, kTolerance));
+    EXPECT_TRUE(CompareMatrices(
+        tau_batch.col(i),
+        plant.CalcInverseDynamics(context, vdot_batch_.col(i), no_forces),
+        kTolerance));
+    const VectorX<double> vdot_expected =
+        plant.get_generalized_acceleration_output_port().Eval(context);
+    EXPECT_TRUE(CompareMatrices(vdot_batch.col(i), vdot_expected, kTolerance));
+    // The actuation makes a difference.
+    plant_.SetPositionsAndVelocities(context_.get(), x_batch_.col(i));
+    EXPECT_FALSE(CompareMatrices(
+        vdot_expected,
+        plant_.get_generalized_acceleration_output_port().Eval(*context_),
+        kTolerance));
+  }
+}
+
+TEST_P(MultibodyPlantBatchTest, BadSizes) {
+  const int nq = plant_.num_positions();
+  const int nv = plant_.num_velocities();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      plant_.CalcMassMatrixBatch(*context_, x_batch_, parallelize()),
+      ".*q_batch.rows\\(\\) == num_positions\\(\\).*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      plant_.CalcInverseDynamicsBatch(*context_, x_batch_,
+                                      vdot_batch_.leftCols(1), parallelize()),
+      ".*vdot_batch.cols\\(\\) == x_batch.cols\\(\\).*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      plant_.CalcForwardDynamicsBatch(*context_, x_batch_.topRows(nq + nv - 1),
+                                      parallelize()),
+      ".*x_batch.rows\\(\\) == num_multibody_states\\(\\).*");
+}
+
+INSTANTIATE_TEST_SUITE_P(NumThreads, MultibodyPlantBatchTest,
+                         ::testing::Values(1, 2, 4));
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
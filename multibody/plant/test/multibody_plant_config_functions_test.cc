@@ -24,6 +24,7 @@ GTEST_TEST(MultibodyPlantConfigFunctionsTest, AddMultibodyBasicTest) {
   config.contact_model = "hydroelastic";
   config.contact_surface_representation = "polygon";
   config.adjacent_bodies_collision_filters = false;
+  config.num_threads = 2;
 
   drake::systems::DiagramBuilder<double> builder;
   auto result = AddMultibodyPlant(config, &builder);
@@ -34,6 +35,7 @@ GTEST_TEST(MultibodyPlantConfigFunctionsTest, AddMultibodyBasicTest) {
   EXPECT_EQ(result.plant.get_contact_surface_representation(),
             geometry::HydroelasticContactRepresentation::kPolygon);
   EXPECT_EQ(result.plant.get_adjacent_bodies_collision_filters(), false);
+  EXPECT_EQ(result.plant.get_parallelism().num_threads(), 2);
   // There is no getter for penetration_allowance nor stiction_tolerance, so we
   // can't test them.
 }
@@ -92,6 +94,7 @@ discrete_contact_approximation: lagged
 sap_near_rigid_threshold: 0.01
 contact_surface_representation: triangle
 adjacent_bodies_collision_filters: false
+num_threads: 3
 )""";
 
 GTEST_TEST(MultibodyPlantConfigFunctionsTest, YamlTest) {
@@ -108,6 +111,7 @@ GTEST_TEST(MultibodyPlantConfigFunctionsTest, YamlTest) {
             DiscreteContactApproximation::kLagged);
   EXPECT_EQ(result.plant.get_sap_near_rigid_threshold(), 0.01);
   EXPECT_EQ(result.plant.get_adjacent_bodies_collision_filters(), false);
+  EXPECT_EQ(result.plant.get_parallelism().num_threads(), 3);
   // There is no getter for penetration_allowance nor stiction_tolerance, so we
   // can't test them.
 }
@@ -0,0 +1,244 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/autodiff_gradient.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/multibody/plant/externally_applied_spatial_force.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/ball_rpy_joint.h"
+#include "drake/multibody/tree/planar_joint.h"
+#include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/rpy_floating_joint.h"
+#include "drake/multibody/tree/universal_joint.h"
+#include "drake/multibody/tree/weld_joint.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::Context;
+
+constexpr double kTolerance = 1.0e-10;
+
+// We verify the analytic derivatives against those obtained by automatic
+// differentiation of the same quantities on the AutoDiffXd plant.
+class MultibodyPlantDynamicsDerivativesTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    const SpatialInertia<double> M_BBo_B =
+        SpatialInertia<double>::SolidBoxWithMass(1.3, 0.1, 0.2, 0.3);
+    const RigidTransformd X_PF(RollPitchYawd(0.1, -0.2, 0.3),
+                               Vector3d(0.1, 0.0, -0.4));
+    const RigidTransformd X_BM(RollPitchYawd(-0.3, 0.2, 0.1),
+                               Vector3d(0.0, 0.05, 0.1));
+
+    // A floating base (a quaternion mobilizer) with a chain of mobilizers of
+    // different kinds, including the ones with coupled velocities, a weld and
+    // a branch.
+    const RigidBody<double>& base = plant_.AddRigidBody("base", M_BBo_B);
+    body_names_.push_back("base");
+    const RigidBody<double>* parent = &base;
+    const auto add_link = [&](const std::string& name) {
+      const RigidBody<double>& link = plant_.AddRigidBody(name, M_BBo_B);
+      body_names_.push_back(name);
+      return &link;
+    };
+    const RigidBody<double>* link = add_link("universal");
+    plant_.AddJoint<UniversalJoint>("universal", *parent, X_PF, *link, X_BM);
+    parent = link;
+    link = add_link("planar");
+    plant_.AddJoint<PlanarJoint>("planar", *parent, X_PF, *link, X_BM,
+                                 Vector3d::Zero());
+    parent = link;
+    link = add_link("ball");
+    plant_.AddJoint<BallRpyJoint>("ball", *parent, X_PF, *link, X_BM);
+    parent = link;
+    const RigidBody<double>& welded = plant_.AddRigidBody("welded", M_BBo_B);
+    plant_.AddJoint<WeldJoint>("weld", *parent, X_PF, welded, X_BM,
+                               RigidTransformd(Vector3d(0.0, 0.2, 0.0)));
+    link = add_link("prismatic");
+    plant_.AddJoint<PrismaticJoint>("prismatic", welded, X_PF, *link, X_BM,
+                                    Vector3d(1.0, 2.0, 3.0).normalized());
+    link = add_link("revolute");
+    plant_.AddJoint<RevoluteJoint>("revolute", base, X_PF, *link, X_BM,
+                                   Vector3d(0.0, 1.0, 1.0).normalized());
+    // A second tree, with an rpy floating joint.
+    link = add_link("rpy_floating");
+    plant_.AddJoint<RpyFloatingJoint>("rpy_floating", plant_.world_body(),
+                                      X_PF, *link, X_BM);
+    plant_.Finalize();
+
+    context_ = plant_.CreateDefaultContext();
+    plant_.SetPositions(
+        context_.get(),
+        VectorX<double>::LinSpaced(plant_.num_positions(), -1.0, 1.2));
+    plant_.SetFreeBodyPose(context_.get(), base,
+                           RigidTransformd(RollPitchYawd(0.4, -0.6, 1.1),
+                                           Vector3d(0.3, -0.2, 0.5)));
+    plant_.SetVelocities(
+        context_.get(),
+        VectorX<double>::LinSpaced(plant_.num_velocities(), 1.5, -2.0));
+
+    autodiff_plant_ = systems::System<double>::ToAutoDiffXd(plant_);
+  }
+
+ protected:
+  // Arbitrary applied forces. Spatial forces are applied at the origin of
+  // the bodies that are not welded to their parents.
+  template <typename T>
+  std::vector<ExternallyAppliedSpatialForce<T>> MakeSpatialForces() const {
+    std::vector<ExternallyAppliedSpatialForce<T>> forces;
+    for (int i = 0; i < ssize(body_names_); ++i) {
+      ExternallyAppliedSpatialForce<T> force;
+      force.body_index = plant_.GetBodyByName(body_names_[i]).index();
+      force.p_BoBq_B = Vector3<T>::Zero();
+      force.F_Bq_W = SpatialForce<T>(Vector3<T>(0.1 * i, -0.2, 0.3),
+                                     Vector3<T>(1.0, 0.5 * i, -0.7));
+      forces.push_back(force);
+    }
+    return forces;
+  }
+
+  VectorX<double> MakeGeneralizedForces() const {
+    return VectorX<double>::LinSpaced(plant_.num_velocities(), -0.5, 0.8);
+  }
+
+  template <typename T>
+  MultibodyForces<T> MakeForces(const MultibodyPlant<T>& plant) const {
+    MultibodyForces<T> forces(plant);
+    for (const auto& force : MakeSpatialForces<T>()) {
+      forces.mutable_body_forces()[plant.get_body(force.body_index)
+                                       .mobod_index()] += force.F_Bq_W;
+    }
+    forces.mutable_generalized_forces() =
+        MakeGeneralizedForces().template cast<T>();
+    return forces;
+  }
+
+  // Returns N(q) as a dense matrix.
+  MatrixX<double> CalcN() const {
+    return plant_.MakeVelocityToQDotMap(*context_).toDense();
+  }
+
+  // Returns an AutoDiffXd context with the state of context_, with derivatives
+  // with respect to the state.
+  std::unique_ptr<Context<AutoDiffXd>> MakeAutoDiffContext() const {
+    auto context = autodiff_plant_->CreateDefaultContext();
+    context->SetTimeStateAndParametersFrom(*context_);
+    autodiff_plant_->SetPositionsAndVelocities(
+        context.get(),
+        math::InitializeAutoDiff(plant_.GetPositionsAndVelocities(*context_)));
+    return context;
+  }
+
+  MultibodyPlant<double> plant_{0.0};
+  std::unique_ptr<MultibodyPlant<AutoDiffXd>> autodiff_plant_;
+  std::unique_ptr<Context<double>> context_;
+  std::vector<std::string> body_names_;
+};
+
+TEST_F(MultibodyPlantDynamicsDerivativesTest, InverseDynamics) {
+  const int nq = plant_.num_positions();
+  const int nv = plant_.num_velocities();
+  const VectorX<double> vdot = VectorX<double>::LinSpaced(nv, 0.3, -1.1);
+  const MultibodyForces<double> forces = MakeForces(plant_);
+
+  MatrixX<double> dtau_dq(nv, nv);
+  MatrixX<double> dtau_dv(nv, nv);
+  MatrixX<double> dtau_dvdot(nv, nv);
+  plant_.CalcInverseDynamicsDerivatives(*context_, vdot, forces, &dtau_dq,
+                                        &dtau_dv, &dtau_dvdot);
+
+  // Expected values, with derivatives with respect to x = [q; v].
+  const auto autodiff_context = MakeAutoDiffContext();
+  const VectorX<AutoDiffXd> tau =
+      autodiff_plant_->CalcInverseDynamics(*autodiff_context,
+                                           vdot.cast<AutoDiffXd>(),
+                                           MakeForces(*autodiff_plant_)) -
+      autodiff_plant_->CalcGravityGeneralizedForces(*autodiff_context);
+  const MatrixX<double> dtau_dx = math::ExtractGradient(tau);
+  MatrixX<double> M(nv, nv);
+  plant_.CalcMassMatrix(*context_, &M);
+
+  const double scale = dtau_dx.norm();
+  EXPECT_TRUE(CompareMatrices(dtau_dq, dtau_dx.leftCols(nq) * CalcN(),
+                              kTolerance * scale));
+  EXPECT_TRUE(
+      CompareMatrices(dtau_dv, dtau_dx.rightCols(nv), kTolerance * scale));
+  EXPECT_TRUE(CompareMatrices(dtau_dvdot, M, kTolerance));
+}
+
+TEST_F(MultibodyPlantDynamicsDerivativesTest, ForwardDynamics) {
+  const int nq = plant_.num_positions();
+  const int nv = plant_.num_velocities();
+
+  VectorX<double> vdot(nv);
+  MatrixX<double> dvdot_dq(nv, nv);
+  MatrixX<double> dvdot_dv(nv, nv);
+  MatrixX<double> dvdot_dtau(nv, nv);
+  plant_.CalcForwardDynamicsDerivatives(*context_, MakeForces(plant_), &vdot,
+                                        &dvdot_dq, &dvdot_dv, &dvdot_dtau);
+
+  // Expected values, from the generalized accelerations output port with the
+  // same forces applied through the input ports. Derivatives are with respect
+  // to [q; v; tau_app].
+  auto autodiff_context = autodiff_plant_->CreateDefaultContext();
+  autodiff_context->SetTimeStateAndParametersFrom(*context_);
+  const auto [q, v, tau_applied] = math::InitializeAutoDiffTuple(
+      plant_.GetPositions(*context_), plant_.GetVelocities(*context_),
+      MakeGeneralizedForces());
+  autodiff_plant_->SetPositions(autodiff_context.get(), q);
+  autodiff_plant_->SetVelocities(autodiff_context.get(), v);
+  autodiff_plant_->get_applied_generalized_force_input_port().FixValue(
+      autodiff_context.get(), tau_applied);
+  autodiff_plant_->get_applied_spatial_force_input_port().FixValue(
+      autodiff_context.get(), MakeSpatialForces<AutoDiffXd>());
+  const VectorX<AutoDiffXd>& vdot_expected =
+      autodiff_plant_->get_generalized_acceleration_output_port().Eval(
+          *autodiff_context);
+  const MatrixX<double> dvdot_dx = math::ExtractGradient(vdot_expected);
+
+  const double scale = dvdot_dx.norm();
+  EXPECT_TRUE(CompareMatrices(vdot, math::ExtractValue(vdot_expected),
+                              kTolerance * vdot.norm()));
+  EXPECT_TRUE(CompareMatrices(dvdot_dq, dvdot_dx.leftCols(nq) * CalcN(),
+                              kTolerance * scale));
+  EXPECT_TRUE(CompareMatrices(dvdot_dv, dvdot_dx.middleCols(nq, nv),
+                              kTolerance * scale));
+  EXPECT_TRUE(CompareMatrices(dvdot_dtau, dvdot_dx.rightCols(nv),
+                              kTolerance * scale));
+}
+
+TEST_F(MultibodyPlantDynamicsDerivativesTest, BadSizes) {
+  const int nv = plant_.num_velocities();
+  const MultibodyForces<double> forces(plant_);
+  MatrixX<double> good(nv, nv);
+  MatrixX<double> bad(nv, nv + 1);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      plant_.CalcInverseDynamicsDerivatives(*context_, VectorX<double>(nv + 1),
+                                            forces, &good, &good, &good),
+      ".*known_vdot.size\\(\\) == nv.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      plant_.CalcInverseDynamicsDerivatives(*context_, VectorX<double>(nv),
+                                            forces, &good, &bad, &good),
+      ".*cols\\(\\) == nv.*");
+  VectorX<double> vdot(nv);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      plant_.CalcForwardDynamicsDerivatives(*context_, forces, &vdot, &good,
+                                            &good, nullptr),
+      ".*dvdot != nullptr.*");
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,129 @@
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using systems::Context;
+
+constexpr double kTolerance = 1.0e-13;
+
+// Verifies that evaluating the multibody recursions with the trees of the
+// model distributed over several threads gives the same results as the serial
+// evaluation.
+class MultibodyPlantParallelismTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    const SpatialInertia<double> M_BBo_B =
+        SpatialInertia<double>::SolidBoxWithMass(0.7, 0.1, 0.2, 0.3);
+    // Many free bodies, each one of them its own tree.
+    for (int i = 0; i < kNumFreeBodies; ++i) {
+      plant_.AddRigidBody("free" + std::to_string(i), M_BBo_B);
+    }
+    // A few pendulum chains, so that trees have different sizes.
+    for (int c = 0; c < kNumChains; ++c) {
+      const RigidBody<double>* parent = &plant_.world_body();
+      for (int i = 0; i <= c; ++i) {
+        const std::string name = fmt::format("link_{}_{}", c, i);
+        const RigidBody<double>& link = plant_.AddRigidBody(name, M_BBo_B);
+        plant_.AddJoint<RevoluteJoint>(
+            name, *parent, RigidTransformd(Vector3d(0.0, 0.0, -0.5)), link,
+            std::nullopt, Vector3d::UnitY());
+        parent = &link;
+      }
+    }
+    plant_.Finalize();
+
+    // Arbitrary, non-trivial state.
+    auto context = plant_.CreateDefaultContext();
+    for (int i = 0; i < kNumFreeBodies; ++i) {
+      const RigidBody<double>& body =
+          plant_.GetBodyByName("free" + std::to_string(i));
+      plant_.SetFreeBodyPose(
+          context.get(), body,
+          RigidTransformd(math::RollPitchYawd(0.1 * i, 0.2, -0.3 * i),
+                          Vector3d(i, 0.5, -0.2 * i)));
+    }
+    for (int c = 0; c < kNumChains; ++c) {
+      for (int i = 0; i <= c; ++i) {
+        plant_.GetJointByName<RevoluteJoint>(fmt::format("link_{}_{}", c, i))
+            .set_angle(context.get(), 0.3 * (i + 1) - 0.1 * c);
+      }
+    }
+    plant_.SetVelocities(
+        context.get(),
+        VectorX<double>::LinSpaced(plant_.num_velocities(), 2.0, -2.0));
+    x_ = plant_.GetPositionsAndVelocities(*context);
+  }
+
+ protected:
+  static constexpr int kNumFreeBodies = 20;
+  static constexpr int kNumChains = 5;
+
+  // Evaluates a handful of quantities that exercise every parallelized pass.
+  struct Results {
+    MatrixX<double> M;
+    VectorX<double> tau_id;
+    VectorX<double> vdot;
+    SpatialVelocity<double> V_WB;
+  };
+
+  Results Calc(Parallelism parallelism) {
+    plant_.set_parallelism(parallelism);
+    EXPECT_EQ(plant_.get_parallelism().num_threads(),
+              parallelism.num_threads());
+    std::unique_ptr<Context<double>> context = plant_.CreateDefaultContext();
+    plant_.SetPositionsAndVelocities(context.get(), x_);
+
+    const int nv = plant_.num_velocities();
+    Results results;
+    results.M.resize(nv, nv);
+    plant_.CalcMassMatrix(*context, &results.M);
+    const MultibodyForces<double> forces(plant_);
+    results.tau_id = plant_.CalcInverseDynamics(
+        *context, VectorX<double>::LinSpaced(nv, 0.1, 1.0), forces);
+    results.vdot =
+        plant_.get_generalized_acceleration_output_port().Eval(*context);
+    const RigidBody<double>& last_link = plant_.GetBodyByName(
+        fmt::format("link_{}_{}", kNumChains - 1, kNumChains - 1));
+    results.V_WB = plant_.EvalBodySpatialVelocityInWorld(*context, last_link);
+    return results;
+  }
+
+  MultibodyPlant<double> plant_{0.0};
+  VectorX<double> x_;
+};
+
+TEST_F(MultibodyPlantParallelismTest, MatchesSerial) {
+  const Results expected = Calc(Parallelism::None());
+  for (int num_threads : {2, 4}) {
+    const Results results = Calc(Parallelism(num_threads));
+    EXPECT_TRUE(CompareMatrices(results.M, expected.M, kTolerance));
+    EXPECT_TRUE(CompareMatrices(results.tau_id, expected.tau_id, kTolerance));
+    EXPECT_TRUE(CompareMatrices(results.vdot, expected.vdot, kTolerance));
+    EXPECT_TRUE(results.V_WB.IsApprox(expected.V_WB, kTolerance));
+  }
+}
+
+TEST_F(MultibodyPlantParallelismTest, ScalarConversion) {
+  plant_.set_parallelism(Parallelism(3));
+  const auto autodiff_plant = systems::System<double>::ToAutoDiffXd(plant_);
+  EXPECT_EQ(autodiff_plant->get_parallelism().num_threads(), 3);
+  const auto symbolic_plant = systems::System<double>::ToSymbolic(plant_);
+  EXPECT_EQ(symbolic_plant->get_parallelism().num_threads(), 3);
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,6 @@
+#include "drake/multibody/tree/articulated_body_algorithm_scratch.h"
+
+#include "drake/common/default_scalars.h"
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::multibody::internal::ArticulatedBodyAlgorithmScratch);
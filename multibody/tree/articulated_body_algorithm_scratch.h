@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/multibody/math/spatial_algebra.h"
+#include "drake/multibody/topology/forest.h"
+#include "drake/multibody/tree/articulated_body_force_cache.h"
+#include "drake/multibody/tree/articulated_body_inertia_cache.h"
+#include "drake/multibody/tree/multibody_tree_indexes.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+// Unlike the other classes in this library, this class is NOT a cache entry in
+// the Context. It is caller-owned workspace for
+// MultibodyTree::CalcForwardDynamicsFused(), which performs the Articulated
+// Body Algorithm (ABA) without storing its intermediate results in cache
+// entries. Once constructed for a given SpanningForest, the same scratch can be
+// reused for any number of forward dynamics computations without heap
+// allocation. The contents are only meaningful to CalcForwardDynamicsFused()
+// and are overwritten by each call.
+//
+// Please refer to @ref internal_forward_dynamics
+// "Articulated Body Algorithm Forward Dynamics" for the meaning of the
+// quantities stored here.
+//
+// @tparam_default_scalar
+template <typename T>
+class ArticulatedBodyAlgorithmScratch {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ArticulatedBodyAlgorithmScratch);
+
+  // Constructs scratch storage properly sized for a model with the given
+  // `forest`.
+  explicit ArticulatedBodyAlgorithmScratch(
+      const internal::SpanningForest& forest)
+      : abic(forest),
+        aba_force_cache(forest),
+        Ab_WB(forest.num_mobods()),
+        Fb_Bo_W(forest.num_mobods()),
+        Zb_Bo_W(forest.num_mobods()) {}
+
+  // Returns the number of mobilized bodies this scratch was sized for.
+  int num_mobods() const { return static_cast<int>(Ab_WB.size()); }
+
+  // Configuration dependent ABA quantities, including P_B_W and Pplus_PB_W.
+  ArticulatedBodyInertiaCache<T> abic;
+
+  // State and force dependent ABA quantities Zplus_PB_W and e_B.
+  ArticulatedBodyForceCache<T> aba_force_cache;
+
+  // Pools indexed by MobodIndex.
+  // Spatial acceleration bias Ab_WB(q, v).
+  std::vector<SpatialAcceleration<T>> Ab_WB;
+  // Dynamic (gyroscopic) bias force Fb_Bo_W(q, v).
+  std::vector<SpatialForce<T>> Fb_Bo_W;
+  // Articulated body force bias Zb_Bo_W = Pplus_PB_W * Ab_WB.
+  std::vector<SpatialForce<T>> Zb_Bo_W;
+};
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::internal::ArticulatedBodyAlgorithmScratch);
@@ -0,0 +1,151 @@
+#include "drake/multibody/tree/mass_matrix_factorization.h"
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_bool.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/extract_double.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+template <typename T>
+MassMatrixFactorization<T>::MassMatrixFactorization(
+    const SpanningForest& forest)
+    : parent_velocity_(forest.num_velocities(), -1),
+      LD_(forest.num_velocities(), forest.num_velocities()) {
+  for (const SpanningForest::Mobod& mobod : forest.mobods()) {
+    if (mobod.is_world() || mobod.nv() == 0) continue;
+
+    // The first velocity of this mobod has as its parent the last velocity of
+    // the nearest inboard mobod that has any velocities. Welded (zero
+    // velocity) mobods are skipped. If there is none, this is the first
+    // velocity of its tree.
+    const SpanningForest::Mobod* ancestor =
+        &forest.mobods(mobod.inboard_mobod());
+    while (!ancestor->is_world() && ancestor->nv() == 0) {
+      ancestor = &forest.mobods(ancestor->inboard_mobod());
+    }
+    const int v_start = mobod.v_start();
+    if (!ancestor->is_world()) {
+      parent_velocity_[v_start] = ancestor->v_start() + ancestor->nv() - 1;
+    }
+
+    // Within a mobilizer the velocities form a chain.
+    for (int i = 1; i < mobod.nv(); ++i) {
+      parent_velocity_[v_start + i] = v_start + i - 1;
+    }
+  }
+  for (int i = 0; i < size(); ++i) {
+    DRAKE_DEMAND(parent_velocity_[i] < i);
+  }
+}
+
+template <typename T>
+void MassMatrixFactorization<T>::Factor(const Eigen::Ref<const MatrixX<T>>& M) {
+  DRAKE_THROW_UNLESS(M.rows() == size() && M.cols() == size());
+  LD_.template triangularView<Eigen::Lower>() = M;
+  FactorInPlace();
+}
+
+template <typename T>
+void MassMatrixFactorization<T>::FactorInPlace() {
+  DRAKE_THROW_UNLESS(LD_.rows() == size() && LD_.cols() == size());
+  const std::vector<int>& lambda = parent_velocity_;
+  // This is Table 6.3 in [Featherstone 2008]. All descendants of k have an
+  // index larger than k, so that by the time we reach k its diagonal entry
+  // already holds the final value D(k).
+  for (int k = size() - 1; k >= 0; --k) {
+    const T& D_k = LD_(k, k);
+    if constexpr (scalar_predicate<T>::is_bool) {
+      if (!(D_k > 0.0)) {
+        throw std::runtime_error(fmt::format(
+            "MassMatrixFactorization: the mass matrix is not positive "
+            "definite. The pivot for velocity {} is {}. This is typically "
+            "caused by massless bodies at the end of a kinematic chain.",
+            k, ExtractDoubleOrThrow(D_k)));
+      }
+    }
+    for (int i = lambda[k]; i != -1; i = lambda[i]) {
+      const T a = LD_(k, i) / D_k;
+      for (int j = i; j != -1; j = lambda[j]) {
+        LD_(i, j) -= a * LD_(k, j);
+      }
+      LD_(k, i) = a;
+    }
+  }
+  is_factored_ = true;
+}
+
+template <typename T>
+template <typename Derived>
+void MassMatrixFactorization<T>::SolveColumnInPlace(
+    Eigen::MatrixBase<Derived>* b_ptr) const {
+  Eigen::MatrixBase<Derived>& b = *b_ptr;
+  const std::vector<int>& lambda = parent_velocity_;
+  // Solve Lᵀ⋅y = b, tip-to-base.
+  for (int i = size() - 1; i >= 0; --i) {
+    for (int j = lambda[i]; j != -1; j = lambda[j]) {
+      b(j) -= LD_(i, j) * b(i);
+    }
+  }
+  // Solve D⋅z = y.
+  for (int i = 0; i < size(); ++i) {
+    b(i) /= LD_(i, i);
+  }
+  // Solve L⋅x = z, base-to-tip.
+  for (int i = 0; i < size(); ++i) {
+    for (int j = lambda[i]; j != -1; j = lambda[j]) {
+      b(i) -= LD_(i, j) * b(j);
+    }
+  }
+}
+
+template <typename T>
+void MassMatrixFactorization<T>::SolveInPlace(EigenPtr<MatrixX<T>> B) const {
+  DRAKE_THROW_UNLESS(B != nullptr);
+  DRAKE_THROW_UNLESS(B->rows() == size());
+  DRAKE_DEMAND(is_factored_);
+  for (int c = 0; c < B->cols(); ++c) {
+    auto b = B->col(c);
+    SolveColumnInPlace(&b);
+  }
+}
+
+template <typename T>
+VectorX<T> MassMatrixFactorization<T>::Solve(
+    const Eigen::Ref<const VectorX<T>>& b) const {
+  DRAKE_THROW_UNLESS(b.size() == size());
+  VectorX<T> x = b;
+  SolveInPlace(&x);
+  return x;
+}
+
+template <typename T>
+VectorX<T> MassMatrixFactorization<T>::D() const {
+  DRAKE_DEMAND(is_factored_);
+  return LD_.diagonal();
+}
+
+template <typename T>
+MatrixX<T> MassMatrixFactorization<T>::L() const {
+  DRAKE_DEMAND(is_factored_);
+  MatrixX<T> L = MatrixX<T>::Identity(size(), size());
+  for (int i = 0; i < size(); ++i) {
+    for (int j = parent_velocity_[i]; j != -1; j = parent_velocity_[j]) {
+      L(i, j) = LD_(i, j);
+    }
+  }
+  return L;
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::internal::MassMatrixFactorization);
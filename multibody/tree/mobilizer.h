@@ -8,6 +8,7 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/random.h"
+#include "drake/common/unused.h"
 #include "drake/multibody/math/spatial_algebra.h"
 #include "drake/multibody/topology/forest.h"
 #include "drake/multibody/tree/frame.h"
@@ -362,6 +363,21 @@ class Mobilizer : public MultibodyElement<T> {
   // Returns `true` if `this` uses a quaternion parameterization of rotations.
   virtual bool has_quaternion_dofs() const { return false; }
 
+  // (Internal use only) Multi-dof mobilizers can be thought of as a sequence
+  // of simpler motions, where the motions applied first carry along the axes
+  // of the motions applied after them. This method returns `true` if the
+  // axis of the motion associated with velocity `k`, i.e., the k-th column of
+  // the across-mobilizer hinge matrix, moves rigidly with the motion
+  // associated with velocity `j` of this same mobilizer. This information is
+  // used by the analytic dynamics derivatives in MultibodyTree.
+  // For instance, for a floating mobilizer the rotation axes (which act about
+  // Mo) are carried along by the translations, while a universal mobilizer's
+  // second axis is carried along by its first rotation.
+  virtual bool velocity_carries_axis(int j, int k) const {
+    unused(j, k);
+    return false;
+  }
+
   // @name         Methods that define the Mobilizer abstraction
   // For inner-loop computations, don't use this API. Use the templatized
   // APIs of the concrete mobilizers.
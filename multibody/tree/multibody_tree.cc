@@ -1,14 +1,17 @@
 #include "drake/multibody/tree/multibody_tree.h"
 
 #include <algorithm>
+#include <exception>
 #include <limits>
 #include <map>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <unordered_set>
 #include <utility>
 
+#include <common_robotics_utilities/parallelism.hpp>
 #include <fmt/ranges.h>
 
 #include "drake/common/drake_assert.h"
@@ -34,6 +37,9 @@ namespace drake {
 namespace multibody {
 namespace internal {
 
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
 using internal::BodyNode;
 using internal::BodyNodeWorld;
 using math::RigidTransform;
@@ -417,6 +423,55 @@ const auto& GetElementByName(const MultibodyTree<T>& tree,
   return GetElementByIndex(tree, lower->second);
 }
 
+// Helpers for CalcInverseDynamicsAndDerivativesAboutWorldOrigin(). Spatial
+// vectors are stored as 6-vectors with the rotational component first and are
+// measured about the world origin Wo, i.e., these are the Plücker vectors of
+// [Featherstone 2008], rather than Drake's SpatialVelocity and SpatialForce.
+//
+// - [Featherstone 2008] Featherstone, R., 2008. Rigid body dynamics
+//                       algorithms. Springer.
+
+// Returns the spatial cross product a ×ᵐ b of motion vectors a and b.
+template <typename T>
+Vector6<T> CrossMotion(const Vector6<T>& a, const Vector6<T>& b) {
+  Vector6<T> result;
+  result.template head<3>() = a.template head<3>().cross(b.template head<3>());
+  result.template tail<3>() =
+      a.template head<3>().cross(b.template tail<3>()) +
+      a.template tail<3>().cross(b.template head<3>());
+  return result;
+}
+
+// Returns the spatial cross product m ×* f of motion vector m and force
+// vector f.
+template <typename T>
+Vector6<T> CrossForce(const Vector6<T>& m, const Vector6<T>& f) {
+  Vector6<T> result;
+  result.template head<3>() =
+      m.template head<3>().cross(f.template head<3>()) +
+      m.template tail<3>().cross(f.template tail<3>());
+  result.template tail<3>() = m.template head<3>().cross(f.template tail<3>());
+  return result;
+}
+
+// When a rigid body with spatial inertia I moves with spatial velocity s, the
+// rate of change of I (measured about the fixed world origin) is
+// İ = s ×* I - I s ×ᵐ. Returns İ⋅x.
+template <typename T>
+Vector6<T> InertiaRateTimes(const Vector6<T>& s, const Matrix6<T>& I,
+                            const Vector6<T>& x) {
+  return CrossForce<T>(s, I * x) - I * CrossMotion<T>(s, x);
+}
+
+// Returns the world-origin force vector of a force f applied at a point P.
+// The moment is m_Wo = p_WoP × f.
+template <typename T>
+Vector6<T> ForceAtPoint(const Vector3<T>& p_WoP, const Vector3<T>& f) {
+  Vector6<T> result;
+  result << p_WoP.cross(f), f;
+  return result;
+}
+
 }  // namespace
 
 template <typename T>
@@ -864,15 +919,6 @@ void MultibodyTree<T>::FinalizeInternals() {
     actuators_.get_mutable_element(actuator_index).SetTopology();
   }
 
-  // TODO(sherm1) Consider building the level collection while building the
-  //  spanning forest.
-  body_node_levels_.resize(forest().height());
-  for (MobodIndex mobod_index(1); mobod_index < forest().num_mobods();
-       ++mobod_index) {
-    const SpanningForest::Mobod& mobod = forest().mobods(mobod_index);
-    body_node_levels_[mobod.level()].push_back(mobod_index);
-  }
-
   // Creates BodyNodes:
   // This recursion order ensures that a BodyNode's parent is created before the
   // node itself, since BodyNode objects are in Depth First Traversal order.
@@ -1400,9 +1446,55 @@ void MultibodyTree<T>::CalcAllLinkSpatialVelocitiesInWorld(
   }
 }
 
+template <typename T>
+template <typename TreeFunction>
+void MultibodyTree<T>::ForEachTree(const TreeFunction& tree_function) const {
+  const std::vector<SpanningForest::Tree>& trees = forest().trees();
+  const int num_trees = ssize(trees);
+  // Only double and AutoDiffXd are safe to evaluate concurrently.
+  if constexpr (scalar_predicate<T>::is_bool) {
+    const int num_threads = std::min(parallelism_.num_threads(), num_trees);
+    if (num_threads > 1) {
+      // Exceptions must not escape a parallel region. Instead, we capture them
+      // and re-throw the first one (in tree order) once all trees are done, so
+      // that the caller sees the same exception as with serial evaluation.
+      std::vector<std::exception_ptr> errors(num_trees);
+      const auto calc_tree = [&](const int, const int64_t index) {
+        try {
+          tree_function(trees[index]);
+        } catch (...) {
+          errors[index] = std::current_exception();
+        }
+      };
+      StaticParallelForIndexLoop(DegreeOfParallelism(num_threads), 0, num_trees,
+                                 calc_tree, ParallelForBackend::BEST_AVAILABLE);
+      for (const std::exception_ptr& error : errors) {
+        if (error != nullptr) std::rethrow_exception(error);
+      }
+      return;
+    }
+  }
+  for (const SpanningForest::Tree& tree : trees) {
+    tree_function(tree);
+  }
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcPositionKinematicsCache(
     const systems::Context<T>& context, PositionKinematicsCache<T>* pc) const {
+  CalcPositionKinematicsCacheImpl(context, false, pc);
+}
+
+template <typename T>
+void MultibodyTree<T>::UpdatePositionKinematicsCacheEntry(
+    const systems::Context<T>& context, PositionKinematicsCache<T>* pc) const {
+  CalcPositionKinematicsCacheImpl(context, true, pc);
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcPositionKinematicsCacheImpl(
+    const systems::Context<T>& context, bool is_cache_entry,
+    PositionKinematicsCache<T>* pc) const {
   DRAKE_DEMAND(pc != nullptr);
 
   // Ensure parameter-dependent quantities are up to date.
@@ -1431,15 +1523,48 @@ void MultibodyTree<T>::CalcPositionKinematicsCache(
   // information for each body, we are now in position to perform a base-to-tip
   // recursion to update world positions and parent to child body transforms.
   // This skips the world, level = 0.
-  // Performs a base-to-tip recursion computing body poses.
-  // Skip the World which is mobod_index(0).
-  for (MobodIndex mobod_index(1); mobod_index < num_mobods(); ++mobod_index) {
-    const BodyNode<T>& node = *body_nodes_[mobod_index];
-    DRAKE_ASSERT(node.mobod_index() == mobod_index);
+  // Performs a base-to-tip recursion computing body poses, one tree at a time.
+  // Trees never include the World, which is mobod_index(0).
+  //
+  // When T = double, `pc` is the cache entry of this very context, and its
+  // per-mobod results were last computed with the current FrameBodyPoseCache,
+  // only the subtrees outboard of mobilizers whose positions changed are
+  // recomputed; since mobods are numbered in depth-first order, the subtree of
+  // mobod B is the contiguous range [B, B + num_subtree_mobods). Otherwise,
+  // everything is recomputed. (A caller-owned `pc` might have last been
+  // computed with another context whose FrameBodyPoseCache happens to have the
+  // same serial number, so we never trust it.)
+  const bool incremental =
+      std::is_same_v<T, double> && is_cache_entry &&
+      pc->kinematics_serial_number() == fbpc_serial_number;
+  // Mark the results as unknown until the update completes, so that an
+  // interrupted update is never mistaken for a consistent one.
+  pc->set_kinematics_serial_number(-1);
+  ForEachTree([&](const SpanningForest::Tree& tree) {
+    // Mobods in [tree.base_mobod(), dirty_end) that follow the one being
+    // visited are outboard of a mobilizer whose positions changed.
+    MobodIndex dirty_end = tree.base_mobod();
+    for (MobodIndex mobod_index = tree.base_mobod();
+         mobod_index <= tree.last_mobod(); ++mobod_index) {
+      const BodyNode<T>& node = *body_nodes_[mobod_index];
+      DRAKE_ASSERT(node.mobod_index() == mobod_index);
 
-    // Update per-node kinematics.
-    node.CalcPositionKinematicsCache_BaseToTip(frame_body_pose_cache, q, pc);
-  }
+      if constexpr (std::is_same_v<T, double>) {
+        const SpanningForest::Mobod& mobod = forest().mobods(mobod_index);
+        const bool changed = pc->UpdatePositionsIfChanged(
+            mobod.q_start(), mobod.nq(), q + mobod.q_start());
+        if (changed || !incremental) {
+          dirty_end = std::max(
+              dirty_end, MobodIndex(mobod_index + mobod.num_subtree_mobods()));
+        }
+        if (mobod_index >= dirty_end) continue;
+      }
+
+      // Update per-node kinematics.
+      node.CalcPositionKinematicsCache_BaseToTip(frame_body_pose_cache, q, pc);
+    }
+  });
+  pc->set_kinematics_serial_number(is_cache_entry ? fbpc_serial_number : -1);
 }
 
 template <typename T>
@@ -1533,16 +1658,19 @@ void MultibodyTree<T>::CalcVelocityKinematicsCache(
   const T* positions = get_positions(context).data();
   const T* velocities = get_velocities(context).data();
 
-  // Performs a base-to-tip recursion computing body velocities.
-  // Skip the World which is mobod_index(0).
-  for (MobodIndex mobod_index(1); mobod_index < num_mobods(); ++mobod_index) {
-    const BodyNode<T>& node = *body_nodes_[mobod_index];
-    DRAKE_ASSERT(node.mobod_index() == mobod_index);
+  // Performs a base-to-tip recursion computing body velocities, one tree at a
+  // time. Trees never include the World, which is mobod_index(0).
+  ForEachTree([&](const SpanningForest::Tree& tree) {
+    for (MobodIndex mobod_index = tree.base_mobod();
+         mobod_index <= tree.last_mobod(); ++mobod_index) {
+      const BodyNode<T>& node = *body_nodes_[mobod_index];
+      DRAKE_ASSERT(node.mobod_index() == mobod_index);
 
-    // Update per-mobod kinematics.
-    node.CalcVelocityKinematicsCache_BaseToTip(positions, pc, H_PB_W_cache,
-                                               velocities, vc);
-  }
+      // Update per-mobod kinematics.
+      node.CalcVelocityKinematicsCache_BaseToTip(positions, pc, H_PB_W_cache,
+                                                 velocities, vc);
+    }
+  });
 }
 
 // Result is indexed by MobodIndex, not LinkIndex (or BodyIndex).
@@ -1784,16 +1912,19 @@ void MultibodyTree<T>::CalcCompositeBodyInertiasInWorld(
   const std::vector<SpatialInertia<T>>& M_BBo_W_all =
       EvalSpatialInertiaInWorldCache(context);
 
-  // Perform tip-to-base recursion for each composite body, skipping the world.
-  for (MobodIndex mobod_index(num_mobods() - 1); mobod_index > 0;
-       --mobod_index) {
-    // Node corresponding to the base of composite body C. We'll add in
-    // everything outboard of this node.
-    const BodyNode<T>& composite_node = *body_nodes_[mobod_index];
-
-    composite_node.CalcCompositeBodyInertiaInWorld_TipToBase(pc, M_BBo_W_all,
-                                                             &*K_BBo_W_all);
-  }
+  // Perform tip-to-base recursion for each composite body, one tree at a time.
+  // Trees never include the World.
+  ForEachTree([&](const SpanningForest::Tree& tree) {
+    for (MobodIndex mobod_index = tree.last_mobod();
+         mobod_index >= tree.base_mobod(); --mobod_index) {
+      // Node corresponding to the base of composite body C. We'll add in
+      // everything outboard of this node.
+      const BodyNode<T>& composite_node = *body_nodes_[mobod_index];
+
+      composite_node.CalcCompositeBodyInertiaInWorld_TipToBase(
+          pc, M_BBo_W_all, &*K_BBo_W_all);
+    }
+  });
 }
 
 template <typename T>
@@ -1930,17 +2061,20 @@ void MultibodyTree<T>::CalcSpatialAccelerationsFromVdot(
       ignore_velocities ? nullptr : get_velocities(context).data();
   const T* const accelerations = known_vdot.data();
 
-  // Performs a base-to-tip recursion computing body accelerations. World was
-  // handled above so is skipped here.
-  for (MobodIndex mobod_index{1}; mobod_index < num_mobods(); ++mobod_index) {
-    const BodyNode<T>& node = *body_nodes_[mobod_index];
-    DRAKE_ASSERT(node.mobod_index() == mobod_index);
+  // Performs a base-to-tip recursion computing body accelerations, one tree at
+  // a time. World was handled above and is not part of any tree.
+  ForEachTree([&](const SpanningForest::Tree& tree) {
+    for (MobodIndex mobod_index = tree.base_mobod();
+         mobod_index <= tree.last_mobod(); ++mobod_index) {
+      const BodyNode<T>& node = *body_nodes_[mobod_index];
+      DRAKE_ASSERT(node.mobod_index() == mobod_index);
 
-    // Update per-node kinematics.
-    node.CalcSpatialAcceleration_BaseToTip(frame_body_pose_cache, positions, pc,
-                                           velocities, vc, accelerations,
-                                           &*A_WB_array);
-  }
+      // Update per-node kinematics.
+      node.CalcSpatialAcceleration_BaseToTip(frame_body_pose_cache, positions,
+                                             pc, velocities, vc, accelerations,
+                                             &*A_WB_array);
+    }
+  });
 }
 
 template <typename T>
@@ -2027,15 +2161,12 @@ void MultibodyTree<T>::CalcInverseDynamics(
   const T* const positions = get_positions(context).data();
 
   // Performs a tip-to-base recursion computing the total spatial force F_BMo_W
-  // acting on body B, about point Mo, expressed in the world frame W.
-  // This includes the world (depth = 0) so that
-  // F_BMo_W_array[world_mobod_index()] contains the total force of the bodies
-  // connected to the world by a mobilizer.
-  for (int level = forest_height() - 1; level >= 0; --level) {
-    for (MobodIndex mobod_index : body_node_levels_[level]) {
+  // acting on body B, about point Mo, expressed in the world frame W, one tree
+  // at a time. Trees never include the World.
+  ForEachTree([&](const SpanningForest::Tree& tree) {
+    for (MobodIndex mobod_index = tree.last_mobod();
+         mobod_index >= tree.base_mobod(); --mobod_index) {
       const BodyNode<T>& node = *body_nodes_[mobod_index];
-
-      DRAKE_ASSERT(node.mobod().level() == level);
       DRAKE_ASSERT(node.mobod_index() == mobod_index);
 
       // Compute F_BMo_W for the body associated with this node and project it
@@ -2048,7 +2179,7 @@ void MultibodyTree<T>::CalcInverseDynamics(
           tau_applied_array,          // null if no applied generalized forces
           F_BMo_W_array, tau_array);  // outputs
     }
-  }
+  });
 
   // Add the effect of reflected inertias.
   // See JointActuator::reflected_inertia().
@@ -2309,6 +2440,290 @@ void MultibodyTree<T>::CalcMassMatrix(const systems::Context<T>& context,
   M->diagonal() += reflected_inertia;
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcMassMatrixFactorization(
+    const systems::Context<T>& context,
+    MassMatrixFactorization<T>* factorization) const {
+  DRAKE_DEMAND(factorization != nullptr);
+  DRAKE_DEMAND(factorization->size() == num_velocities());
+  CalcMassMatrix(context, &factorization->mutable_matrix());
+  factorization->FactorInPlace();
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcInverseDynamicsDerivatives(
+    const systems::Context<T>& context, const VectorX<T>& known_vdot,
+    const MultibodyForces<T>& external_forces, EigenPtr<MatrixX<T>> dtau_dq,
+    EigenPtr<MatrixX<T>> dtau_dv, EigenPtr<MatrixX<T>> dtau_dvdot) const {
+  const int nv = num_velocities();
+  DRAKE_DEMAND(dtau_dvdot != nullptr);
+  DRAKE_DEMAND(dtau_dvdot->rows() == nv && dtau_dvdot->cols() == nv);
+  VectorX<T> tau(nv);
+  CalcInverseDynamicsAndDerivativesAboutWorldOrigin(
+      context, known_vdot, external_forces, &tau, dtau_dq, dtau_dv);
+  // Inverse dynamics is linear in v̇, with ∂τ/∂v̇ = M(q).
+  CalcMassMatrix(context, dtau_dvdot);
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcForwardDynamicsDerivatives(
+    const systems::Context<T>& context, const MultibodyForces<T>& forces,
+    EigenPtr<VectorX<T>> vdot, EigenPtr<MatrixX<T>> dvdot_dq,
+    EigenPtr<MatrixX<T>> dvdot_dv, EigenPtr<MatrixX<T>> dvdot_dtau) const {
+  const int nv = num_velocities();
+  DRAKE_DEMAND(vdot != nullptr && vdot->size() == nv);
+  DRAKE_DEMAND(dvdot_dtau != nullptr);
+  DRAKE_DEMAND(dvdot_dtau->rows() == nv && dvdot_dtau->cols() == nv);
+
+  // Forward dynamics v̇(q, v, τ) is the solution of ID(q, v, v̇, τ) = 0, where
+  // ID is the residual computed by inverse dynamics. Since ID is linear in v̇
+  // with ∂ID/∂v̇ = M, we have v̇ = -M⁻¹⋅ID(q, v, 0, τ) and, by the implicit
+  // function theorem, ∂v̇/∂x = -M⁻¹⋅∂ID/∂x evaluated at the solution v̇, for
+  // x = q, v, τ. With ∂ID/∂τ = -I, that is ∂v̇/∂τ = M⁻¹.
+  MassMatrixFactorization<T> factorization(forest());
+  CalcMassMatrixFactorization(context, &factorization);
+
+  VectorX<T> tau(nv);
+  CalcInverseDynamicsAndDerivativesAboutWorldOrigin(
+      context, VectorX<T>::Zero(nv), forces, &tau, nullptr, nullptr);
+  *vdot = -factorization.Solve(tau);
+
+  CalcInverseDynamicsAndDerivativesAboutWorldOrigin(
+      context, *vdot, forces, &tau, dvdot_dq, dvdot_dv);
+  *dvdot_dq *= -1;
+  factorization.SolveInPlace(dvdot_dq);
+  *dvdot_dv *= -1;
+  factorization.SolveInPlace(dvdot_dv);
+  dvdot_dtau->setIdentity();
+  factorization.SolveInPlace(dvdot_dtau);
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcInverseDynamicsAndDerivativesAboutWorldOrigin(
+    const systems::Context<T>& context, const VectorX<T>& known_vdot,
+    const MultibodyForces<T>& forces, EigenPtr<VectorX<T>> tau,
+    EigenPtr<MatrixX<T>> dtau_dq, EigenPtr<MatrixX<T>> dtau_dv) const {
+  const int nv = num_velocities();
+  const int nb = num_mobods();
+  DRAKE_DEMAND(known_vdot.size() == nv);
+  DRAKE_DEMAND(forces.CheckHasRightSizeForModel(*this));
+  DRAKE_DEMAND(tau != nullptr && tau->size() == nv);
+  const bool with_derivatives = dtau_dq != nullptr;
+  DRAKE_DEMAND(with_derivatives == (dtau_dv != nullptr));
+
+  // This is the recursive Newton-Euler algorithm written in terms of spatial
+  // vectors measured about the world origin Wo, see [Featherstone 2008]. In
+  // these coordinates the hinge matrix columns of a mobod and the spatial
+  // inertia of its body are simply carried along by any rigid motion of the
+  // subtree they belong to. Therefore the partial derivative of every quantity
+  // in the recursion with respect to the configuration (or velocity) of mobod
+  // B is computed with one additional base-to-tip pass over the subtree of B
+  // followed by a tip-to-base pass to the base of the tree, as described in
+  // [Carpentier and Mansard, 2018].
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const FrameBodyPoseCache<T>& fbpc = EvalFrameBodyPoses(context);
+  const std::vector<SpatialInertia<T>>& M_B_W_cache =
+      EvalSpatialInertiaInWorldCache(context);
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      EvalAcrossNodeJacobianWrtVExpressedInWorld(context);
+  const VectorX<T>& reflected_inertia = EvalReflectedInertiaCache(context);
+  const auto v = get_velocities(context);
+  const std::vector<SpatialForce<T>>& Fapplied_Bo_W_array =
+      forces.body_forces();
+  const VectorX<T>& tau_applied = forces.generalized_forces();
+  const Vector3<T> g_W =
+      gravity_field_ != nullptr
+          ? Vector3<T>(gravity_field().gravity_vector().template cast<T>())
+          : Vector3<T>::Zero();
+
+  // Quantities indexed by MobodIndex. Entries for the World remain zero.
+  // Gravity on the links following a mobod is accounted for with their total
+  // mass and first mass moment about Wo, m⋅p_WoLcm.
+  std::vector<Vector3<T>> p_WBo(nb, Vector3<T>::Zero());
+  std::vector<Matrix6<T>> I_Wo(nb, Matrix6<T>::Zero());
+  std::vector<T> gravity_mass(nb, T(0));
+  std::vector<Vector3<T>> gravity_moment(nb, Vector3<T>::Zero());
+  // Across-mobilizer velocity, split into the motions of the leading and
+  // trailing velocities, see Mobilizer::velocity_carries_axis().
+  std::vector<Vector6<T>> u(nb, Vector6<T>::Zero());
+  std::vector<Vector6<T>> u_leading(nb, Vector6<T>::Zero());
+  std::vector<Vector6<T>> u_trailing(nb, Vector6<T>::Zero());
+  std::vector<Vector6<T>> V(nb, Vector6<T>::Zero());
+  std::vector<Vector6<T>> A(nb, Vector6<T>::Zero());
+  // After the tip-to-base pass, F[B] is the total force transmitted across
+  // B's mobilizer.
+  std::vector<Vector6<T>> F(nb, Vector6<T>::Zero());
+  // Hinge matrix columns about Wo, indexed by velocity.
+  Matrix6X<T> S(6, nv);
+  std::vector<int> is_leading(nv, 0);
+
+  ForEachTree([&](const SpanningForest::Tree& tree) {
+    for (MobodIndex i = tree.base_mobod(); i <= tree.last_mobod(); ++i) {
+      const SpanningForest::Mobod& mobod = forest().mobods(i);
+      const MobodIndex parent = mobod.inboard_mobod();
+      const Mobilizer<T>& mobilizer = body_nodes_[i]->get_mobilizer();
+
+      p_WBo[i] = pc.get_X_WB(i).translation();
+      I_Wo[i] = M_B_W_cache[i].Shift(-p_WBo[i]).CopyToFullMatrix6();
+      if (gravity_field_ != nullptr) {
+        for (const LinkOrdinal& ordinal : mobod.follower_link_ordinals()) {
+          const ModelInstanceIndex model_instance =
+              graph().links(ordinal).model_instance();
+          if (!gravity_field().is_enabled(model_instance)) continue;
+          const T& mass = fbpc.get_M_LLo_L(ordinal).get_mass();
+          gravity_mass[i] += mass;
+          gravity_moment[i] +=
+              mass * (p_WBo[i] + pc.get_R_WB(i) * fbpc.get_p_BoLcm_B(ordinal));
+        }
+      }
+
+      Vector6<T> S_vdot = Vector6<T>::Zero();
+      for (int k = mobod.v_start(); k < mobod.v_start() + mobod.nv(); ++k) {
+        const Vector6<T>& H = H_PB_W_cache[k];
+        S.col(k) << H.template head<3>(),
+            H.template tail<3>() + p_WBo[i].cross(H.template head<3>());
+        for (int m = 0; m < mobod.nv(); ++m) {
+          if (mobilizer.velocity_carries_axis(k - mobod.v_start(), m)) {
+            is_leading[k] = 1;
+          }
+        }
+        u[i] += S.col(k) * v(k);
+        (is_leading[k] ? u_leading[i] : u_trailing[i]) += S.col(k) * v(k);
+        S_vdot += S.col(k) * known_vdot(k);
+      }
+      V[i] = V[parent] + u[i];
+      A[i] = A[parent] + S_vdot + CrossMotion<T>(V[parent], u[i]) +
+             CrossMotion<T>(u_leading[i], u_trailing[i]);
+
+      const SpatialForce<T>& Fapplied_Bo_W = Fapplied_Bo_W_array[i];
+      Vector6<T> Fapplied_Wo;
+      Fapplied_Wo << Fapplied_Bo_W.rotational() +
+                         p_WBo[i].cross(Fapplied_Bo_W.translational()) +
+                         gravity_moment[i].cross(g_W),
+          Fapplied_Bo_W.translational() + gravity_mass[i] * g_W;
+      F[i] = I_Wo[i] * A[i] + CrossForce<T>(V[i], I_Wo[i] * V[i]) -
+             Fapplied_Wo;
+    }
+
+    for (MobodIndex i = tree.last_mobod(); i >= tree.base_mobod(); --i) {
+      const SpanningForest::Mobod& mobod = forest().mobods(i);
+      for (int k = mobod.v_start(); k < mobod.v_start() + mobod.nv(); ++k) {
+        (*tau)(k) = S.col(k).dot(F[i]) + reflected_inertia(k) * known_vdot(k) -
+                    tau_applied(k);
+      }
+      if (i != tree.base_mobod()) F[mobod.inboard_mobod()] += F[i];
+    }
+  });
+
+  if (!with_derivatives) return;
+  DRAKE_DEMAND(dtau_dq->rows() == nv && dtau_dq->cols() == nv);
+  DRAKE_DEMAND(dtau_dv->rows() == nv && dtau_dv->cols() == nv);
+  dtau_dq->setZero();
+  dtau_dv->setZero();
+
+  // Partial derivatives of V, A and F along a single direction, indexed by
+  // MobodIndex, and of the hinge matrix columns, indexed by velocity. Each
+  // tree only touches its own entries.
+  std::vector<Vector6<T>> dV(nb, Vector6<T>::Zero());
+  std::vector<Vector6<T>> dA(nb, Vector6<T>::Zero());
+  std::vector<Vector6<T>> dF(nb, Vector6<T>::Zero());
+  Matrix6X<T> dS = Matrix6X<T>::Zero(6, nv);
+
+  ForEachTree([&](const SpanningForest::Tree& tree) {
+    for (MobodIndex b = tree.base_mobod(); b <= tree.last_mobod(); ++b) {
+      const SpanningForest::Mobod& mobod_b = forest().mobods(b);
+      const Mobilizer<T>& mobilizer_b = body_nodes_[b]->get_mobilizer();
+      const MobodIndex subtree_end(b + mobod_b.num_subtree_mobods());
+
+      for (int j = mobod_b.v_start(); j < mobod_b.v_start() + mobod_b.nv();
+           ++j) {
+        // A perturbation of the configuration along velocity j moves the
+        // subtree of B rigidly with spatial velocity S_j.
+        const Vector6<T> S_j = S.col(j);
+        const Vector3<T> w_j = S_j.template head<3>();
+        const Vector3<T> v_j = S_j.template tail<3>();
+
+        for (const bool wrt_q : {true, false}) {
+          // Base-to-tip over the subtree of B.
+          for (MobodIndex i = b; i < subtree_end; ++i) {
+            const SpanningForest::Mobod& mobod = forest().mobods(i);
+            const MobodIndex parent = mobod.inboard_mobod();
+            Vector6<T> du = Vector6<T>::Zero();
+            Vector6<T> du_leading = Vector6<T>::Zero();
+            Vector6<T> du_trailing = Vector6<T>::Zero();
+            Vector6<T> dS_vdot = Vector6<T>::Zero();
+            if (wrt_q) {
+              for (int k = mobod.v_start(); k < mobod.v_start() + mobod.nv();
+                   ++k) {
+                // B's own hinge columns only move with its leading velocities.
+                if (i != b || mobilizer_b.velocity_carries_axis(
+                                  j - mobod_b.v_start(), k - mobod.v_start())) {
+                  dS.col(k) = CrossMotion<T>(S_j, S.col(k));
+                } else {
+                  dS.col(k).setZero();
+                }
+                du += dS.col(k) * v(k);
+                (is_leading[k] ? du_leading : du_trailing) += dS.col(k) * v(k);
+                dS_vdot += dS.col(k) * known_vdot(k);
+              }
+            } else if (i == b) {
+              du = S_j;
+              (is_leading[j] ? du_leading : du_trailing) = S_j;
+            }
+            const Vector6<T> dV_parent =
+                i == b ? Vector6<T>::Zero() : Vector6<T>(dV[parent]);
+            const Vector6<T> dA_parent =
+                i == b ? Vector6<T>::Zero() : Vector6<T>(dA[parent]);
+            dV[i] = dV_parent + du;
+            dA[i] = dA_parent + dS_vdot + CrossMotion<T>(dV_parent, u[i]) +
+                    CrossMotion<T>(V[parent], du) +
+                    CrossMotion<T>(du_leading, u_trailing[i]) +
+                    CrossMotion<T>(u_leading[i], du_trailing);
+
+            const Matrix6<T>& I = I_Wo[i];
+            Vector6<T> df = I * dA[i] + CrossForce<T>(dV[i], I * V[i]) +
+                            CrossForce<T>(V[i], I * dV[i]);
+            if (wrt_q) {
+              df += InertiaRateTimes<T>(S_j, I, A[i]) +
+                    CrossForce<T>(V[i], InertiaRateTimes<T>(S_j, I, V[i]));
+              // Applied forces are fixed in the world while their points of
+              // application move with the subtree.
+              const Vector3<T>& f_Bo_W = Fapplied_Bo_W_array[i].translational();
+              df.template head<3>() -=
+                  (v_j + w_j.cross(p_WBo[i])).cross(f_Bo_W) +
+                  (gravity_mass[i] * v_j + w_j.cross(gravity_moment[i]))
+                      .cross(g_W);
+            }
+            dF[i] = df;
+          }
+
+          // Tip-to-base over the subtree of B, then along the path from B to
+          // the base of its tree. Generalized forces elsewhere don't change.
+          auto& dtau = wrt_q ? *dtau_dq : *dtau_dv;
+          for (MobodIndex i(subtree_end - 1); i >= b; --i) {
+            const SpanningForest::Mobod& mobod = forest().mobods(i);
+            for (int k = mobod.v_start(); k < mobod.v_start() + mobod.nv();
+                 ++k) {
+              dtau(k, j) = S.col(k).dot(dF[i]);
+              if (wrt_q) dtau(k, j) += dS.col(k).dot(F[i]);
+            }
+            if (i != b) dF[mobod.inboard_mobod()] += dF[i];
+          }
+          for (MobodIndex a = mobod_b.inboard_mobod();
+               !forest().mobods(a).is_world();
+               a = forest().mobods(a).inboard_mobod()) {
+            const SpanningForest::Mobod& mobod = forest().mobods(a);
+            for (int k = mobod.v_start(); k < mobod.v_start() + mobod.nv();
+                 ++k) {
+              dtau(k, j) = S.col(k).dot(dF[b]);
+            }
+          }
+        }
+      }
+    }
+  });
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcBiasTerm(const systems::Context<T>& context,
                                     EigenPtr<VectorX<T>> Cv) const {
@@ -4054,9 +4469,10 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
   const std::vector<SpatialInertia<T>>& spatial_inertia_in_world_cache =
       EvalSpatialInertiaInWorldCache(context);
 
-  // Perform tip-to-base recursion, skipping the world.
-  for (int depth = forest_height() - 1; depth > 0; --depth) {
-    for (MobodIndex mobod_index : body_node_levels_[depth]) {
+  // Perform tip-to-base recursion one tree at a time, skipping the world.
+  ForEachTree([&](const SpanningForest::Tree& tree) {
+    for (MobodIndex mobod_index = tree.last_mobod();
+         mobod_index >= tree.base_mobod(); --mobod_index) {
       const BodyNode<T>& node = *body_nodes_[mobod_index];
 
       // Get hinge matrix and spatial inertia for this node.
@@ -4068,7 +4484,7 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
       node.CalcArticulatedBodyInertiaCache_TipToBase(context, pc, H_PB_W, M_B_W,
                                                      diagonal_inertias, abic);
     }
-  }
+  });
 }
 
 template <typename T>
@@ -4097,9 +4513,10 @@ void MultibodyTree<T>::CalcArticulatedBodyForceCache(
   const std::vector<SpatialForce<T>>& dynamic_bias_cache =
       EvalDynamicBiasCache(context);
 
-  // Perform tip-to-base recursion, skipping the world.
-  for (int depth = forest_height() - 1; depth > 0; --depth) {
-    for (MobodIndex mobod_index : body_node_levels_[depth]) {
+  // Perform tip-to-base recursion one tree at a time, skipping the world.
+  ForEachTree([&](const SpanningForest::Tree& tree) {
+    for (MobodIndex mobod_index = tree.last_mobod();
+         mobod_index >= tree.base_mobod(); --mobod_index) {
       const BodyNode<T>& node = *body_nodes_[mobod_index];
 
       // Get generalized force and body force for this node.
@@ -4118,7 +4535,7 @@ void MultibodyTree<T>::CalcArticulatedBodyForceCache(
           context, pc, &vc, Fb_B_W, abic, Zb_Bo_W, Fapplied_Bo_W, tau_applied,
           H_PB_W, aba_force_cache);
     }
-  }
+  });
 }
 
 template <typename T>
@@ -4151,9 +4568,10 @@ void MultibodyTree<T>::CalcArticulatedBodyAccelerations(
   const std::vector<SpatialAcceleration<T>>& Ab_WB_cache =
       EvalSpatialAccelerationBiasCache(context);
 
-  // Perform base-to-tip recursion, skipping the world.
-  for (int level = 1; level < forest_height(); ++level) {
-    for (MobodIndex mobod_index : body_node_levels_[level]) {
+  // Perform base-to-tip recursion one tree at a time, skipping the world.
+  ForEachTree([&](const SpanningForest::Tree& tree) {
+    for (MobodIndex mobod_index = tree.base_mobod();
+         mobod_index <= tree.last_mobod(); ++mobod_index) {
       const BodyNode<T>& node = *body_nodes_[mobod_index];
 
       const SpatialAcceleration<T>& Ab_WB = Ab_WB_cache[mobod_index];
@@ -4165,7 +4583,7 @@ void MultibodyTree<T>::CalcArticulatedBodyAccelerations(
       node.CalcArticulatedBodyAccelerations_BaseToTip(
           context, pc, abic, aba_force_cache, H_PB_W, Ab_WB, ac);
     }
-  }
+  });
 }
 
 template <typename T>
@@ -4178,6 +4596,83 @@ void MultibodyTree<T>::CalcArticulatedBodyAccelerations(
   CalcArticulatedBodyAccelerations(context, abic, aba_force_cache, ac);
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcForwardDynamicsFused(
+    const systems::Context<T>& context, const MultibodyForces<T>& forces,
+    ArticulatedBodyAlgorithmScratch<T>* scratch,
+    AccelerationKinematicsCache<T>* ac) const {
+  DRAKE_DEMAND(scratch != nullptr);
+  DRAKE_DEMAND(scratch->num_mobods() == num_mobods());
+  DRAKE_DEMAND(ac != nullptr);
+  DRAKE_DEMAND(forces.CheckHasRightSizeForModel(*this));
+
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const VelocityKinematicsCache<T>& vc = EvalVelocityKinematics(context);
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      EvalAcrossNodeJacobianWrtVExpressedInWorld(context);
+  const std::vector<SpatialInertia<T>>& spatial_inertia_in_world_cache =
+      EvalSpatialInertiaInWorldCache(context);
+  const VectorX<T>& reflected_inertia = EvalReflectedInertiaCache(context);
+
+  ArticulatedBodyInertiaCache<T>& abic = scratch->abic;
+  ArticulatedBodyForceCache<T>& aba_force_cache = scratch->aba_force_cache;
+  const std::vector<SpatialAcceleration<T>>& Ab_WB_all = scratch->Ab_WB;
+  const std::vector<SpatialForce<T>>& Fb_Bo_W_all = scratch->Fb_Bo_W;
+
+  // Per-mobod bias terms Ab_WB(q, v) and Fb_Bo_W(q, v) only depend on the
+  // kinematics of each mobod, so they are computed up front.
+  CalcSpatialAccelerationBias(context, &scratch->Ab_WB);
+  CalcDynamicBiasForces(context, &scratch->Fb_Bo_W);
+
+  const VectorX<T>& generalized_forces = forces.generalized_forces();
+  const std::vector<SpatialForce<T>>& body_forces = forces.body_forces();
+
+  // Single tip-to-base sweep, skipping the world. The articulated body inertia
+  // quantities of a mobod B only depend on those of its outboard mobods, which
+  // were already computed within this same sweep. Therefore, once B's inertia
+  // quantities are known, B's force bias terms can be computed right away
+  // rather than in a second tip-to-base pass.
+  scratch->Zb_Bo_W[world_mobod_index()].SetNaN();
+  ForEachTree([&](const SpanningForest::Tree& tree) {
+    for (MobodIndex mobod_index = tree.last_mobod();
+         mobod_index >= tree.base_mobod(); --mobod_index) {
+      const BodyNode<T>& node = *body_nodes_[mobod_index];
+      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+          node.GetJacobianFromArray(H_PB_W_cache);
+
+      // First pass of ABA. See CalcArticulatedBodyInertiaCache().
+      node.CalcArticulatedBodyInertiaCache_TipToBase(
+          context, pc, H_PB_W, spatial_inertia_in_world_cache[mobod_index],
+          reflected_inertia, &abic);
+
+      // Articulated body force bias. See CalcArticulatedBodyForceBias().
+      SpatialForce<T>& Zb_Bo_W = scratch->Zb_Bo_W[mobod_index];
+      Zb_Bo_W = abic.get_Pplus_PB_W(mobod_index) * Ab_WB_all[mobod_index];
+
+      // Second pass of ABA. See CalcArticulatedBodyForceCache().
+      Eigen::Ref<const VectorX<T>> tau_applied =
+          node.get_mobilizer().get_generalized_forces_from_array(
+              generalized_forces);
+      node.CalcArticulatedBodyForceCache_TipToBase(
+          context, pc, &vc, Fb_Bo_W_all[mobod_index], abic, Zb_Bo_W,
+          body_forces[mobod_index], tau_applied, H_PB_W, &aba_force_cache);
+    }
+  });
+
+  // Last pass of ABA. See CalcArticulatedBodyAccelerations().
+  ForEachTree([&](const SpanningForest::Tree& tree) {
+    for (MobodIndex mobod_index = tree.base_mobod();
+         mobod_index <= tree.last_mobod(); ++mobod_index) {
+      const BodyNode<T>& node = *body_nodes_[mobod_index];
+      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+          node.GetJacobianFromArray(H_PB_W_cache);
+      node.CalcArticulatedBodyAccelerations_BaseToTip(
+          context, pc, abic, aba_force_cache, H_PB_W, Ab_WB_all[mobod_index],
+          ac);
+    }
+  });
+}
+
 template <typename T>
 MatrixX<double> MultibodyTree<T>::MakeStateSelectorMatrix(
     const std::vector<JointIndex>& user_to_joint_index_map) const {
@@ -4495,6 +4990,7 @@ std::unique_ptr<MultibodyTree<ToScalar>> MultibodyTree<T>::CloneToScalar()
   // required to be finalized.
   tree_clone->joint_to_mobilizer_ = this->joint_to_mobilizer_;
   tree_clone->discrete_state_index_ = this->discrete_state_index_;
+  tree_clone->parallelism_ = this->parallelism_;
 
   // All other internals templated on T are created with the following call to
   // FinalizeInternals(), which also sets the "is_finalized" flag to true.
@@ -15,14 +15,17 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/pointer_cast.h"
 #include "drake/common/random.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/multibody/topology/graph.h"
 #include "drake/multibody/tree/acceleration_kinematics_cache.h"
+#include "drake/multibody/tree/articulated_body_algorithm_scratch.h"
 #include "drake/multibody/tree/articulated_body_force_cache.h"
 #include "drake/multibody/tree/articulated_body_inertia_cache.h"
 #include "drake/multibody/tree/element_collection.h"
+#include "drake/multibody/tree/mass_matrix_factorization.h"
 #include "drake/multibody/tree/multibody_forces.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
 #include "drake/multibody/tree/position_kinematics_cache.h"
@@ -591,6 +594,12 @@ class MultibodyTree {
   // could only be considered in the model using constraints.
   int forest_height() const { return forest().height(); }
 
+  // See MultibodyPlant::set_parallelism().
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  // See MultibodyPlant::get_parallelism().
+  Parallelism parallelism() const { return parallelism_; }
+
   // Returns a constant reference to the *world* link.
   const Link<T>& world_link() const {
     // world_link_ is set in the constructor. So this assert is here only
@@ -1375,6 +1384,19 @@ class MultibodyTree {
   void CalcPositionKinematicsCache(const systems::Context<T>& context,
                                    PositionKinematicsCache<T>* pc) const;
 
+  // Same as CalcPositionKinematicsCache(), except that for T = double, if `pc`
+  // was last updated by this method with the current parameters, only the
+  // subtrees outboard of the mobilizers whose generalized positions changed
+  // since then are recomputed. The parameters are identified only by the
+  // serial number of the FrameBodyPoseCache in `context`, which is not unique
+  // across contexts, so `pc` must be the value of the position kinematics
+  // cache entry in `context` (or a copy of it carried along by cloning the
+  // context). For anything else, use CalcPositionKinematicsCache().
+  //
+  // Aborts if `pc` is nullptr.
+  void UpdatePositionKinematicsCacheEntry(const systems::Context<T>& context,
+                                          PositionKinematicsCache<T>* pc) const;
+
   // Computes the per-Tree block structured, World-frame System Jacobian
   // Jv_V_WB.
   void CalcBlockSystemJacobianCache(const systems::Context<T>& context,
@@ -1663,6 +1685,29 @@ class MultibodyTree {
   void CalcMassMatrix(const systems::Context<T>& context,
                       EigenPtr<MatrixX<T>> M) const;
 
+  // Computes the mass matrix M(q), as in CalcMassMatrix(), directly into the
+  // storage of `factorization` and then computes its LTDL factorization in
+  // place. See MassMatrixFactorization for details. Afterwards, M⁻¹⋅b can be
+  // computed in O(n⋅d) with MassMatrixFactorization::SolveInPlace(), with d
+  // the depth (in velocities) of the deepest tree.
+  // @pre factorization is non-null and was constructed for this tree's forest.
+  // @throws std::exception if M(q) is not positive definite.
+  void CalcMassMatrixFactorization(
+      const systems::Context<T>& context,
+      MassMatrixFactorization<T>* factorization) const;
+
+  // See MultibodyPlant method.
+  void CalcInverseDynamicsDerivatives(
+      const systems::Context<T>& context, const VectorX<T>& known_vdot,
+      const MultibodyForces<T>& external_forces, EigenPtr<MatrixX<T>> dtau_dq,
+      EigenPtr<MatrixX<T>> dtau_dv, EigenPtr<MatrixX<T>> dtau_dvdot) const;
+
+  // See MultibodyPlant method.
+  void CalcForwardDynamicsDerivatives(
+      const systems::Context<T>& context, const MultibodyForces<T>& forces,
+      EigenPtr<VectorX<T>> vdot, EigenPtr<MatrixX<T>> dvdot_dq,
+      EigenPtr<MatrixX<T>> dvdot_dv, EigenPtr<MatrixX<T>> dvdot_dtau) const;
+
   // See MultibodyPlant method.
   void CalcBiasTerm(const systems::Context<T>& context,
                     EigenPtr<VectorX<T>> Cv) const;
@@ -2058,6 +2103,33 @@ class MultibodyTree {
       const ArticulatedBodyForceCache<T>& aba_force_cache,
       AccelerationKinematicsCache<T>* ac) const;
 
+  /* @anchor forward_dynamics_fused
+  Fused, cache-free Articulated Body Algorithm
+
+  Computes the same accelerations as the three ABA passes above (with the
+  reflected inertias as diagonal inertias) given the state in `context` and the
+  applied `forces`. Rather than evaluating the configuration and force
+  dependent ABA quantities from cache entries in the Context, this method
+  stores them in the caller-owned `scratch`, and it performs the two
+  tip-to-base passes (articulated body inertias and force bias terms) as a
+  single tip-to-base sweep. Position and velocity kinematics, hinge matrices
+  and spatial inertias in world are still evaluated from the Context since
+  they are shared with most other computations.
+
+  This is intended for callers that only need the accelerations (e.g. tight
+  forward dynamics loops) and that would otherwise pay for cache bookkeeping
+  of intermediate results they never reuse. No ABA cache entries in `context`
+  are updated by this method. After `scratch` and `ac` are constructed, this
+  method performs no heap allocation for T = double.
+
+  @pre `scratch` and `ac` are non-null and were constructed for this tree's
+  forest.
+  @pre `forces` is compatible with this tree. */
+  void CalcForwardDynamicsFused(const systems::Context<T>& context,
+                                const MultibodyForces<T>& forces,
+                                ArticulatedBodyAlgorithmScratch<T>* scratch,
+                                AccelerationKinematicsCache<T>* ac) const;
+
   // See MultibodyPlant method.
   MatrixX<double> MakeStateSelectorMatrix(
       const std::vector<JointIndex>& user_to_joint_index_map) const;
@@ -2504,6 +2576,42 @@ class MultibodyTree {
                                         const RigidBody<T>& child,
                                         Args&&... args);
 
+  // Helper for CalcInverseDynamicsDerivatives() and
+  // CalcForwardDynamicsDerivatives(). Computes the generalized forces
+  //   tau = M(q)v̇ + C(q, v)v - tau_g(q) - tau_app - ∑ J_WBᵀ(q) Fapp_Bo_W
+  // with a Newton-Euler recursion carried out with spatial vectors measured
+  // about the world origin (Featherstone's "spatial" coordinates), in which
+  // the derivatives of the recursion take a particularly simple form. If
+  // `dtau_dq` and `dtau_dv` are not null, also computes the partial
+  // derivatives of tau with respect to q and v, where configuration
+  // perturbations are expressed in velocity coordinates. `forces` are held
+  // constant; gravity is taken from gravity_field().
+  // See [Carpentier and Mansard, 2018] in CalcInverseDynamicsDerivatives().
+  void CalcInverseDynamicsAndDerivativesAboutWorldOrigin(
+      const systems::Context<T>& context, const VectorX<T>& known_vdot,
+      const MultibodyForces<T>& forces, EigenPtr<VectorX<T>> tau,
+      EigenPtr<MatrixX<T>> dtau_dq, EigenPtr<MatrixX<T>> dtau_dv) const;
+
+  // Invokes `tree_function(tree)` once for each Tree in the forest. The Trees
+  // partition the non-World mobods, are kinematically independent, and each
+  // occupies a contiguous range of MobodIndex values in depth-first order. So
+  // a base-to-tip (or tip-to-base) pass can be written as a loop over a Tree's
+  // mobods in increasing (or decreasing) index order, and different Trees may
+  // be processed concurrently as long as `tree_function` only writes to the
+  // entries belonging to the mobods of its Tree. The Trees are distributed
+  // over up to parallelism().num_threads() threads; for scalar types other
+  // than double and AutoDiffXd they are always processed serially.
+  // @pre Every cache entry needed by `tree_function` has already been
+  // evaluated; Eval() must not be called from within `tree_function`.
+  template <typename TreeFunction>
+  void ForEachTree(const TreeFunction& tree_function) const;
+
+  // Implements CalcPositionKinematicsCache() and, when `is_cache_entry` is
+  // true, UpdatePositionKinematicsCacheEntry().
+  void CalcPositionKinematicsCacheImpl(const systems::Context<T>& context,
+                                       bool is_cache_entry,
+                                       PositionKinematicsCache<T>* pc) const;
+
   // Helpers for getting the full qv discrete state once we know we are using
   // discrete state.
   Eigen::VectorBlock<const VectorX<T>> get_discrete_state_vector(
@@ -2899,10 +3007,8 @@ class MultibodyTree {
   // The gravity field force element.
   UniformGravityFieldElement<T>* gravity_field_{nullptr};
 
-  // Mobilized body indexes (for Mobods, BodyNodes, Mobilizers) are ordered
-  // by level (a.k.a depth) in the SpanningForest, starting with 0 for World.
-  // body_node_levels_[i] contains the list of all MobodIndexes at level i.
-  std::vector<std::vector<MobodIndex>> body_node_levels_;
+  // The degree of parallelism used by ForEachTree().
+  Parallelism parallelism_;
 
   // Joint to Mobilizer map, of size num_joints(). For a joint with index
   // joint_index, mobilizer_index = joint_to_mobilizer_[joint_index] maps to the
@@ -440,7 +440,8 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
   void CalcPositionKinematicsCache(
       const systems::Context<T>& context,
       PositionKinematicsCache<T>* position_cache) const {
-    internal_tree().CalcPositionKinematicsCache(context, position_cache);
+    internal_tree().UpdatePositionKinematicsCacheEntry(context,
+                                                       position_cache);
   }
 
   void CalcBlockSystemJacobianCache(
@@ -82,6 +82,11 @@ class PlanarMobilizer final : public MobilizerImpl<T, 3, 3> {
   bool can_rotate() const final { return true; }
   bool can_translate() const final { return true; }
 
+  // The translations (x, y) carry along the rotation axis through Mo.
+  bool velocity_carries_axis(int j, int k) const final {
+    return j < 2 && k == 2;
+  }
+
   /* Retrieves from `context` the two translations (x, y) which describe the
    position for `this` mobilizer as documented in this class's documentation.
 
@@ -1,6 +1,9 @@
 #include "drake/multibody/tree/position_kinematics_cache.h"
 
+#include <algorithm>
+#include <cstring>
 #include <limits>
+#include <type_traits>
 
 #include "drake/multibody/tree/frame_body_pose_cache.h"
 
@@ -13,6 +16,8 @@ PositionKinematicsCache<T>::PositionKinematicsCache(
     const SpanningForest& forest)
     : num_mobods_(forest.num_mobods()), num_links_(forest.num_links()) {
   Allocate();
+  q_ = VectorX<T>::Constant(forest.num_positions(),
+                            std::numeric_limits<double>::quiet_NaN());
 
   // Set known values for world-related quantities (here B=W).
   X_WB_pool_[world_mobod_index()] = RigidTransform<T>::Identity();
@@ -45,6 +50,25 @@ void PositionKinematicsCache<T>::ComputeWorldComposite(
   }
 }
 
+template <typename T>
+bool PositionKinematicsCache<T>::UpdatePositionsIfChanged(int q_start, int nq,
+                                                          const T* q) {
+  DRAKE_ASSERT(0 <= q_start && q_start + nq <= q_.size());
+  T* recorded = q_.data() + q_start;
+  bool changed = false;
+  if constexpr (std::is_same_v<T, double>) {
+    // A bitwise comparison, so that -0.0 is not confused with 0.0 and
+    // recomputation gives exactly the same results as a full update.
+    changed = std::memcmp(recorded, q, nq * sizeof(double)) != 0;
+  } else {
+    // Values alone don't tell whether non-double scalars (e.g. derivatives or
+    // symbolic expressions) changed; always report a change.
+    changed = true;
+  }
+  std::copy(q, q + nq, recorded);
+  return changed;
+}
+
 // Initialize most things to NaN to catch bugs.
 template <typename T>
 void PositionKinematicsCache<T>::Allocate() {
@@ -185,6 +185,28 @@ class PositionKinematicsCache {
     world_composite_serial_number_ = frame_body_pose_cache_serial_number;
   }
 
+  // Returns the serial number of the FrameBodyPoseCache with which the per-mobod
+  // quantities in this cache were last fully computed, or -1 if they are not
+  // known to be consistent with any of them (for instance, while they are
+  // being updated). MultibodyTree uses this, together with the positions
+  // recorded by UpdatePositionsIfChanged(), to recompute only the subtrees
+  // outboard of the mobilizers whose positions changed.
+  int64_t kinematics_serial_number() const {
+    return kinematics_serial_number_;
+  }
+
+  void set_kinematics_serial_number(int64_t serial_number) {
+    kinematics_serial_number_ = serial_number;
+  }
+
+  // Compares the `nq` generalized positions in `q` starting at `q_start` with
+  // the ones recorded the last time this method was called for the same
+  // range, and records the new values. Returns `true` if any of them changed
+  // (bitwise), or if they were never recorded. The ranges of different
+  // mobilizers are disjoint, so this may be called concurrently for mobilizers
+  // in different trees.
+  bool UpdatePositionsIfChanged(int q_start, int nq, const T* q);
+
  private:
   // Allocates resources for this position kinematics cache.
   void Allocate();
@@ -208,6 +230,13 @@ class PositionKinematicsCache {
   // those quantities when PrecomputeWorldComposite() is called.
   int64_t world_composite_serial_number_{-1};
 
+  // See kinematics_serial_number().
+  int64_t kinematics_serial_number_{-1};
+
+  // The generalized positions last recorded by UpdatePositionsIfChanged().
+  // Initialized to NaN, so that they are never considered unchanged.
+  VectorX<T> q_;
+
   // These are indexed by MobodIndex so are in depth-first order.
   std::vector<RigidTransform<T>> X_WB_pool_;
   std::vector<RigidTransform<T>> X_PB_pool_;
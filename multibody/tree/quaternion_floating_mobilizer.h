@@ -84,6 +84,11 @@ class QuaternionFloatingMobilizer final : public MobilizerImpl<T, 7, 6> {
   bool can_rotate() const final { return true; }
   bool can_translate() const final { return true; }
 
+  // The translations carry along the rotation axes, which act about Mo.
+  bool velocity_carries_axis(int j, int k) const final {
+    return j >= 3 && k < 3;
+  }
+
   // @name Methods to get and set the state for a QuaternionFloatingMobilizer
   // @{
 
@@ -100,6 +100,11 @@ class RpyFloatingMobilizer final : public MobilizerImpl<T, 6, 6> {
   bool can_rotate() const final { return true; }
   bool can_translate() const final { return true; }
 
+  // The translations carry along the rotation axes, which act about Mo.
+  bool velocity_carries_axis(int j, int k) const final {
+    return j >= 3 && k < 3;
+  }
+
   // Returns the generalized positions for this mobilizer stored in context.
   // Generalized positions q for this mobilizer are packed in exactly the
   // following order: q = [θ₀, θ₁, θ₂, px_FM, py_FM, pz_FM] that is, rpy
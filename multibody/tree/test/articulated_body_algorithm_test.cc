@@ -282,6 +282,75 @@ GTEST_TEST(ArticulatedBodyInertiaAlgorithm, ModifiedFeatherstoneExample) {
                               Pplus_B_W_actual.CopyToFullMatrix6(), kEpsilon));
 }
 
+// Verifies that the fused, cache-free ABA computes the same accelerations as
+// the three-pass ABA that stores its intermediate results in the cache.
+GTEST_TEST(ArticulatedBodyInertiaAlgorithm, FusedMatchesCached) {
+  auto tree_owned = std::make_unique<MultibodyTree<double>>();
+  auto& tree = *tree_owned;
+
+  // A chain world -> box -> massless -> cylinder with a mix of joint types, as
+  // in ModifiedFeatherstoneExample.
+  const RigidBody<double>& box_link = tree.AddLink(
+      "box", SpatialInertia<double>::SolidBoxWithMass(2.4, 0.5, 1.2, 1.6));
+  const auto& WB_joint =
+      tree.AddJoint<BallRpyJoint>("ball", tree.world_link(), {}, box_link, {});
+  const RigidBody<double>& massless_link =
+      tree.AddLink("massless", SpatialInertia<double>::Zero());
+  const auto& BM_joint = tree.AddJoint<RevoluteJoint>(
+      "revolute", box_link, {}, massless_link, {}, Vector3d(1, 0, 0));
+  const RigidBody<double>& cylinder_link =
+      tree.AddLink("cylinder", SpatialInertia<double>::SolidCylinderWithMass(
+                                   0.6, 0.3, 0.3, Vector3d::UnitX()));
+  const auto& MC_joint = tree.AddJoint<PrismaticJoint>(
+      "prismatic", massless_link, {}, cylinder_link, {}, Vector3d(0, 1, 0));
+
+  MultibodyTreeSystem<double> system(std::move(tree_owned));
+  auto context = system.CreateDefaultContext();
+
+  // Arbitrary non-zero state so that all bias terms are exercised.
+  WB_joint.set_angles(context.get(), Vector3d(0.1, -0.7, 0.3));
+  WB_joint.set_angular_velocity(context.get(), Vector3d(1.0, -2.0, 0.5));
+  BM_joint.set_angle(context.get(), M_PI_4);
+  BM_joint.set_angular_rate(context.get(), -1.5);
+  MC_joint.set_translation(context.get(), 0.2);
+  MC_joint.set_translation_rate(context.get(), 0.7);
+
+  // Arbitrary applied forces.
+  MultibodyForces<double> forces(tree);
+  forces.mutable_generalized_forces() =
+      VectorX<double>::LinSpaced(tree.num_velocities(), -1.0, 2.0);
+  cylinder_link.AddInForce(*context, Vector3d(0.1, 0.0, 0.05),
+                           SpatialForce<double>(Vector3d(0.3, -0.2, 0.1),
+                                                Vector3d(1.0, 2.0, -3.0)),
+                           tree.world_frame(), &forces);
+
+  ArticulatedBodyForceCache<double> aba_force_cache(tree.forest());
+  tree.CalcArticulatedBodyForceCache(*context, forces, &aba_force_cache);
+  AccelerationKinematicsCache<double> ac_expected(tree.forest());
+  tree.CalcArticulatedBodyAccelerations(*context, aba_force_cache,
+                                        &ac_expected);
+
+  ArticulatedBodyAlgorithmScratch<double> scratch(tree.forest());
+  AccelerationKinematicsCache<double> ac(tree.forest());
+  tree.CalcForwardDynamicsFused(*context, forces, &scratch, &ac);
+
+  EXPECT_TRUE(CompareMatrices(ac.get_vdot(), ac_expected.get_vdot(), kEpsilon));
+  for (MobodIndex mobod_index(1); mobod_index < tree.num_mobods();
+       ++mobod_index) {
+    EXPECT_TRUE(CompareMatrices(ac.get_A_WB(mobod_index).get_coeffs(),
+                                ac_expected.get_A_WB(mobod_index).get_coeffs(),
+                                kEpsilon));
+  }
+
+  // The scratch can be reused for a different state.
+  BM_joint.set_angular_rate(context.get(), 3.0);
+  tree.CalcArticulatedBodyForceCache(*context, forces, &aba_force_cache);
+  tree.CalcArticulatedBodyAccelerations(*context, aba_force_cache,
+                                        &ac_expected);
+  tree.CalcForwardDynamicsFused(*context, forces, &scratch, &ac);
+  EXPECT_TRUE(CompareMatrices(ac.get_vdot(), ac_expected.get_vdot(), kEpsilon));
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace multibody
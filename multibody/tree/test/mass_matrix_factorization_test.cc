@@ -0,0 +1,162 @@
+#include "drake/multibody/tree/mass_matrix_factorization.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/multibody_tree-inl.h"
+#include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/universal_joint.h"
+#include "drake/multibody/tree/weld_joint.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using systems::Context;
+
+constexpr double kTolerance = 1.0e-12;
+
+// Adds a chain of `num_links` bodies to `plant`, starting at `parent`, using a
+// mix of joint types. A weld is inserted half way down the chain so that the
+// factorization needs to skip zero-velocity mobods.
+void AddChain(const std::string& prefix, const RigidBody<double>& parent,
+              int num_links, MultibodyPlant<double>* plant) {
+  const SpatialInertia<double> M =
+      SpatialInertia<double>::SolidBoxWithMass(1.5, 0.1, 0.2, 0.3);
+  const RigidBody<double>* previous = &parent;
+  for (int i = 0; i < num_links; ++i) {
+    const std::string name = prefix + std::to_string(i);
+    const RigidBody<double>& link = plant->AddRigidBody(name, M);
+    const RigidTransformd X_PF(Vector3d(0.0, 0.0, -0.4));
+    if (i == num_links / 2) {
+      plant->AddJoint<WeldJoint>(name + "_joint", *previous, X_PF, link, {},
+                                 RigidTransformd::Identity());
+    } else if (i % 3 == 0) {
+      plant->AddJoint<RevoluteJoint>(name + "_joint", *previous, X_PF, link,
+                                     {}, Vector3d::UnitY());
+    } else if (i % 3 == 1) {
+      plant->AddJoint<UniversalJoint>(name + "_joint", *previous, X_PF, link,
+                                      {});
+    } else {
+      plant->AddJoint<PrismaticJoint>(name + "_joint", *previous, X_PF, link,
+                                      {}, Vector3d::UnitX());
+    }
+    previous = &link;
+  }
+}
+
+class MassMatrixFactorizationTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    // Two branches off of the same base link, a separate chain, and a free
+    // body, so that we exercise branching, multiple trees and multi-dof
+    // mobilizers.
+    const RigidBody<double>& base = plant_.AddRigidBody(
+        "base", SpatialInertia<double>::SolidSphereWithMass(3.0, 0.2));
+    plant_.AddJoint<RevoluteJoint>("base_joint", plant_.world_body(), {},
+                                   base, {}, Vector3d::UnitZ());
+    AddChain("left", base, 5, &plant_);
+    AddChain("right", base, 4, &plant_);
+    AddChain("other", plant_.world_body(), 6, &plant_);
+    plant_.AddRigidBody("free",
+                        SpatialInertia<double>::SolidCubeWithMass(0.5, 0.1));
+    plant_.Finalize();
+
+    context_ = plant_.CreateDefaultContext();
+    plant_.SetPositions(
+        context_.get(),
+        VectorX<double>::LinSpaced(plant_.num_positions(), -1.0, 1.5));
+  }
+
+ protected:
+  const MultibodyTree<double>& tree() const { return GetInternalTree(plant_); }
+
+  MultibodyPlant<double> plant_{0.0};
+  std::unique_ptr<Context<double>> context_;
+};
+
+TEST_F(MassMatrixFactorizationTest, ParentVelocities) {
+  MassMatrixFactorization<double> factorization(tree().forest());
+  const int nv = plant_.num_velocities();
+  ASSERT_EQ(factorization.size(), nv);
+
+  // The first velocity of each tree has no parent.
+  int num_roots = 0;
+  for (int i = 0; i < nv; ++i) {
+    const int parent = factorization.parent_velocity()[i];
+    EXPECT_LT(parent, i);
+    if (parent == -1) ++num_roots;
+  }
+  EXPECT_EQ(num_roots, ssize(tree().forest().trees()));
+}
+
+TEST_F(MassMatrixFactorizationTest, FactorAndSolve) {
+  const int nv = plant_.num_velocities();
+  MatrixX<double> M(nv, nv);
+  plant_.CalcMassMatrix(*context_, &M);
+
+  MassMatrixFactorization<double> factorization(tree().forest());
+  EXPECT_FALSE(factorization.is_factored());
+  tree().CalcMassMatrixFactorization(*context_, &factorization);
+  EXPECT_TRUE(factorization.is_factored());
+
+  // Reconstruct M = Lᵀ⋅D⋅L.
+  const MatrixX<double> L = factorization.L();
+  const MatrixX<double> LtDL =
+      L.transpose() * factorization.D().asDiagonal() * L;
+  EXPECT_TRUE(CompareMatrices(LtDL, M, kTolerance * M.norm()));
+
+  // L has no fill-in beyond the branch-induced sparsity of M.
+  for (int i = 0; i < nv; ++i) {
+    for (int j = 0; j < i; ++j) {
+      if (M(i, j) == 0.0) {
+        EXPECT_EQ(L(i, j), 0.0);
+      }
+    }
+  }
+
+  // Solves agree with a dense factorization.
+  const VectorX<double> b = VectorX<double>::LinSpaced(nv, 1.0, 3.0);
+  const VectorX<double> x_expected = M.ldlt().solve(b);
+  EXPECT_TRUE(
+      CompareMatrices(factorization.Solve(b), x_expected, kTolerance * nv));
+
+  MatrixX<double> B(nv, 3);
+  B << b, 2.0 * b, VectorX<double>::Ones(nv);
+  const MatrixX<double> X_expected = M.ldlt().solve(B);
+  factorization.SolveInPlace(&B);
+  EXPECT_TRUE(CompareMatrices(B, X_expected, kTolerance * nv));
+
+  // Factor() on a copy gives the same result.
+  MassMatrixFactorization<double> copied(tree().forest());
+  copied.Factor(M);
+  EXPECT_TRUE(CompareMatrices(copied.Solve(b), x_expected, kTolerance * nv));
+}
+
+TEST_F(MassMatrixFactorizationTest, NotPositiveDefinite) {
+  const int nv = plant_.num_velocities();
+  MassMatrixFactorization<double> factorization(tree().forest());
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      factorization.Factor(MatrixX<double>::Zero(nv, nv)),
+      ".*not positive definite.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      factorization.Factor(MatrixX<double>::Identity(nv + 1, nv + 1)),
+      ".*M.rows\\(\\) == size\\(\\).*");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -1239,6 +1239,127 @@ TEST_F(KukaIiwaModelTests, EvalPoseAndSpatialVelocity) {
                               MatrixCompareType::relative));
 }
 
+// Position kinematics are only recomputed for the subtrees outboard of the
+// joints whose positions changed. Verify the results match the ones computed
+// from scratch on a fresh context, for changes at the base, in the middle and
+// at the tip of the arm.
+TEST_F(KukaIiwaModelTests, IncrementalPositionKinematics) {
+  VectorX<double> q, v;
+  GetArbitraryNonZeroJointAnglesAndRates(&q, &v);
+  const auto set_angles_and_compare = [&](const VectorX<double>& angles) {
+    for (int i = 0; i < ssize(joints_); ++i) {
+      if (joints_[i]->get_angle(*context_) != angles[i]) {
+        joints_[i]->set_angle(context_.get(), angles[i]);
+      }
+    }
+    auto fresh_context = system_->CreateDefaultContext();
+    for (int i = 0; i < ssize(joints_); ++i) {
+      joints_[i]->set_angle(fresh_context.get(), angles[i]);
+    }
+    for (LinkIndex index(0); index < tree().num_links(); ++index) {
+      const Link<double>& link = tree().get_link(index);
+      EXPECT_TRUE(tree().EvalLinkPoseInWorld(*context_, link).IsExactlyEqualTo(
+          tree().EvalLinkPoseInWorld(*fresh_context, link)));
+    }
+  };
+
+  set_angles_and_compare(q);
+  // Tip only.
+  q[6] += 0.3;
+  set_angles_and_compare(q);
+  // Middle of the arm.
+  q[3] -= 0.2;
+  set_angles_and_compare(q);
+  // Base and tip at once.
+  q[0] += 0.1;
+  q[6] -= 0.5;
+  set_angles_and_compare(q);
+  // No change at all.
+  set_angles_and_compare(q);
+
+  // A clone of the context carries along the recorded positions.
+  auto clone = context_->Clone();
+  q[5] += 0.4;
+  joints_[5]->set_angle(clone.get(), q[5]);
+  joints_[5]->set_angle(context_.get(), q[5]);
+  for (LinkIndex index(0); index < tree().num_links(); ++index) {
+    const Link<double>& link = tree().get_link(index);
+    EXPECT_TRUE(tree().EvalLinkPoseInWorld(*clone, link).IsExactlyEqualTo(
+        tree().EvalLinkPoseInWorld(*context_, link)));
+  }
+}
+
+// Verifies which poses an incremental update recomputes by overwriting them
+// with a sentinel first. The pose of the link that the dirty subtree hangs
+// from is kept, since the subtree is recomputed from it. A cache that is only
+// ever updated with context_ stands in for its position kinematics cache
+// entry.
+TEST_F(KukaIiwaModelTests, IncrementalPositionKinematicsDirtySubtree) {
+  VectorX<double> q, v;
+  GetArbitraryNonZeroJointAnglesAndRates(&q, &v);
+  for (int i = 0; i < ssize(joints_); ++i) {
+    joints_[i]->set_angle(context_.get(), q[i]);
+  }
+  PositionKinematicsCache<double> pc(tree().forest());
+  tree().UpdatePositionKinematicsCacheEntry(*context_, &pc);
+
+  const RigidTransform<double> sentinel(Vector3d(1e3, 1e3, 1e3));
+  for (int i = 0; i < ssize(joints_); ++i) {
+    if (i != 3) {
+      pc.get_mutable_X_WB(joints_[i]->child_body().mobod_index()) = sentinel;
+    }
+  }
+  // Only the links outboard of joint 5 move.
+  joints_[4]->set_angle(context_.get(), q[4] + 0.3);
+  tree().UpdatePositionKinematicsCacheEntry(*context_, &pc);
+  for (int i = 0; i < ssize(joints_); ++i) {
+    const RigidBody<double>& body = joints_[i]->child_body();
+    const RigidTransform<double>& X_WB = pc.get_X_WB(body.mobod_index());
+    if (i < 3) {
+      EXPECT_TRUE(X_WB.IsExactlyEqualTo(sentinel)) << i;
+    } else {
+      EXPECT_TRUE(X_WB.IsExactlyEqualTo(
+          tree().EvalLinkPoseInWorld(*context_, body)))
+          << i;
+    }
+  }
+
+  // A general (caller-owned) update always recomputes everything.
+  tree().CalcPositionKinematicsCache(*context_, &pc);
+  for (const RevoluteJoint<double>* joint : joints_) {
+    const RigidBody<double>& body = joint->child_body();
+    EXPECT_TRUE(pc.get_X_WB(body.mobod_index())
+                    .IsExactlyEqualTo(tree().EvalLinkPoseInWorld(*context_,
+                                                                 body)));
+  }
+}
+
+// A caller-owned cache may be reused across contexts whose FrameBodyPoseCache
+// serial numbers coincide, as they do for fresh contexts, even though their
+// parameters differ.
+TEST_F(KukaIiwaModelTests, PositionKinematicsCacheReusedAcrossContexts) {
+  const auto* frame = dynamic_cast<const FixedOffsetFrame<double>*>(
+      &joints_[0]->frame_on_parent());
+  ASSERT_NE(frame, nullptr);
+  auto context_a = system_->CreateDefaultContext();
+  auto context_b = system_->CreateDefaultContext();
+  frame->SetPoseInParentFrame(context_b.get(),
+                              RigidTransform<double>(Vector3d(0, 0, 0.5)));
+
+  PositionKinematicsCache<double> pc(tree().forest());
+  tree().CalcPositionKinematicsCache(*context_a, &pc);
+  tree().CalcPositionKinematicsCache(*context_b, &pc);
+  for (const RevoluteJoint<double>* joint : joints_) {
+    const RigidBody<double>& body = joint->child_body();
+    EXPECT_TRUE(pc.get_X_WB(body.mobod_index())
+                    .IsExactlyEqualTo(tree().EvalLinkPoseInWorld(*context_b,
+                                                                 body)));
+    EXPECT_FALSE(pc.get_X_WB(body.mobod_index())
+                     .IsExactlyEqualTo(tree().EvalLinkPoseInWorld(*context_a,
+                                                                  body)));
+  }
+}
+
 TEST_F(KukaIiwaModelTests, CalcJacobianSpatialVelocityA) {
   // The number of generalized positions in the Kuka iiwa robot arm model.
   const int kNumPositions = tree().num_positions();
@@ -87,6 +87,11 @@ class UniversalMobilizer final : public MobilizerImpl<T, 2, 2> {
   bool can_rotate() const final { return true; }
   bool can_translate() const final { return false; }
 
+  // The first rotation carries along the axis of the second one.
+  bool velocity_carries_axis(int j, int k) const final {
+    return j == 0 && k == 1;
+  }
+
   // Retrieves from `context` the two angles, (θ₀, θ₁) which describe the state
   // for `this` mobilizer as documented in this class's documentation.
   //
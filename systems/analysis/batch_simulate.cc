@@ -0,0 +1,215 @@
+#include "drake/systems/analysis/batch_simulate.h"
+
+#include <exception>
+#include <memory>
+
+#include <common_robotics_utilities/parallelism.hpp>
+
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/analysis/simulator_config_functions.h"
+#include "drake/systems/framework/context_pool.h"
+
+namespace drake {
+namespace systems {
+
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+namespace {
+
+// Returns the size of the state vector of `context`, as defined in
+// BatchSimulate().
+int CalcStateSize(const Context<double>& context) {
+  int size = context.num_continuous_states();
+  for (int i = 0; i < context.num_discrete_state_groups(); ++i) {
+    size += context.get_discrete_state(i).size();
+  }
+  return size;
+}
+
+void SetStateVector(const Eigen::Ref<const VectorXd>& x,
+                    Context<double>* context) {
+  const int num_continuous = context->num_continuous_states();
+  if (num_continuous > 0) {
+    context->SetContinuousState(x.head(num_continuous));
+  }
+  int offset = num_continuous;
+  for (int i = 0; i < context->num_discrete_state_groups(); ++i) {
+    const int size = context->get_discrete_state(i).size();
+    context->SetDiscreteState(i, x.segment(offset, size));
+    offset += size;
+  }
+}
+
+void CopyStateVector(const Context<double>& context, VectorXd* x) {
+  const VectorBase<double>& xc = context.get_continuous_state_vector();
+  for (int j = 0; j < xc.size(); ++j) {
+    (*x)[j] = xc[j];
+  }
+  int offset = xc.size();
+  for (int i = 0; i < context.num_discrete_state_groups(); ++i) {
+    const BasicVector<double>& xd = context.get_discrete_state(i);
+    x->segment(offset, xd.size()) = xd.value();
+    offset += xd.size();
+  }
+}
+
+// Returns the size of the parameter vector of `context`, as defined in
+// BatchSimulate().
+int CalcParameterSize(const Context<double>& context) {
+  int size = 0;
+  for (int i = 0; i < context.num_numeric_parameter_groups(); ++i) {
+    size += context.get_numeric_parameter(i).size();
+  }
+  return size;
+}
+
+void SetParameterVector(const Eigen::Ref<const VectorXd>& p,
+                        Context<double>* context) {
+  int offset = 0;
+  for (int i = 0; i < context->num_numeric_parameter_groups(); ++i) {
+    BasicVector<double>& group = context->get_mutable_numeric_parameter(i);
+    group.SetFromVector(p.segment(offset, group.size()));
+    offset += group.size();
+  }
+}
+
+}  // namespace
+
+std::vector<VectorLog<double>> BatchSimulate(
+    const System<double>& system, const Context<double>& context,
+    const Eigen::Ref<const MatrixXd>& initial_states,
+    const Eigen::Ref<const MatrixXd>& parameters,
+    const std::vector<MatrixXd>& inputs, double time_step, int num_time_steps,
+    std::variant<OutputPortSelection, OutputPortIndex> output_port_index,
+    std::variant<InputPortSelection, InputPortIndex> input_port_index,
+    const SimulatorConfig& simulator_config, Parallelism parallelize) {
+  system.ValidateContext(context);
+  DRAKE_THROW_UNLESS(time_step > 0);
+  DRAKE_THROW_UNLESS(num_time_steps >= 0);
+  const int num_rollouts = initial_states.cols();
+  const int state_size = CalcStateSize(context);
+  DRAKE_THROW_UNLESS(initial_states.rows() == state_size);
+  if (parameters.cols() > 0) {
+    DRAKE_THROW_UNLESS(parameters.rows() == CalcParameterSize(context));
+    DRAKE_THROW_UNLESS(parameters.cols() == num_rollouts);
+  }
+  const InputPort<double>* input_port =
+      system.get_input_port_selection(input_port_index);
+  if (input_port) {
+    DRAKE_THROW_UNLESS(input_port->get_data_type() ==
+                       PortDataType::kVectorValued);
+    DRAKE_THROW_UNLESS(static_cast<int>(inputs.size()) == num_rollouts);
+    for (const MatrixXd& input : inputs) {
+      DRAKE_THROW_UNLESS(input.rows() == input_port->size());
+      DRAKE_THROW_UNLESS(input.cols() == num_time_steps);
+    }
+  }
+  const OutputPort<double>* output_port =
+      system.get_output_port_selection(output_port_index);
+  if (output_port) {
+    DRAKE_THROW_UNLESS(output_port->get_data_type() ==
+                       PortDataType::kVectorValued);
+  }
+  const int log_size = output_port ? output_port->size() : state_size;
+
+  // Every rollout is reset from `prototype`, which differs from `context` only
+  // in that the input port (if any) is already fixed. That way, resetting a
+  // pooled Context reuses its existing fixed input port value.
+  std::unique_ptr<Context<double>> prototype = context.Clone();
+  if (input_port) {
+    input_port->FixValue(prototype.get(), VectorXd::Zero(input_port->size()));
+  }
+
+  const int num_threads_to_use = parallelize.num_threads();
+  ContextPool<double> context_pool(*prototype, num_threads_to_use);
+  std::vector<std::unique_ptr<Simulator<double>>> simulators(
+      num_threads_to_use);
+  std::vector<VectorXd> samples(num_threads_to_use);
+
+  std::vector<VectorLog<double>> logs;
+  logs.reserve(num_rollouts);
+  for (int i = 0; i < num_rollouts; ++i) {
+    logs.emplace_back(log_size);
+  }
+
+  const double start_time = context.get_time();
+  const auto simulate_rollout = [&](const int thread_num, const int64_t i) {
+    std::unique_ptr<Simulator<double>>& simulator = simulators[thread_num];
+    if (!simulator) {
+      simulator = std::make_unique<Simulator<double>>(system);
+      ApplySimulatorConfig(simulator_config, simulator.get());
+      // The Simulator uses the pooled Context in place, without owning it.
+      simulator->reset_context_from_shared(std::shared_ptr<Context<double>>(
+          &context_pool.get_mutable_context(thread_num),
+          [](Context<double>*) {}));
+      samples[thread_num].resize(log_size);
+    }
+    Context<double>& rollout_context =
+        context_pool.ResetFrom(thread_num, *prototype);
+    SetStateVector(initial_states.col(i), &rollout_context);
+    if (parameters.cols() > 0) {
+      SetParameterVector(parameters.col(i), &rollout_context);
+    }
+    FixedInputPortValue* input_value =
+        input_port ? rollout_context.MaybeGetMutableFixedInputPortValue(
+                         input_port->get_index())
+                   : nullptr;
+
+    VectorLog<double>& log = logs[i];
+    log.Reserve(num_time_steps + 1);
+    VectorXd& sample = samples[thread_num];
+    const auto add_sample = [&]() {
+      if (output_port) {
+        sample = output_port->Eval(rollout_context);
+      } else {
+        CopyStateVector(rollout_context, &sample);
+      }
+      log.AddData(rollout_context.get_time(), sample);
+    };
+
+    // The input for step k is applied before the sample at the start of that
+    // step is taken, so that direct-feedthrough outputs see it.
+    if (input_value != nullptr && num_time_steps > 0) {
+      input_value->GetMutableVectorData<double>()->SetFromVector(
+          inputs[i].col(0));
+    }
+    simulator->Initialize();
+    add_sample();
+    for (int step = 0; step < num_time_steps; ++step) {
+      simulator->AdvanceTo(start_time + (step + 1) * time_step);
+      if (input_value != nullptr && step + 1 < num_time_steps) {
+        input_value->GetMutableVectorData<double>()->SetFromVector(
+            inputs[i].col(step + 1));
+      }
+      add_sample();
+    }
+  };
+
+  // Exceptions must not escape a parallel worker. Instead, we capture them and
+  // re-throw the first one (in rollout order) once all rollouts are done, so
+  // that the caller sees the same exception as with serial evaluation.
+  std::vector<std::exception_ptr> errors(num_rollouts);
+  const auto simulate = [&](const int thread_num, const int64_t i) {
+    try {
+      simulate_rollout(thread_num, i);
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  };
+
+  StaticParallelForIndexLoop(DegreeOfParallelism(num_threads_to_use), 0,
+                             num_rollouts, simulate,
+                             ParallelForBackend::BEST_AVAILABLE);
+  for (const std::exception_ptr& error : errors) {
+    if (error != nullptr) std::rethrow_exception(error);
+  }
+
+  return logs;
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <variant>
+#include <vector>
+
+#include "drake/common/parallelism.h"
+#include "drake/systems/analysis/simulator_config.h"
+#include "drake/systems/framework/system.h"
+#include "drake/systems/primitives/vector_log.h"
+
+namespace drake {
+namespace systems {
+
+/** Simulates many rollouts of a single `system` over a common horizon, in
+parallel, and returns a log of each one.
+
+Each column of `initial_states` (and of `parameters`, when given) along with
+the corresponding element of `inputs` describes a single rollout. Every rollout
+starts from a copy of `context` at its time t0, with its state and numeric
+parameters overwritten from the batch, and is advanced by a Simulator
+(configured by `simulator_config`) to t0 + num_time_steps * time_step. The input
+is held constant over each time step, i.e., column k of the rollout's `inputs`
+matrix is applied from t0 + k * time_step until t0 + (k + 1) * time_step.
+
+Here the "state vector" of a Context is the continuous state followed by the
+discrete state groups, in order; abstract state is taken from `context`
+unchanged. Likewise the "parameter vector" is the concatenation of all numeric
+parameter groups; abstract parameters are taken from `context` unchanged.
+
+Each worker thread allocates a single Context and Simulator up front and reuses
+them for all of the rollouts it performs, so the per-rollout setup cost is only
+that of copying values into the existing Context.
+
+@param system The system to simulate.
+@param context A context associated with `system`, which supplies everything
+(e.g., abstract state or parameters, or other fixed input ports) that is not
+set from the batch.
+@param initial_states A num_states x N matrix of initial state vectors.
+@param parameters Either a num_parameters x N matrix of numeric parameter
+vectors, or an empty (zero column) matrix to use the parameters in `context`
+for every rollout.
+@param inputs N matrices of size num_inputs x num_time_steps, where num_inputs
+must match the size of the input port selected. If input_port_index is set to
+InputPortSelection::kNoInput (or `system` has no input ports), then the inputs
+argument will be ignored.
+@param time_step The time between consecutive input samples and log entries.
+@param num_time_steps The number of time steps in each rollout.
+@param output_port_index The output port to log. The default is to use the
+first output if there is one. A specific port index or kNoOutput can be
+specified instead; when no output port is used, the state vector is logged.
+The output port must be vector-valued.
+@param input_port_index The input port driven by `inputs`. The default is to
+use the first input if there is one. A specific port index or kNoInput can be
+specified instead. The input port must be vector-valued.
+@param simulator_config The configuration applied to each Simulator.
+@param parallelize The parallelism to use for the rollouts.
+
+@return N logs, in the order of the columns of `initial_states`, each with
+num_time_steps + 1 samples taken at times t0 + k * time_step for k = 0, ...,
+num_time_steps.
+
+@throws std::exception if matrix shapes are inconsistent, with inputs required
+only if an input port is selected.
+@throws std::exception if `time_step` is not positive or `num_time_steps` is
+negative.
+@throws std::exception if any rollout throws (e.g., if its Simulator fails to
+advance). All rollouts are still run, and then the exception of the first
+failing rollout (in the order of the columns of `initial_states`) is
+rethrown. */
+std::vector<VectorLog<double>> BatchSimulate(
+    const System<double>& system, const Context<double>& context,
+    const Eigen::Ref<const Eigen::MatrixXd>& initial_states,
+    const Eigen::Ref<const Eigen::MatrixXd>& parameters,
+    const std::vector<Eigen::MatrixXd>& inputs, double time_step,
+    int num_time_steps,
+    std::variant<OutputPortSelection, OutputPortIndex> output_port_index =
+        OutputPortSelection::kUseFirstOutputIfItExists,
+    std::variant<InputPortSelection, InputPortIndex> input_port_index =
+        InputPortSelection::kUseFirstInputIfItExists,
+    const SimulatorConfig& simulator_config = {},
+    Parallelism parallelize = Parallelism::Max());
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,263 @@
+#include "drake/systems/analysis/batch_simulate.h"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/analysis/simulator_config_functions.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/primitives/linear_system.h"
+#include "drake/systems/primitives/symbolic_vector_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+using symbolic::Expression;
+using symbolic::Variable;
+
+GTEST_TEST(BatchSimulateTest, DiscreteLinearSystem) {
+  Eigen::Matrix2d A, B;
+  // clang-format off
+  A << 0.5, 0.1,
+       0.2, 0.3;
+  B << 1, 2,
+       3, 4;
+  // clang-format on
+  const Eigen::Matrix2d C = 2 * Eigen::Matrix2d::Identity();
+  const Eigen::Matrix2d D = Eigen::Matrix2d::Zero();
+  const double time_step = 0.1;
+  LinearSystem<double> system(A, B, C, D, time_step);
+  auto context = system.CreateDefaultContext();
+
+  const int num_time_steps = 3;
+  MatrixXd x0(2, 3);
+  // clang-format off
+  x0 << 0.1, 0.2, 0.3,
+        0.4, 0.5, 0.6;
+  // clang-format on
+  std::vector<MatrixXd> inputs;
+  for (int i = 0; i < x0.cols(); ++i) {
+    inputs.push_back(MatrixXd::Constant(2, num_time_steps, 0.1 * i) +
+                     MatrixXd::Identity(2, num_time_steps));
+  }
+
+  // Log the output port (the default), and also the state, using two threads.
+  const std::vector<VectorLog<double>> output_logs = BatchSimulate(
+      system, *context, x0, MatrixXd(0, 0), inputs, time_step, num_time_steps,
+      OutputPortSelection::kUseFirstOutputIfItExists,
+      InputPortSelection::kUseFirstInputIfItExists, {}, Parallelism(2));
+  const std::vector<VectorLog<double>> state_logs = BatchSimulate(
+      system, *context, x0, MatrixXd(0, 0), inputs, time_step, num_time_steps,
+      OutputPortSelection::kNoOutput,
+      InputPortSelection::kUseFirstInputIfItExists, {}, Parallelism(2));
+  ASSERT_EQ(output_logs.size(), 3);
+  ASSERT_EQ(state_logs.size(), 3);
+
+  for (int i = 0; i < x0.cols(); ++i) {
+    MatrixXd expected_states(2, num_time_steps + 1);
+    expected_states.col(0) = x0.col(i);
+    for (int k = 0; k < num_time_steps; ++k) {
+      expected_states.col(k + 1) =
+          A * expected_states.col(k) + B * inputs[i].col(k);
+    }
+    EXPECT_TRUE(CompareMatrices(state_logs[i].data(), expected_states, 1e-14));
+    EXPECT_TRUE(
+        CompareMatrices(output_logs[i].data(), C * expected_states, 1e-14));
+    EXPECT_TRUE(CompareMatrices(
+        state_logs[i].sample_times(),
+        VectorXd::LinSpaced(num_time_steps + 1, 0.0, 0.3), 1e-14));
+  }
+}
+
+// Each rollout may use its own numeric parameters.
+GTEST_TEST(BatchSimulateTest, Parameters) {
+  const Variable x("x");
+  const Variable p("p");
+  const double time_step = 0.25;
+  // x[n+1] = p * x[n]
+  const auto system = SymbolicVectorSystemBuilder()
+                          .state(x)
+                          .parameter(p)
+                          .dynamics(Vector1<Expression>{p * x})
+                          .time_period(time_step)
+                          .Build();
+  auto context = system->CreateDefaultContext();
+
+  const Eigen::RowVector3d x0{1.0, 2.0, 3.0};
+  const Eigen::RowVector3d params{0.5, 1.0, 2.0};
+  const int num_time_steps = 2;
+  const std::vector<VectorLog<double>> logs =
+      BatchSimulate(*system, *context, x0, params, {}, time_step,
+                    num_time_steps, OutputPortSelection::kNoOutput);
+  ASSERT_EQ(logs.size(), 3);
+  for (int i = 0; i < 3; ++i) {
+    const Eigen::RowVector3d expected{x0(i), x0(i) * params(i),
+                                      x0(i) * params(i) * params(i)};
+    EXPECT_TRUE(CompareMatrices(logs[i].data(), expected, 1e-14));
+  }
+
+  // Without any parameters in the batch, the context's parameters are used.
+  context->get_mutable_numeric_parameter(0)[0] = 3.0;
+  const std::vector<VectorLog<double>> default_logs =
+      BatchSimulate(*system, *context, x0, Eigen::MatrixXd(0, 0), {}, time_step,
+                    num_time_steps, OutputPortSelection::kNoOutput);
+  for (int i = 0; i < 3; ++i) {
+    const Eigen::RowVector3d expected{x0(i), x0(i) * 3, x0(i) * 9};
+    EXPECT_TRUE(CompareMatrices(default_logs[i].data(), expected, 1e-14));
+  }
+}
+
+// The rollouts match a serial simulation of each one, regardless of how many
+// threads are used.
+GTEST_TEST(BatchSimulateTest, ContinuousSystemMatchesSimulator) {
+  Eigen::Matrix2d A, B;
+  // clang-format off
+  A << 0, 1,
+       -2, -0.5;
+  B << 0, 0,
+       1, 0;
+  // clang-format on
+  const MatrixXd C = Eigen::RowVector2d(1, 0);
+  const MatrixXd D = Eigen::RowVector2d(0, 1);
+  LinearSystem<double> system(A, B, C, D);
+  auto context = system.CreateDefaultContext();
+
+  const double time_step = 0.05;
+  const int num_time_steps = 10;
+  const int num_rollouts = 5;
+  const MatrixXd x0 = MatrixXd::Random(2, num_rollouts);
+  std::vector<MatrixXd> inputs;
+  for (int i = 0; i < num_rollouts; ++i) {
+    inputs.push_back(MatrixXd::Random(2, num_time_steps));
+  }
+  SimulatorConfig config;
+  config.integration_scheme = "runge_kutta2";
+  config.max_step_size = 0.01;
+
+  const std::vector<VectorLog<double>> serial_logs = BatchSimulate(
+      system, *context, x0, MatrixXd(0, 0), inputs, time_step, num_time_steps,
+      OutputPortSelection::kUseFirstOutputIfItExists,
+      InputPortSelection::kUseFirstInputIfItExists, config,
+      Parallelism::None());
+  const std::vector<VectorLog<double>> parallel_logs = BatchSimulate(
+      system, *context, x0, MatrixXd(0, 0), inputs, time_step, num_time_steps,
+      OutputPortSelection::kUseFirstOutputIfItExists,
+      InputPortSelection::kUseFirstInputIfItExists, config, Parallelism(2));
+
+  for (int i = 0; i < num_rollouts; ++i) {
+    Simulator<double> simulator(system);
+    ApplySimulatorConfig(config, &simulator);
+    Context<double>& sim_context = simulator.get_mutable_context();
+    sim_context.SetContinuousState(x0.col(i));
+    MatrixXd expected(1, num_time_steps + 1);
+    for (int k = 0; k <= num_time_steps; ++k) {
+      if (k > 0) {
+        simulator.AdvanceTo(k * time_step);
+      }
+      // The last input is held through the final sample.
+      system.get_input_port().FixValue(
+          &sim_context,
+          VectorXd(inputs[i].col(std::min(k, num_time_steps - 1))));
+      if (k == 0) {
+        simulator.Initialize();
+      }
+      expected.col(k) = system.get_output_port().Eval(sim_context);
+    }
+    EXPECT_TRUE(CompareMatrices(serial_logs[i].data(), expected, 1e-14));
+    EXPECT_TRUE(CompareMatrices(parallel_logs[i].data(), expected, 1e-14));
+  }
+}
+
+GTEST_TEST(BatchSimulateTest, BadArguments) {
+  LinearSystem<double> system(Eigen::Matrix2d::Identity(),
+                              Eigen::Matrix2d::Identity(),
+                              Eigen::Matrix2d::Identity(),
+                              Eigen::Matrix2d::Zero());
+  auto context = system.CreateDefaultContext();
+  const MatrixXd x0 = MatrixXd::Zero(2, 2);
+  const std::vector<MatrixXd> inputs(2, MatrixXd::Zero(2, 3));
+  const MatrixXd no_params(0, 0);
+
+  EXPECT_NO_THROW(
+      BatchSimulate(system, *context, x0, no_params, inputs, 0.1, 3));
+  // Wrong state size.
+  EXPECT_THROW(BatchSimulate(system, *context, MatrixXd::Zero(3, 2), no_params,
+                             inputs, 0.1, 3),
+               std::exception);
+  // Parameters given for a system without any.
+  EXPECT_THROW(BatchSimulate(system, *context, x0, MatrixXd::Zero(1, 2),
+                             inputs, 0.1, 3),
+               std::exception);
+  // Wrong number of input trajectories, or of input samples.
+  EXPECT_THROW(BatchSimulate(system, *context, x0, no_params, {inputs[0]}, 0.1,
+                             3),
+               std::exception);
+  EXPECT_THROW(
+      BatchSimulate(system, *context, x0, no_params, inputs, 0.1, 2),
+      std::exception);
+  // Bad time step.
+  EXPECT_THROW(BatchSimulate(system, *context, x0, no_params, inputs, 0.0, 3),
+               std::exception);
+  // Inputs are ignored when no input port is used, in which case the context
+  // must provide the input.
+  system.get_input_port().FixValue(context.get(), Eigen::Vector2d::Zero());
+  EXPECT_NO_THROW(BatchSimulate(system, *context, x0, no_params, {}, 0.1, 3,
+                                OutputPortSelection::kUseFirstOutputIfItExists,
+                                InputPortSelection::kNoInput));
+}
+
+// A discrete counter, x[n+1] = x[n] + 1, whose update throws once x exceeds 10.
+class ThrowingCounter final : public LeafSystem<double> {
+ public:
+  ThrowingCounter() {
+    DeclareDiscreteState(1);
+    DeclarePeriodicDiscreteUpdateEvent(0.1, 0.0, &ThrowingCounter::Update);
+  }
+
+ private:
+  EventStatus Update(const Context<double>& context,
+                     DiscreteValues<double>* next) const {
+    const double x = context.get_discrete_state_vector()[0];
+    if (x > 10) {
+      throw std::runtime_error(fmt::format("Counter overflow at {}", x));
+    }
+    next->set_value(Vector1d(x + 1));
+    return EventStatus::Succeeded();
+  }
+};
+
+// A failing rollout reports its exception to the caller (rather than
+// terminating the process), and the first failure in rollout order wins.
+GTEST_TEST(BatchSimulateTest, RolloutThrows) {
+  ThrowingCounter system;
+  auto context = system.CreateDefaultContext();
+  MatrixXd x0(1, 4);
+  x0 << 0, 20, 0, 30;
+  for (int num_threads : {1, 2}) {
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        BatchSimulate(system, *context, x0, MatrixXd(0, 0), {}, 0.1, 3,
+                      OutputPortSelection::kNoOutput,
+                      InputPortSelection::kNoInput, {},
+                      Parallelism(num_threads)),
+        "Counter overflow at 20");
+  }
+  // The rollouts that don't fail are unaffected.
+  x0 << 0, 1, 2, 3;
+  EXPECT_NO_THROW(BatchSimulate(system, *context, x0, MatrixXd(0, 0), {}, 0.1,
+                                3, OutputPortSelection::kNoOutput,
+                                InputPortSelection::kNoInput, {},
+                                Parallelism(2)));
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -1,8 +1,10 @@
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include <benchmark/benchmark.h>
 
+#include "drake/systems/framework/context_pool.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/primitives/adder.h"
 #include "drake/systems/primitives/pass_through.h"
@@ -60,6 +62,60 @@ BENCHMARK_F(BasicFixture, PassThrough3)(benchmark::State& state) {
   }
 }
 
+// Helper function for the PassThroughChain benchmark. Creates a chain of
+// `num_systems` PassThroughs, each nested inside `depth` levels of Diagram with
+// its input and output exported at every level.
+std::unique_ptr<Diagram<double>> MakePassThroughChain(int num_systems,
+                                                      int depth) {
+  DRAKE_DEMAND(num_systems > 0);
+  DRAKE_DEMAND(depth >= 0);
+  DiagramBuilder<double> builder;
+  const int n = 7;
+  System<double>* previous = nullptr;
+  for (int i = 0; i < num_systems; ++i) {
+    std::unique_ptr<System<double>> link =
+        std::make_unique<PassThrough<double>>(n);
+    for (int j = 0; j < depth; ++j) {
+      DiagramBuilder<double> wrapper;
+      System<double>* inner = wrapper.AddSystem(std::move(link));
+      wrapper.ExportInput(inner->get_input_port(0));
+      wrapper.ExportOutput(inner->get_output_port(0));
+      link = wrapper.Build();
+    }
+    System<double>* current = builder.AddSystem(std::move(link));
+    if (previous == nullptr) {
+      builder.ExportInput(current->get_input_port(0));
+    } else {
+      builder.Cascade(*previous, *current);
+    }
+    previous = current;
+  }
+  builder.ExportOutput(previous->get_output_port(0));
+  return builder.Build();
+}
+
+// Measures the framework overhead of evaluating an output that depends on a
+// long chain of trivial subsystems, at various depths of Diagram nesting.
+void PassThroughChain(benchmark::State& state) {  // NOLINT
+  const int num_systems = state.range(0);
+  const int depth = state.range(1);
+  std::unique_ptr<Diagram<double>> diagram =
+      MakePassThroughChain(num_systems, depth);
+  std::unique_ptr<Context<double>> context = diagram->CreateDefaultContext();
+  auto& input = diagram->get_input_port().FixValue(
+      context.get(), Eigen::VectorXd::Constant(7, 22.2));
+  auto& output = diagram->get_output_port();
+  for (auto _ : state) {
+    input.GetMutableData();
+    output.Eval(*context);
+  }
+}
+
+BENCHMARK(PassThroughChain)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({100, 0})
+    ->Args({100, 2});
+
 // Helper function for the DiagramBuild benchmark. Creates a diagram containing
 // num_systems subsystems.  When depth==0, each subsystem is an Adder, otherwise
 // each subsystem is a recursive self-call with the next smaller depth.
@@ -120,6 +176,50 @@ BENCHMARK(DiagramBuild)
     ->Args({3, 1})
     ->Args({3, 2});
 
+// Measures only the cache invalidation sweep that follows a change to an input
+// value, using the densely connected diagrams of the DiagramBuild benchmark.
+void InputChangeNotification(benchmark::State& state) {  // NOLINT
+  const int num_systems = state.range(0);
+  const int depth = state.range(1);
+  std::unique_ptr<Diagram<double>> diagram =
+      MakeDiagramBuilder(num_systems, depth)->Build();
+  std::unique_ptr<Context<double>> context = diagram->CreateDefaultContext();
+  for (int i = 1; i < diagram->num_input_ports(); ++i) {
+    diagram->get_input_port(i).FixValue(context.get(), 1.0);
+  }
+  auto& input = diagram->get_input_port(0).FixValue(context.get(), 1.0);
+  for (auto _ : state) {
+    input.GetMutableData();
+  }
+}
+
+BENCHMARK(InputChangeNotification)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({30, 0})
+    ->Args({3, 2});
+
+// Measures the cost of obtaining a fresh copy of a Context, either by cloning
+// it (state.range(0) == 0) or by resetting a preallocated ContextPool slot
+// from it (state.range(0) == 1).
+void ContextReset(benchmark::State& state) {  // NOLINT
+  const bool use_pool = state.range(0);
+  std::unique_ptr<Diagram<double>> diagram = MakeDiagramBuilder(3, 2)->Build();
+  std::unique_ptr<Context<double>> context = diagram->CreateDefaultContext();
+  for (int i = 0; i < diagram->num_input_ports(); ++i) {
+    diagram->get_input_port(i).FixValue(context.get(), 1.0);
+  }
+  ContextPool<double> pool(*context, 1);
+  for (auto _ : state) {
+    if (use_pool) {
+      benchmark::DoNotOptimize(pool.ResetFrom(0, *context));
+    } else {
+      benchmark::DoNotOptimize(context->Clone());
+    }
+  }
+}
+
+BENCHMARK(ContextReset)->Unit(benchmark::kMicrosecond)->Arg(0)->Arg(1);
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
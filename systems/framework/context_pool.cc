@@ -0,0 +1,101 @@
+#include "drake/systems/framework/context_pool.h"
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace drake {
+namespace systems {
+
+template <typename T>
+ContextPool<T>::ContextPool(const Context<T>& prototype, int size) {
+  DRAKE_THROW_UNLESS(size >= 0);
+  DRAKE_THROW_UNLESS(prototype.is_root_context());
+  contexts_.reserve(size);
+  for (int i = 0; i < size; ++i) {
+    contexts_.push_back(prototype.Clone());
+  }
+}
+
+template <typename T>
+ContextPool<T>::~ContextPool() = default;
+
+template <typename T>
+const Context<T>& ContextPool<T>::get_context(int index) const {
+  ThrowIfBadIndex(index);
+  return *contexts_[index];
+}
+
+template <typename T>
+Context<T>& ContextPool<T>::get_mutable_context(int index) {
+  ThrowIfBadIndex(index);
+  return *contexts_[index];
+}
+
+template <typename T>
+Context<T>& ContextPool<T>::ResetFrom(int index, const Context<T>& source) {
+  ThrowIfBadIndex(index);
+  Context<T>& context = *contexts_[index];
+  if (!source.is_root_context() ||
+      source.get_system_id() != context.get_system_id()) {
+    throw std::logic_error(
+        "ContextPool::ResetFrom(): the source must be a root Context of the "
+        "same System as the Contexts in this pool");
+  }
+
+  // Check for an unsupported unfix before changing anything, so that a failed
+  // reset leaves the slot untouched.
+  for (int i = 0; i < context.num_input_ports(); ++i) {
+    if (context.MaybeGetFixedInputPortValue(i) != nullptr &&
+        source.MaybeGetFixedInputPortValue(i) == nullptr) {
+      throw std::logic_error(fmt::format(
+          "ContextPool::ResetFrom(): input port {} is fixed in slot {} but "
+          "not in the source Context; a fixed input port cannot be unfixed",
+          i, index));
+    }
+  }
+
+  context.SetTimeStateAndParametersFrom(source);
+
+  // Overwrite existing fixed values in place; only a port being fixed for the
+  // first time in this slot allocates.
+  for (int i = 0; i < context.num_input_ports(); ++i) {
+    const FixedInputPortValue* source_value =
+        source.MaybeGetFixedInputPortValue(i);
+    if (source_value == nullptr) continue;
+    FixedInputPortValue* value = context.MaybeGetMutableFixedInputPortValue(i);
+    if (value != nullptr) {
+      // AbstractValue::SetFrom() clones a BasicVector, so copy vector values
+      // element-wise instead.
+      const BasicVector<T>* source_vector =
+          source_value->get_value().maybe_get_value<BasicVector<T>>();
+      const BasicVector<T>* vector =
+          value->get_value().maybe_get_value<BasicVector<T>>();
+      if (source_vector != nullptr && vector != nullptr &&
+          source_vector->size() == vector->size()) {
+        value->GetMutableVectorData<T>()->SetFrom(*source_vector);
+      } else {
+        value->GetMutableData()->SetFrom(source_value->get_value());
+      }
+    } else {
+      context.FixInputPort(i, source_value->get_value());
+    }
+  }
+  return context;
+}
+
+template <typename T>
+void ContextPool<T>::ThrowIfBadIndex(int index) const {
+  if (index < 0 || index >= size()) {
+    throw std::out_of_range(
+        fmt::format("ContextPool: slot index {} is out of range for a pool of "
+                    "size {}",
+                    index, size()));
+  }
+}
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::ContextPool);
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace systems {
+
+/** A fixed-size collection of preallocated Context objects, all cloned from a
+common prototype, intended for workloads that repeatedly start short
+computations (e.g., simulation rollouts) from a known Context.
+
+Creating a Context with System::CreateDefaultContext() or Context::Clone()
+allocates every subcontext, state vector, parameter, and cache entry value
+separately, which can dominate the cost of a short rollout. A %ContextPool
+pays that cost once, up front. Afterwards, ResetFrom() copies time, accuracy,
+state, parameters, and fixed input port values from a source Context into a
+pooled slot in place, reusing all of the slot's existing storage. For
+vector-valued data (and for abstract values whose copy assignment does not
+allocate) no heap allocation is performed.
+
+Each slot is an independent root Context, so distinct slots may be used
+concurrently by different threads; a common pattern is to size the pool to the
+number of worker threads and index it by the thread number. A single slot must
+not be used by more than one thread at a time.
+
+@code
+  ContextPool<double> pool(*prototype_context, num_threads);
+  // In worker thread `thread_num`, for each rollout:
+  Context<double>& context = pool.ResetFrom(thread_num, *initial_context);
+  // ... advance `context` ...
+@endcode
+
+@tparam_default_scalar */
+template <typename T>
+class ContextPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ContextPool);
+
+  /** Constructs a pool of `size` clones of `prototype`.
+  @throws std::exception if `size` is negative or `prototype` is not a root
+  Context. */
+  ContextPool(const Context<T>& prototype, int size);
+
+  ~ContextPool();
+
+  /** Returns the number of slots in this pool. */
+  int size() const { return static_cast<int>(contexts_.size()); }
+
+  /** Returns the Context in slot `index`.
+  @throws std::exception if `index` is out of range. */
+  const Context<T>& get_context(int index) const;
+
+  /** Returns the mutable Context in slot `index`.
+  @throws std::exception if `index` is out of range. */
+  Context<T>& get_mutable_context(int index);
+
+  /** Copies time, accuracy, state, parameters, and root-level fixed input port
+  values from `source` into the Context in slot `index`, reusing that Context's
+  existing storage, and returns the slot's Context. Out-of-date notifications
+  are sent for all dependent computations in the slot, so any previously
+  cached results are invalidated.
+
+  Input ports that are fixed in `source` become fixed (with the same value) in
+  the slot; input ports that are fixed in the slot but not in `source` are an
+  error, because unfixing a port is not supported.
+  @throws std::exception if `index` is out of range, if `source` is not a
+  root Context of the same System as the pool's prototype, or if the slot has a
+  fixed input port that `source` does not. */
+  Context<T>& ResetFrom(int index, const Context<T>& source);
+
+ private:
+  void ThrowIfBadIndex(int index) const;
+
+  std::vector<std::unique_ptr<Context<T>>> contexts_;
+};
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::ContextPool);
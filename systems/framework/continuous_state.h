@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
@@ -180,8 +181,13 @@ class ContinuousState {
     DRAKE_THROW_UNLESS(num_q() == other.num_q());
     DRAKE_THROW_UNLESS(num_v() == other.num_v());
     DRAKE_THROW_UNLESS(num_z() == other.num_z());
-    SetFromVector(other.CopyToVector().unaryExpr(
-        scalar_conversion::ValueConverter<T, U>{}));
+    if constexpr (std::is_same_v<T, U>) {
+      // Copy element-wise, without a temporary, so that this does not allocate.
+      get_mutable_vector().SetFrom(other.get_vector());
+    } else {
+      SetFromVector(other.CopyToVector().unaryExpr(
+          scalar_conversion::ValueConverter<T, U>{}));
+    }
   }
 
   /// Sets the entire continuous state vector from an Eigen expression.
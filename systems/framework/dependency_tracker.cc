@@ -1,6 +1,7 @@
 #include "drake/systems/framework/dependency_tracker.h"
 
 #include <algorithm>
+#include <unordered_set>
 
 #include "drake/common/text_logging.h"
 #include "drake/common/unused.h"
@@ -34,7 +35,9 @@ void DependencyTracker::NoteValueChange(int64_t change_event) const {
     return;
   }
   last_change_event_ = change_event;
-  NotifySubscribers(change_event, 0);
+  if (!NotifyDownstreamClosure(change_event)) {
+    NotifySubscribers(change_event, 0);
+  }
 }
 
 // A prerequisite says it has changed. Short circuit if we've already heard
@@ -83,6 +86,91 @@ void DependencyTracker::NotifySubscribers(int64_t change_event,
   num_downstream_notifications_sent_ += num_subscribers();
 }
 
+// Our value has changed. If the recursive sweep would reach every tracker in
+// our downstream closure, then we know in advance what each of them would do
+// and can just do it, in one pass. We check that first (with no side effects)
+// so that we can fall back to the recursive sweep if necessary.
+bool DependencyTracker::NotifyDownstreamClosure(int64_t change_event) const {
+  DRAKE_ASSERT(change_event > 0);
+  DRAKE_ASSERT(last_change_event_ == change_event);
+
+  if (downstream_closure_version_ != subscribers_version_) {
+    UpdateDownstreamClosure();
+  }
+  for (const DownstreamTracker& downstream : downstream_closure_) {
+    const DependencyTracker& tracker = *downstream.tracker;
+    if (tracker.subscribers_version_ != downstream.subscribers_version) {
+      // The closure is stale. The retry can't recurse further since the
+      // fresh closure is up to date.
+      UpdateDownstreamClosure();
+      return NotifyDownstreamClosure(change_event);
+    }
+    if (tracker.last_change_event_ == change_event ||
+        tracker.suppress_notifications_) {
+      return false;
+    }
+  }
+  if (!downstream_closure_is_usable_) {
+    return false;
+  }
+
+  DRAKE_LOGGER_DEBUG("... {} downstream subscribers. Notifying {} trackers.",
+                     num_subscribers(), downstream_closure_.size());
+  num_downstream_notifications_sent_ += num_subscribers();
+  for (const DownstreamTracker& downstream : downstream_closure_) {
+    const DependencyTracker& tracker = *downstream.tracker;
+    // The first notification invalidates; the others are ignored.
+    tracker.num_prerequisite_notifications_received_ +=
+        downstream.num_notifications;
+    tracker.num_ignored_notifications_ += downstream.num_notifications - 1;
+    tracker.last_change_event_ = change_event;
+    tracker.cache_value_->mark_out_of_date();
+    tracker.num_downstream_notifications_sent_ += tracker.num_subscribers();
+  }
+  return true;
+}
+
+void DependencyTracker::UpdateDownstreamClosure() const {
+  DRAKE_LOGGER_DEBUG("Tracker '{}' updating its downstream closure",
+                     GetPathDescription());
+  downstream_closure_.clear();
+  downstream_closure_is_usable_ = true;
+
+  // Find every tracker reachable by following subscriber edges.
+  std::unordered_set<const DependencyTracker*> visited;
+  std::vector<const DependencyTracker*> to_visit(subscribers_);
+  while (!to_visit.empty()) {
+    const DependencyTracker* tracker = to_visit.back();
+    to_visit.pop_back();
+    DRAKE_ASSERT(tracker != nullptr);
+    if (tracker == this) {
+      // We would be notified of our own change, which only the recursive
+      // sweep accounts for.
+      downstream_closure_is_usable_ = false;
+      continue;
+    }
+    if (!visited.insert(tracker).second) {
+      continue;
+    }
+    downstream_closure_.push_back({tracker, tracker->subscribers_version_, 0});
+    to_visit.insert(to_visit.end(), tracker->subscribers_.begin(),
+                    tracker->subscribers_.end());
+  }
+
+  // Each tracker is notified once by each of its prerequisites that is itself
+  // notified, i.e., by those that are us or in the closure.
+  for (DownstreamTracker& downstream : downstream_closure_) {
+    for (const DependencyTracker* prerequisite :
+         downstream.tracker->prerequisites_) {
+      if (prerequisite == this || visited.contains(prerequisite)) {
+        ++downstream.num_notifications;
+      }
+    }
+    DRAKE_ASSERT(downstream.num_notifications > 0);
+  }
+  downstream_closure_version_ = subscribers_version_;
+}
+
 // Given a DependencyTracker that is supposed to be a prerequisite to this
 // one, subscribe to it. This is done only at Context allocation and copying
 // so we can afford Release-build checks and general mucking about to make
@@ -110,6 +198,7 @@ void DependencyTracker::AddDownstreamSubscriber(
   DRAKE_ASSERT(subscriber.HasPrerequisite(*this));  // Expensive.
 
   subscribers_.push_back(&subscriber);
+  ++subscribers_version_;
 }
 
 namespace {
@@ -154,6 +243,7 @@ void DependencyTracker::RemoveDownstreamSubscriber(
   DRAKE_ASSERT(!subscriber.HasPrerequisite(*this));  // Expensive.
 
   Remove<const DependencyTracker*>(&subscriber, &subscribers_);
+  ++subscribers_version_;
 }
 
 std::string DependencyTracker::GetPathDescription() const {
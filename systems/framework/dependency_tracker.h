@@ -107,6 +107,15 @@ nodes. */
 // improve performance further by grouping simultaneous changes (say time and
 // state) together into a single change event.
 //
+// A tracker that initiates change events (via NoteValueChange()) also keeps a
+// flattened copy of everything downstream of it, built on first use. When no
+// tracker in that closure has already seen the change event or is suppressing
+// notifications (the common case), a sweep is a single loop over the closure
+// that produces exactly the same invalidations and statistics as the recursive
+// sweep, but visits each downstream tracker once rather than once per edge.
+// Otherwise, the sweep falls back to the recursive one. Each tracker counts
+// changes to its subscriber list so that a closure can tell when it is stale.
+//
 // Lots of things can go wrong so we maintain lots of redundant information here
 // and check it religiously in Debug builds, less so in Release builds.
 //
@@ -378,6 +387,17 @@ class DependencyTracker {
   // prerequisite; downstream subscribers can't tell the difference.
   void NotifySubscribers(int64_t change_event, int depth) const;
 
+  // Given that `this` tracker has just noted a value change for
+  // `change_event`, attempts the invalidation sweep over the downstream
+  // closure (see the implementation notes above), first bringing the closure
+  // up to date if necessary. Returns false without changing anything if the
+  // closure can't be used for this sweep, in which case the caller must use
+  // NotifySubscribers() instead.
+  bool NotifyDownstreamClosure(int64_t change_event) const;
+
+  // Recomputes downstream_closure_ from the current subscriber lists.
+  void UpdateDownstreamClosure() const;
+
   std::string GetSystemPathname() const {
     DRAKE_DEMAND(owning_subcontext_ != nullptr);
     return owning_subcontext_->GetSystemPathname();
@@ -404,6 +424,9 @@ class DependencyTracker {
   std::vector<const DependencyTracker*> subscribers_;
   std::vector<const DependencyTracker*> prerequisites_;
 
+  // Incremented whenever subscribers_ changes.
+  int64_t subscribers_version_{0};
+
   bool suppress_notifications_{false};
 
   // Used for short-circuiting repeated notifications. Does not otherwise change
@@ -411,6 +434,26 @@ class DependencyTracker {
   // greater than zero, so this will never match.
   mutable int64_t last_change_event_{-1};
 
+  // One tracker in the downstream closure, i.e., reachable from `this` tracker
+  // by following subscriber edges.
+  struct DownstreamTracker {
+    const DependencyTracker* tracker{};
+    // The tracker's subscribers_version_ when the closure was computed.
+    int64_t subscribers_version{};
+    // The number of the tracker's prerequisites that are either `this` tracker
+    // or in the closure, i.e., the number of notifications it receives in a
+    // recursive sweep that reaches the whole closure.
+    int num_notifications{};
+  };
+
+  // Derived from the subscriber lists, so mutable is OK. The closure is valid
+  // when downstream_closure_version_ matches our subscribers_version_ and each
+  // of its trackers' subscribers_version matches theirs. It is not usable if
+  // `this` tracker is downstream of itself.
+  mutable std::vector<DownstreamTracker> downstream_closure_;
+  mutable int64_t downstream_closure_version_{-1};
+  mutable bool downstream_closure_is_usable_{false};
+
   // Runtime statistics. Does not change behavior at all.
   mutable int64_t num_value_change_notifications_received_{0};
   mutable int64_t num_prerequisite_notifications_received_{0};
@@ -1,13 +1,18 @@
 #include "drake/systems/framework/diagram.h"
 
+#include <algorithm>
+#include <exception>
 #include <limits>
+#include <numeric>
 #include <set>
 #include <stdexcept>
 #include <unordered_set>
 
+#include <common_robotics_utilities/parallelism.hpp>
 #include <fmt/ranges.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_bool.h"
 #include "drake/common/string_unordered_set.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/framework/abstract_value_cloner.h"
@@ -19,6 +24,10 @@
 namespace drake {
 namespace systems {
 
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::DynamicParallelForIndexLoop;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+
 template <typename T>
 Diagram<T>::~Diagram() {}
 
@@ -640,6 +649,18 @@ bool Diagram<T>::AreConnected(const OutputPort<T>& output,
   return false;
 }
 
+template <typename T>
+void Diagram<T>::set_update_dispatch_parallelism(Parallelism parallelism) {
+  update_dispatch_parallelism_ = parallelism;
+  update_dispatch_upstream_ports_.clear();
+  if (parallelism.num_threads() > 1) {
+    std::unordered_map<const System<T>*, std::multimap<int, int>> memoize;
+    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+      update_dispatch_upstream_ports_.push_back(FindUpstreamPorts(i, &memoize));
+    }
+  }
+}
+
 template <typename T>
 Diagram<T>::Diagram()
     : System<T>(SystemScalarConverter::MakeWithoutSubtypeChecking<Diagram>()) {}
@@ -1058,43 +1079,31 @@ const AbstractValue* Diagram<T>::EvalConnectedSubsystemInputPort(
   this->ValidateContext(context_base);
   auto& diagram_context = static_cast<const DiagramContext<T>&>(context_base);
 
-  // Profiling revealed that it is too expensive to do a dynamic_cast here.
-  // A static_cast is safe as long as the given input_port_base was actually
-  // an InputPort<T>, and since our sole caller is SystemBase which always
-  // retrieves the input_port_base from `this`, the <T> must be correct.
-  auto& system = static_cast<const System<T>&>(
-      internal::PortBaseAttorney::get_system_interface(input_port_base));
-  const InputPortLocator id{&system, input_port_base.get_index()};
-
-  // Find if this input port is exported (connected to an input port of this
-  // containing diagram).
-  const auto external_it = input_port_map_.find(id);
-  const bool is_exported = (external_it != input_port_map_.end());
-
-  // Find if this input port is connected to an output port.
-  // TODO(sherm1) Fix this. Shouldn't have to search.
-  const auto upstream_it = connection_map_.find(id);
-  const bool is_connected = (upstream_it != connection_map_.end());
-
-  if (!(is_exported || is_connected)) {
+  // Find the port's source, if it is either exported (connected to an input
+  // port of this containing diagram) or connected to an output port.
+  const auto source_it = input_port_sources_.find(&input_port_base);
+  if (source_it == input_port_sources_.end()) {
     return nullptr;
   }
+  const InputPortSource& source = source_it->second;
 
-  DRAKE_DEMAND(is_exported ^ is_connected);
-
-  if (is_exported) {
+  if (source.diagram_input.is_valid()) {
     // The upstream source is an input to this whole Diagram; evaluate that
     // input port and use the result as the value for this one.
-    const InputPortIndex i = external_it->second;
-    return this->EvalAbstractInput(diagram_context, i);
+    return this->EvalAbstractInput(diagram_context, source.diagram_input);
   }
 
   // The upstream source is an output port of one of this Diagram's child
   // subsystems; evaluate it.
   // TODO(david-german-tri): Add online algebraic loop detection here.
-  DRAKE_ASSERT(is_connected);
-  const OutputPortLocator& prerequisite = upstream_it->second;
-  return &this->EvalSubsystemOutputPort(diagram_context, prerequisite);
+  DRAKE_ASSERT(source.upstream_port != nullptr);
+  DRAKE_LOGGER_TRACE("Evaluating output for subsystem {}, port {}",
+                     source.upstream_port->get_system().GetSystemPathname(),
+                     source.upstream_port->get_index());
+  const Context<T>& subsystem_context =
+      diagram_context.GetSubsystemContext(source.upstream_subsystem);
+  return &source.upstream_port->template Eval<AbstractValue>(
+      subsystem_context);
 }
 
 template <typename T>
@@ -1186,6 +1195,175 @@ Diagram<T>::AllocateForcedEventCollection(
   return ret;
 }
 
+template <typename T>
+typename Diagram<T>::UpstreamPorts Diagram<T>::FindUpstreamPorts(
+    SubsystemIndex index,
+    std::unordered_map<const System<T>*, std::multimap<int, int>>* memoize)
+    const {
+  DRAKE_DEMAND(memoize != nullptr);
+  std::set<std::pair<SubsystemIndex, OutputPortIndex>> outputs;
+  std::set<InputPortIndex> inputs;
+  // The subsystem input ports whose sources are yet to be visited.
+  std::vector<InputPortLocator> pending;
+  const System<T>* const system = registered_systems_[index].get();
+  for (InputPortIndex p(0); p < system->num_input_ports(); ++p) {
+    pending.emplace_back(system, p);
+  }
+  while (!pending.empty()) {
+    const InputPortLocator input_id = pending.back();
+    pending.pop_back();
+    if (const auto it = connection_map_.find(input_id);
+        it != connection_map_.end()) {
+      const auto& [upstream, output_index] = it->second;
+      if (!outputs.emplace(GetSystemIndexOrAbort(upstream), output_index)
+               .second) {
+        continue;  // Already visited.
+      }
+      auto memoized_feedthroughs = memoize->find(upstream);
+      if (memoized_feedthroughs == memoize->end()) {
+        memoized_feedthroughs =
+            memoize->emplace(upstream, upstream->GetDirectFeedthroughs()).first;
+      }
+      for (const auto& [upstream_input, upstream_output] :
+           memoized_feedthroughs->second) {
+        if (upstream_output == output_index) {
+          pending.emplace_back(upstream, InputPortIndex(upstream_input));
+        }
+      }
+    } else if (const auto jt = input_port_map_.find(input_id);
+               jt != input_port_map_.end()) {
+      inputs.insert(jt->second);
+    }
+  }
+  UpstreamPorts result;
+  for (const auto& [i, _] : outputs) {
+    if (result.subsystems.empty() || result.subsystems.back() != i) {
+      result.subsystems.push_back(i);
+    }
+  }
+  result.inputs.assign(inputs.begin(), inputs.end());
+  return result;
+}
+
+template <typename T>
+template <typename EventType>
+EventStatus Diagram<T>::DispatchUpdateHandlers(
+    const DiagramContext<T>& context,
+    const DiagramEventCollection<EventType>& events,
+    const std::function<EventStatus(SubsystemIndex)>& handler) const {
+  std::vector<SubsystemIndex> dispatched;
+  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    if (events.get_subevent_collection(i).HasEvents()) {
+      dispatched.push_back(i);
+    }
+  }
+  const int num_dispatched = ssize(dispatched);
+  const int num_threads =
+      scalar_predicate<T>::is_bool
+          ? std::min(update_dispatch_parallelism_.num_threads(), num_dispatched)
+          : 1;
+
+  EventStatus overall_status = EventStatus::DidNothing();
+  if (num_threads <= 1) {
+    for (const SubsystemIndex i : dispatched) {
+      overall_status.KeepMoreSevere(handler(i));
+      if (overall_status.failed()) break;  // Stop at the first disaster.
+    }
+    return overall_status;
+  }
+
+  // The handlers must not race on the cache of a subsystem that more than one
+  // of them may reach (including a dispatched subsystem whose outputs another
+  // one may pull). Bringing the shared output values up to date beforehand is
+  // not enough, because some values are only computed lazily when a handler
+  // uses them (e.g., a SceneGraph's QueryObject computes in the SceneGraph's
+  // cache). So we group the dispatched subsystems that share any upstream
+  // subsystem or input port (by merging the groups of the subsystems that
+  // reach each one), run the handlers of a group one after another in
+  // subsystem order, and only run distinct groups concurrently.
+  std::vector<int> group_of(num_dispatched);
+  std::iota(group_of.begin(), group_of.end(), 0);
+  const auto find_group = [&group_of](int k) {
+    while (group_of[k] != k) {
+      k = group_of[k] = group_of[group_of[k]];
+    }
+    return k;
+  };
+  // The first dispatched subsystem (as an index into `dispatched`) that
+  // reaches each subsystem or input port, or -1 if none does.
+  std::vector<int> subsystem_reached_by(num_subsystems(), -1);
+  std::vector<int> input_reached_by(this->num_input_ports(), -1);
+  const auto reach = [&](int* reached_by, int k) {
+    if (*reached_by < 0) {
+      *reached_by = k;
+      return;
+    }
+    const int a = find_group(*reached_by);
+    const int b = find_group(k);
+    group_of[std::max(a, b)] = std::min(a, b);
+  };
+  for (int k = 0; k < num_dispatched; ++k) {
+    const SubsystemIndex i = dispatched[k];
+    const UpstreamPorts& upstream = update_dispatch_upstream_ports_[i];
+    reach(&subsystem_reached_by[i], k);
+    for (const SubsystemIndex j : upstream.subsystems) {
+      reach(&subsystem_reached_by[j], k);
+    }
+    for (const InputPortIndex p : upstream.inputs) {
+      reach(&input_reached_by[p], k);
+    }
+  }
+  // Each group lists its members in subsystem order, and the groups are
+  // ordered by their first member.
+  std::vector<std::vector<int>> groups;
+  std::vector<int> group_index(num_dispatched, -1);
+  for (int k = 0; k < num_dispatched; ++k) {
+    const int root = find_group(k);
+    if (group_index[root] < 0) {
+      group_index[root] = ssize(groups);
+      groups.emplace_back();
+    }
+    groups[group_index[root]].push_back(k);
+  }
+  const int num_groups = ssize(groups);
+  if (num_groups <= 1) {
+    for (const SubsystemIndex i : dispatched) {
+      overall_status.KeepMoreSevere(handler(i));
+      if (overall_status.failed()) break;  // Stop at the first disaster.
+    }
+    return overall_status;
+  }
+
+  // Exceptions must not escape a parallel region. Instead, we capture them and
+  // combine the outcomes in subsystem order once all groups are done, so that
+  // the caller sees the same status or exception as with serial dispatch.
+  // Within a group, the handlers after a failed one don't run, as in the
+  // serial dispatch.
+  std::vector<EventStatus> statuses(num_dispatched, EventStatus::DidNothing());
+  std::vector<std::exception_ptr> errors(num_dispatched);
+  const auto dispatch = [&](const int, const int64_t g) {
+    for (const int k : groups[g]) {
+      try {
+        statuses[k] = handler(dispatched[k]);
+      } catch (...) {
+        errors[k] = std::current_exception();
+        return;
+      }
+      if (statuses[k].failed()) return;
+    }
+  };
+  DynamicParallelForIndexLoop(DegreeOfParallelism(std::min(num_threads,
+                                                           num_groups)),
+                              0, num_groups, dispatch,
+                              ParallelForBackend::BEST_AVAILABLE);
+  for (int k = 0; k < num_dispatched; ++k) {
+    if (errors[k] != nullptr) std::rethrow_exception(errors[k]);
+    overall_status.KeepMoreSevere(statuses[k]);
+    if (overall_status.failed()) break;  // Stop at the first disaster.
+  }
+  return overall_status;
+}
+
 template <typename T>
 EventStatus Diagram<T>::DispatchPublishHandler(
     const Context<T>& context,
@@ -1228,24 +1406,15 @@ EventStatus Diagram<T>::DispatchDiscreteVariableUpdateHandler(
       dynamic_cast<const DiagramEventCollection<DiscreteUpdateEvent<T>>&>(
           events);
 
-  EventStatus overall_status = EventStatus::DidNothing();
-  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
-    const EventCollection<DiscreteUpdateEvent<T>>& subevents =
-        diagram_events.get_subevent_collection(i);
-
-    if (subevents.HasEvents()) {
-      const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
-      DiscreteValues<T>& subdiscrete =
-          diagram_discrete->get_mutable_subdiscrete(i);
-
-      const EventStatus per_subsystem_status =
-          registered_systems_[i]->CalcDiscreteVariableUpdate(
-              subcontext, subevents, &subdiscrete);
-      overall_status.KeepMoreSevere(per_subsystem_status);
-      if (overall_status.failed()) break;  // Stop at the first disaster.
-    }
-  }
-  return overall_status;
+  return DispatchUpdateHandlers<DiscreteUpdateEvent<T>>(
+      *diagram_context, diagram_events, [&](SubsystemIndex i) {
+        const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
+        DiscreteValues<T>& subdiscrete =
+            diagram_discrete->get_mutable_subdiscrete(i);
+        return registered_systems_[i]->CalcDiscreteVariableUpdate(
+            subcontext, diagram_events.get_subevent_collection(i),
+            &subdiscrete);
+      });
 }
 
 template <typename T>
@@ -1289,23 +1458,13 @@ EventStatus Diagram<T>::DispatchUnrestrictedUpdateHandler(
       dynamic_cast<const DiagramEventCollection<UnrestrictedUpdateEvent<T>>&>(
           events);
 
-  EventStatus overall_status = EventStatus::DidNothing();
-  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
-    const EventCollection<UnrestrictedUpdateEvent<T>>& subevents =
-        diagram_events.get_subevent_collection(i);
-
-    if (subevents.HasEvents()) {
-      const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
-      State<T>& substate = diagram_state->get_mutable_substate(i);
-
-      const EventStatus per_subsystem_status =
-          registered_systems_[i]->CalcUnrestrictedUpdate(subcontext, subevents,
-                                                         &substate);
-      overall_status.KeepMoreSevere(per_subsystem_status);
-      if (overall_status.failed()) break;  // Stop at the first disaster.
-    }
-  }
-  return overall_status;
+  return DispatchUpdateHandlers<UnrestrictedUpdateEvent<T>>(
+      *diagram_context, diagram_events, [&](SubsystemIndex i) {
+        const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
+        State<T>& substate = diagram_state->get_mutable_substate(i);
+        return registered_systems_[i]->CalcUnrestrictedUpdate(
+            subcontext, diagram_events.get_subevent_collection(i), &substate);
+      });
 }
 
 template <typename T>
@@ -1631,6 +1790,22 @@ void Diagram<T>::Initialize(std::unique_ptr<Blueprint> blueprint) {
     ExportOutput(id, *name_iter++);
   }
 
+  // Resolve the source of every exported or connected subsystem input port.
+  for (const auto& [id, index] : input_port_map_) {
+    const InputPortBase& port =
+        id.first->get_input_port(id.second, /* warn_deprecated = */ false);
+    input_port_sources_[&port].diagram_input = index;
+  }
+  for (const auto& [id, upstream] : connection_map_) {
+    const InputPortBase& port =
+        id.first->get_input_port(id.second, /* warn_deprecated = */ false);
+    InputPortSource& source = input_port_sources_[&port];
+    DRAKE_DEMAND(!source.diagram_input.is_valid());
+    source.upstream_subsystem = GetSystemIndexOrAbort(upstream.first);
+    source.upstream_port = &upstream.first->get_output_port(
+        upstream.second, /* warn_deprecated = */ false);
+  }
+
   // Identify the intersection of the subsystems' scalar conversion support.
   // Remove all conversions that at least one subsystem did not support.
   SystemScalarConverter& this_scalar_converter =
@@ -1698,19 +1873,6 @@ void Diagram<T>::ExportOutput(const OutputPortLocator& port, std::string name) {
   this->AddOutputPort(std::move(diagram_port));
 }
 
-template <typename T>
-const AbstractValue& Diagram<T>::EvalSubsystemOutputPort(
-    const DiagramContext<T>& context, const OutputPortLocator& id) const {
-  const System<T>* const system = id.first;
-  const OutputPortIndex port_index(id.second);
-  const OutputPort<T>& port = system->get_output_port(port_index);
-  const SubsystemIndex i = GetSystemIndexOrAbort(system);
-  DRAKE_LOGGER_TRACE("Evaluating output for subsystem {}, port {}",
-                     system->GetSystemPathname(), port_index);
-  const Context<T>& subsystem_context = context.GetSubsystemContext(i);
-  return port.template Eval<AbstractValue>(subsystem_context);
-}
-
 template <typename T>
 typename DiagramContext<T>::InputPortIdentifier
 Diagram<T>::ConvertToContextPortIdentifier(
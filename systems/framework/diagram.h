@@ -12,6 +12,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/pointer_cast.h"
 #include "drake/common/string_map.h"
 #include "drake/systems/framework/diagram_context.h"
@@ -256,6 +257,38 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   bool AreConnected(const OutputPort<T>& output,
                     const InputPort<T>& input) const;
 
+  /// (Advanced) Sets the parallelism with which this Diagram dispatches
+  /// discrete and unrestricted update events to its immediate subsystems. By
+  /// default, the subsystems' update handlers run one after another, in
+  /// subsystem order. With more than one thread, the handlers of the
+  /// subsystems that have an event run concurrently.
+  ///
+  /// Concurrent handlers must not race on the cache of a shared upstream
+  /// subsystem. So, using the connections of this Diagram and the direct
+  /// feedthroughs of its subsystems, the dispatch determines which subsystems
+  /// (and which of this Diagram's input ports) each subsystem's input ports
+  /// may pull values from. Dispatched subsystems that may reach a common one
+  /// (e.g., two MultibodyPlants connected to the same SceneGraph), directly
+  /// or through other such subsystems, form a group whose handlers run one
+  /// after another, in subsystem order. Only distinct groups run concurrently,
+  /// so there is no speedup unless the subsystems with events are independent.
+  ///
+  /// The resulting state is the same as that of the serial dispatch, as is the
+  /// returned status, except that the handlers after a failed one may still
+  /// run if they belong to another group.
+  /// The handlers themselves must not share any mutable state other than
+  /// through their contexts. Publish events are always dispatched serially, as
+  /// their handlers typically have external side effects. Only this Diagram's
+  /// dispatch is affected; nested Diagrams have their own setting. The setting
+  /// does not survive scalar conversion. Dispatch for symbolic::Expression is
+  /// always serial.
+  void set_update_dispatch_parallelism(Parallelism parallelism);
+
+  /// Returns the parallelism set by set_update_dispatch_parallelism().
+  Parallelism update_dispatch_parallelism() const {
+    return update_dispatch_parallelism_;
+  }
+
   using System<T>::GetSubsystemContext;
   using System<T>::GetMutableSubsystemContext;
 
@@ -461,6 +494,35 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
       const EventCollection<UnrestrictedUpdateEvent<T>>& events,
       State<T>* state, Context<T>* context) const final;
 
+  // The ports from which a subsystem's update handlers may pull values through
+  // the subsystem's input ports: the sources of its input ports and, for the
+  // sources with direct feedthrough, the sources of their input ports, and so
+  // on.
+  struct UpstreamPorts {
+    // The subsystems owning those output ports, in increasing order.
+    std::vector<SubsystemIndex> subsystems;
+    // Input ports of this Diagram, in increasing order.
+    std::vector<InputPortIndex> inputs;
+  };
+
+  // Returns the UpstreamPorts of the given subsystem. The `memoize` dictionary
+  // caches the subsystems' reported feedthrough as in
+  // DiagramHasDirectFeedthrough().
+  UpstreamPorts FindUpstreamPorts(
+      SubsystemIndex index,
+      std::unordered_map<const System<T>*, std::multimap<int, int>>* memoize)
+      const;
+
+  // Calls `handler` for each subsystem whose subevent collection in `events`
+  // has events, in subsystem order, and returns the most severe of the
+  // statuses, stopping at the first failure. The calls are concurrent if so
+  // configured by set_update_dispatch_parallelism().
+  template <typename EventType>
+  EventStatus DispatchUpdateHandlers(
+      const DiagramContext<T>& context,
+      const DiagramEventCollection<EventType>& events,
+      const std::function<EventStatus(SubsystemIndex)>& handler) const;
+
   // Tries to recursively find @p target_system's BaseStuff
   // (context / state / etc). nullptr is returned if @p target_system is not
   // a subsystem of this diagram. This template function should only be used
@@ -563,12 +625,6 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   InputPortLocator GetArbitraryInputPortLocator(
       InputPortIndex port_index) const;
 
-  // Returns a reference to the value in the given context, of the specified
-  // output port of one of this Diagram's immediate subsystems, recalculating
-  // if necessary to bring the value up to date.
-  const AbstractValue& EvalSubsystemOutputPort(
-      const DiagramContext<T>& context, const OutputPortLocator& id) const;
-
   // Converts an InputPortLocator to a DiagramContext::InputPortIdentifier.
   // The DiagramContext::InputPortIdentifier contains the index of the System in
   // the diagram, instead of an actual pointer to the System.
@@ -611,6 +667,28 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   // The map of subsystem inputs to inputs of this Diagram.
   std::map<InputPortLocator, InputPortIndex> input_port_map_;
 
+  // The resolved source of a subsystem input port that is either exported or
+  // connected: exactly one of `diagram_input` or `upstream_port` is set.
+  struct InputPortSource {
+    InputPortIndex diagram_input;
+    SubsystemIndex upstream_subsystem;
+    const OutputPort<T>* upstream_port{};
+  };
+
+  // The sources of all exported or connected subsystem input ports, keyed by
+  // the subsystem's port. This is computed once by Initialize() from
+  // connection_map_ and input_port_map_ so that evaluating an input port
+  // takes a single hash lookup.
+  std::unordered_map<const InputPortBase*, InputPortSource>
+      input_port_sources_;
+
+  // See set_update_dispatch_parallelism().
+  Parallelism update_dispatch_parallelism_{false};
+
+  // The UpstreamPorts of each subsystem (indexed by SubsystemIndex), which are
+  // only computed when update_dispatch_parallelism_ has more than one thread.
+  std::vector<UpstreamPorts> update_dispatch_upstream_ports_;
+
   // The index of a cache entry that stores a buffer of time data for use in
   // managing events. It is only used in DoCalcNextUpdateTime(), but is
   // allocated as a cache entry to avoid heap operations during simulation.
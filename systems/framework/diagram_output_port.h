@@ -4,6 +4,7 @@
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
@@ -84,6 +85,18 @@ class DiagramOutputPort final : public OutputPort<T> {
     DRAKE_DEMAND(index.is_valid() && ticket.is_valid());
     DRAKE_DEMAND(source_subsystem_index.is_valid());
     DRAKE_DEMAND(source_output_port != nullptr);
+    // When the source is itself exported from a nested Diagram, skip over it
+    // (and any further levels of export) to the port that computes the value,
+    // so that evaluation is a single call on the innermost subcontext.
+    leaf_subsystem_path_.push_back(source_subsystem_index);
+    leaf_output_port_ = source_output_port;
+    if (const auto* nested =
+            dynamic_cast<const DiagramOutputPort<T>*>(source_output_port)) {
+      leaf_subsystem_path_.insert(leaf_subsystem_path_.end(),
+                                  nested->leaf_subsystem_path_.begin(),
+                                  nested->leaf_subsystem_path_.end());
+      leaf_output_port_ = nested->leaf_output_port_;
+    }
   }
 
   // Asks the source system output port to allocate an appropriate object.
@@ -91,19 +104,19 @@ class DiagramOutputPort final : public OutputPort<T> {
     return source_output_port_->Allocate();
   }
 
-  // Given the whole Diagram context, extracts the appropriate subcontext and
-  // delegates to the source output port.
+  // Given the whole Diagram context, extracts the innermost subcontext and
+  // delegates to the leaf output port.
   void DoCalc(const Context<T>& diagram_context,
               AbstractValue* value) const final {
-    const Context<T>& subcontext = get_subcontext(diagram_context);
-    return source_output_port_->Calc(subcontext, value);
+    const Context<T>& subcontext = get_leaf_subcontext(diagram_context);
+    return leaf_output_port_->Calc(subcontext, value);
   }
 
-  // Given the whole Diagram context, extracts the appropriate subcontext and
-  // delegates to the source output port.
+  // Given the whole Diagram context, extracts the innermost subcontext and
+  // delegates to the leaf output port.
   const AbstractValue& DoEval(const Context<T>& diagram_context) const final {
-    const Context<T>& subcontext = get_subcontext(diagram_context);
-    return source_output_port_->template Eval<AbstractValue>(subcontext);
+    const Context<T>& subcontext = get_leaf_subcontext(diagram_context);
+    return leaf_output_port_->template Eval<AbstractValue>(subcontext);
   }
 
   // Returns the source output port's subsystem, and the ticket for that
@@ -135,8 +148,26 @@ class DiagramOutputPort final : public OutputPort<T> {
         source_subsystem_index_);
   }
 
+  // Like get_subcontext(), but descends through the nested Diagram contexts
+  // along leaf_subsystem_path_ to the context of leaf_output_port_.
+  const Context<T>& get_leaf_subcontext(
+      const Context<T>& diagram_context) const {
+    const Context<T>* subcontext = &diagram_context;
+    for (const SubsystemIndex& index : leaf_subsystem_path_) {
+      subcontext = &static_cast<const DiagramContext<T>*>(subcontext)
+                        ->GetSubsystemContext(index);
+    }
+    return *subcontext;
+  }
+
   const OutputPort<T>* const source_output_port_;
   const SubsystemIndex source_subsystem_index_;
+
+  // The innermost port underlying source_output_port_ (i.e., the first one in
+  // the chain of exports that is not a DiagramOutputPort), and the subsystem
+  // indices that lead from this Diagram's context down to that port's context.
+  const OutputPort<T>* leaf_output_port_{};
+  std::vector<SubsystemIndex> leaf_subsystem_path_;
 };
 
 }  // namespace systems
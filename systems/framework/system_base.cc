@@ -443,6 +443,18 @@ void SystemBase::set_parent_service(
   child->parent_service_ = parent_service;
 }
 
+const ContextBase& SystemBase::GetRootContextBase(const ContextBase& context) {
+  const ContextBase* iterator = &context;
+  while (true) {
+    const ContextBase* parent =
+        internal::SystemBaseContextBaseAttorney::get_parent_base(*iterator);
+    if (parent == nullptr) {
+      return *iterator;
+    }
+    iterator = parent;
+  }
+}
+
 // The only way for a system to evaluate its own input port is if that
 // port is fixed. In that case the port's value is in the corresponding
 // subcontext and we can just return it. Otherwise, the port obtains its value
@@ -568,17 +580,7 @@ void SystemBase::ThrowValidateContextMismatch(
 
   // Check if the context is a sub-context whose root context was created by
   // this Diagram. In that case, we can provide a more specific error message.
-  const ContextBase& root_context = [&context]() -> const ContextBase& {
-    const ContextBase* iterator = &context;
-    while (true) {
-      const ContextBase* parent =
-          internal::SystemBaseContextBaseAttorney::get_parent_base(*iterator);
-      if (parent == nullptr) {
-        return *iterator;
-      }
-      iterator = parent;
-    }
-  }();
+  const ContextBase& root_context = GetRootContextBase(context);
   if (root_context.get_system_id() == get_system_id()) {
     throw std::logic_error(fmt::format(
         "A function call on the root Diagram was passed a subcontext "
@@ -1287,6 +1287,10 @@ class SystemBase : public internal::SystemMessageInterface {
   system. See @ref system_compatibility. */
   internal::SystemId get_system_id() const { return system_id_; }
 
+  /** (Internal use only) Returns the root of the tree of Contexts that
+  `context` belongs to, i.e., `context` itself if it has no parent. */
+  static const ContextBase& GetRootContextBase(const ContextBase& context);
+
   /** The NVI implementation of GetGraphvizFragment() for subclasses to override
   if desired. The default behavior should be sufficient in most cases. */
   virtual GraphvizFragment DoGetGraphvizFragment(
@@ -0,0 +1,143 @@
+#include "drake/systems/framework/context_pool.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/common/test_utilities/limit_malloc.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// A system with one of each kind of numeric Context data that ResetFrom() is
+// expected to copy, plus an output port that depends on all of them.
+class PoolTestSystem : public LeafSystem<double> {
+ public:
+  PoolTestSystem() {
+    DeclareContinuousState(2);
+    DeclareDiscreteState(1);
+    DeclareNumericParameter(BasicVector<double>(1));
+    DeclareVectorInputPort("u", 1);
+    DeclareVectorOutputPort("y", 1, &PoolTestSystem::CalcOutput);
+  }
+
+  int num_calcs() const { return num_calcs_; }
+
+ private:
+  void CalcOutput(const Context<double>& context,
+                  BasicVector<double>* output) const {
+    ++num_calcs_;
+    (*output)[0] = context.get_time() +
+                   context.get_continuous_state_vector()[0] +
+                   context.get_discrete_state(0)[0] +
+                   context.get_numeric_parameter(0)[0] +
+                   get_input_port().Eval(context)[0];
+  }
+
+  mutable int num_calcs_{0};
+};
+
+class ContextPoolTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    prototype_ = system_.CreateDefaultContext();
+    source_ = system_.CreateDefaultContext();
+    source_->SetTime(1.0);
+    source_->SetAccuracy(1e-3);
+    source_->SetContinuousState(Eigen::Vector2d(10.0, 20.0));
+    source_->SetDiscreteState(0, Vector1d(100.0));
+    source_->get_mutable_numeric_parameter(0)[0] = 1000.0;
+    system_.get_input_port().FixValue(source_.get(), 10000.0);
+  }
+
+  PoolTestSystem system_;
+  std::unique_ptr<Context<double>> prototype_;
+  std::unique_ptr<Context<double>> source_;
+};
+
+TEST_F(ContextPoolTest, Construction) {
+  prototype_->SetTime(2.0);
+  ContextPool<double> dut(*prototype_, 3);
+  EXPECT_EQ(dut.size(), 3);
+  for (int i = 0; i < dut.size(); ++i) {
+    EXPECT_EQ(dut.get_context(i).get_time(), 2.0);
+    EXPECT_NE(&dut.get_context(i), prototype_.get());
+    EXPECT_EQ(&dut.get_mutable_context(i), &dut.get_context(i));
+    EXPECT_NO_THROW(system_.ValidateContext(dut.get_context(i)));
+  }
+
+  EXPECT_EQ(ContextPool<double>(*prototype_, 0).size(), 0);
+  EXPECT_THROW(ContextPool<double>(*prototype_, -1), std::exception);
+  EXPECT_THROW(dut.get_context(3), std::exception);
+  EXPECT_THROW(dut.get_mutable_context(-1), std::exception);
+}
+
+TEST_F(ContextPoolTest, ResetFrom) {
+  ContextPool<double> dut(*prototype_, 2);
+  const OutputPort<double>& output = system_.get_output_port();
+
+  Context<double>& context = dut.ResetFrom(1, *source_);
+  EXPECT_EQ(&context, &dut.get_context(1));
+  EXPECT_EQ(context.get_time(), 1.0);
+  EXPECT_EQ(context.get_accuracy(), 1e-3);
+  EXPECT_EQ(context.get_continuous_state_vector().CopyToVector(),
+            Eigen::Vector2d(10.0, 20.0));
+  EXPECT_EQ(context.get_discrete_state(0)[0], 100.0);
+  EXPECT_EQ(context.get_numeric_parameter(0)[0], 1000.0);
+  EXPECT_EQ(output.Eval(context)[0], 11111.0);
+  const FixedInputPortValue* fixed = context.MaybeGetFixedInputPortValue(0);
+  ASSERT_NE(fixed, nullptr);
+
+  // The other slot is unaffected.
+  EXPECT_EQ(dut.get_context(0).get_time(), 0.0);
+  EXPECT_EQ(dut.get_context(0).MaybeGetFixedInputPortValue(0), nullptr);
+
+  // Advancing the slot does not affect the source, and a second reset restores
+  // the source's values, reusing the slot's fixed input port value and
+  // invalidating previously cached results.
+  context.SetTime(5.0);
+  context.get_mutable_numeric_parameter(0)[0] = 0.0;
+  system_.get_input_port().FixValue(source_.get(), 20000.0);
+  const int num_calcs = system_.num_calcs();
+  dut.ResetFrom(1, *source_);
+  EXPECT_EQ(context.MaybeGetFixedInputPortValue(0), fixed);
+  EXPECT_EQ(output.Eval(context)[0], 21111.0);
+  EXPECT_EQ(system_.num_calcs(), num_calcs + 1);
+  EXPECT_EQ(source_->get_time(), 1.0);
+}
+
+TEST_F(ContextPoolTest, ResetFromDoesNotAllocate) {
+  ContextPool<double> dut(*prototype_, 1);
+  // The first reset fixes the slot's input port, which allocates.
+  dut.ResetFrom(0, *source_);
+  {
+    test::LimitMalloc guard({.max_num_allocations = 0});
+    dut.ResetFrom(0, *source_);
+  }
+}
+
+TEST_F(ContextPoolTest, ResetFromErrors) {
+  ContextPool<double> dut(*prototype_, 1);
+  EXPECT_THROW(dut.ResetFrom(1, *source_), std::exception);
+
+  // A Context from a different System is rejected.
+  PoolTestSystem other;
+  auto other_context = other.CreateDefaultContext();
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.ResetFrom(0, *other_context),
+                              ".*root Context of the same System.*");
+
+  // A fixed input port in the slot cannot be unfixed by the reset, and the
+  // failed reset leaves the slot unchanged.
+  dut.ResetFrom(0, *source_);
+  dut.get_mutable_context(0).SetTime(3.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.ResetFrom(0, *prototype_),
+                              ".*input port 0 is fixed in slot 0.*");
+  EXPECT_EQ(dut.get_context(0).get_time(), 3.0);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -441,6 +441,61 @@ TEST_F(HandBuiltDependencies, Notify) {
   ExpectAllStatsMatch();
 }
 
+// A tracker that initiates change events caches what is downstream of it.
+// Check that notifications remain correct when subscriptions change
+// downstream, and when part of the downstream graph has already seen the
+// change event.
+TEST_F(HandBuiltDependencies, NotifyAfterSubscriptionChanges) {
+  // Refer to diagram above to decipher the expected stats below.
+  auto note_upstream2_change = [this](int64_t change_event) {
+    upstream2_->NoteValueChange(change_event);
+    up2_stats_.value_change++;
+    up2_stats_.sent++;  // mid1
+    mid1_stats_.prereq_change++;
+    mid1_stats_.sent += 3;  // down1, down2, entry0
+    down1_stats_.prereq_change++;
+    down2_stats_.prereq_change++;
+    down2_stats_.sent++;  // entry0
+    entry0_stats_.prereq_change += 2;
+    entry0_stats_.ignored++;
+  };
+
+  note_upstream2_change(1LL);
+  ExpectAllStatsMatch();
+
+  // Add a subscriber two levels below upstream2.
+  DependencyTracker& extra =
+      context_.get_mutable_dependency_graph().CreateNewDependencyTracker(
+          "extra");
+  extra.SubscribeToPrerequisite(downstream1_);
+  Stats extra_stats;
+
+  note_upstream2_change(2LL);
+  down1_stats_.sent++;  // extra
+  extra_stats.prereq_change++;
+  ExpectAllStatsMatch();
+  ExpectStatsMatch(&extra, extra_stats);
+
+  // When downstream1 has already seen the change event, the sweep from
+  // upstream2 stops there.
+  entry0_->mark_up_to_date();
+  downstream1_->NoteValueChange(3LL);
+  down1_stats_.value_change++;
+  down1_stats_.sent++;  // extra
+  extra_stats.prereq_change++;
+  note_upstream2_change(3LL);
+  down1_stats_.ignored++;
+  EXPECT_TRUE(entry0_->is_out_of_date());
+  ExpectAllStatsMatch();
+  ExpectStatsMatch(&extra, extra_stats);
+
+  // Remove the subscriber again.
+  extra.UnsubscribeFromPrerequisite(downstream1_);
+  note_upstream2_change(4LL);
+  ExpectAllStatsMatch();
+  ExpectStatsMatch(&extra, extra_stats);
+}
+
 // Clone the dependency graph and make sure the clone works like the
 // original did, but on the new entities!
 TEST_F(HandBuiltDependencies, Clone) {
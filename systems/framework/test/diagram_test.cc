@@ -1,7 +1,12 @@
 #include "drake/systems/framework/diagram.h"
 
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -15,6 +20,10 @@
 #include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/examples/pendulum/pendulum_plant.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/analysis/simulator.h"
 #include "drake/systems/analysis/test_utilities/stateless_system.h"
 #include "drake/systems/framework/basic_vector.h"
 #include "drake/systems/framework/diagram_builder.h"
@@ -2996,6 +3005,30 @@ TEST_F(NestedDiagramContextTest, CachingChangePropagation) {
   EXPECT_TRUE(cache_entry.is_out_of_date(integrator3_subcontext));
 }
 
+// An output port exported through two levels of Diagram evaluates the
+// innermost port directly, but still reports its immediate source and sees
+// changes made to the innermost subcontext.
+TEST_F(NestedDiagramContextTest, NestedExportedOutputPort) {
+  const OutputPort<double>& output = big_diagram_->get_output_port(3);
+  const auto& diagram_output =
+      dynamic_cast<const DiagramOutputPort<double>&>(output);
+  EXPECT_EQ(&diagram_output.get_source_output_port(),
+            &diagram1_->get_output_port(0));
+
+  Context<double>& integrator3_context =
+      big_diagram_->GetMutableSubsystemContext(*integrator3_,
+                                               big_context_.get());
+  integrator3_->set_integral_value(&integrator3_context, Vector1d(3.5));
+  EXPECT_EQ(output.Eval(*big_context_)[0], 3.5);
+
+  integrator3_->set_integral_value(&integrator3_context, Vector1d(-1.25));
+  EXPECT_EQ(output.Eval(*big_context_)[0], -1.25);
+
+  std::unique_ptr<AbstractValue> value = output.Allocate();
+  output.Calc(*big_context_, value.get());
+  EXPECT_EQ(value->get_value<BasicVector<double>>()[0], -1.25);
+}
+
 /* Check that changes made directly to a subcontext still affect the
 parent Diagram's behavior properly. Also, time and accuracy must be identical
 in every subcontext of a Context tree. They are only permitted to change at the
@@ -3600,6 +3633,268 @@ GTEST_TEST(DiagramEventEvaluation, EventStatusHandling) {
               ElementsAreArray(all_discrete, /* count = */ 4));
 }
 
+// A system whose forced discrete and unrestricted updates add its input to its
+// single state variable, which is also its output. The updates fail if the
+// input is negative and throw if it is NaN.
+class AccumulatorSystem : public LeafSystem<double> {
+ public:
+  AccumulatorSystem() {
+    DeclareVectorInputPort("u", 1);
+    const DiscreteStateIndex state_index = DeclareDiscreteState(1);
+    DeclareStateOutputPort("y", state_index);
+    DeclareForcedDiscreteUpdateEvent(&AccumulatorSystem::DiscreteUpdate);
+    DeclareForcedUnrestrictedUpdateEvent(
+        &AccumulatorSystem::UnrestrictedUpdate);
+  }
+
+ private:
+  EventStatus Accumulate(const Context<double>& context, double* x) const {
+    const double u = get_input_port().Eval(context)[0];
+    if (std::isnan(u)) {
+      throw std::logic_error(fmt::format("{} got NaN", get_name()));
+    }
+    if (u < 0) return EventStatus::Failed(this, "negative input");
+    *x += u;
+    return EventStatus::Succeeded();
+  }
+
+  EventStatus DiscreteUpdate(const Context<double>& context,
+                             DiscreteValues<double>* discrete_state) const {
+    return Accumulate(context, &(*discrete_state)[0]);
+  }
+
+  EventStatus UnrestrictedUpdate(const Context<double>& context,
+                                 State<double>* state) const {
+    return Accumulate(context, &state->get_mutable_discrete_state()[0]);
+  }
+};
+
+// Tests that dispatching the updates concurrently produces the same states,
+// statuses, and exceptions as the serial dispatch. Subsystems share upstream
+// values through a Gain (with direct feedthrough), through the outputs of
+// other dispatched subsystems, and through an input port of the Diagram.
+GTEST_TEST(DiagramEventEvaluation, ParallelUpdateDispatch) {
+  DiagramBuilder<double> builder;
+  auto* source = builder.AddSystem<ConstantVectorSource<double>>(0.5);
+  auto* gain = builder.AddSystem<Gain<double>>(2.0, 1);
+  builder.Connect(*source, *gain);
+  std::vector<AccumulatorSystem*> accumulators;
+  for (int i = 0; i < 8; ++i) {
+    accumulators.push_back(builder.AddNamedSystem<AccumulatorSystem>(
+        fmt::format("accumulator{}", i)));
+  }
+  for (int i = 0; i < 4; ++i) {
+    builder.Connect(gain->get_output_port(), accumulators[i]->get_input_port());
+  }
+  builder.Connect(accumulators[0]->get_output_port(),
+                  accumulators[4]->get_input_port());
+  builder.Connect(accumulators[1]->get_output_port(),
+                  accumulators[5]->get_input_port());
+  const InputPortIndex u =
+      builder.ExportInput(accumulators[6]->get_input_port(), "u");
+  builder.ConnectInput(u, accumulators[7]->get_input_port());
+  const auto diagram = builder.Build();
+  EXPECT_EQ(diagram->update_dispatch_parallelism().num_threads(), 1);
+
+  // Returns the states after a few rounds of discrete and unrestricted updates
+  // with the given value of the input port `u`.
+  auto calc_updates = [&diagram, u](double u_value) {
+    auto context = diagram->CreateDefaultContext();
+    diagram->get_input_port(u).FixValue(context.get(), Vector1d(u_value));
+    const auto discrete_events =
+        diagram->AllocateForcedDiscreteUpdateEventCollection();
+    const auto unrestricted_events =
+        diagram->AllocateForcedUnrestrictedUpdateEventCollection();
+    auto discrete_values = diagram->AllocateDiscreteVariables();
+    auto state = context->CloneState();
+    for (int round = 0; round < 3; ++round) {
+      EXPECT_TRUE(diagram
+                      ->CalcDiscreteVariableUpdate(*context, *discrete_events,
+                                                   discrete_values.get())
+                      .succeeded());
+      diagram->ApplyDiscreteVariableUpdate(
+          *discrete_events, discrete_values.get(), context.get());
+      EXPECT_TRUE(
+          diagram
+              ->CalcUnrestrictedUpdate(*context, *unrestricted_events,
+                                       state.get())
+              .succeeded());
+      diagram->ApplyUnrestrictedUpdate(*unrestricted_events, state.get(),
+                                       context.get());
+    }
+    std::vector<double> result;
+    for (int i = 0; i < context->num_discrete_state_groups(); ++i) {
+      result.push_back(context->get_discrete_state(i)[0]);
+    }
+    return result;
+  };
+
+  const std::vector<double> expected = calc_updates(1.5);
+  // Each of accumulators 0-3 gains 1 per update, 4 and 5 gain the states of 0
+  // and 1 (0 + 1 + 2 + ... + 5), and 6 and 7 gain 1.5 per update.
+  EXPECT_THAT(expected, ElementsAreArray({6, 6, 6, 6, 15, 15, 9, 9}));
+
+  diagram->set_update_dispatch_parallelism(Parallelism(4));
+  EXPECT_EQ(diagram->update_dispatch_parallelism().num_threads(), 4);
+  EXPECT_EQ(calc_updates(1.5), expected);
+
+  // The first failure in subsystem order is reported, and likewise for
+  // exceptions.
+  auto context = diagram->CreateDefaultContext();
+  const auto discrete_values = diagram->AllocateDiscreteVariables();
+  const auto discrete_events =
+      diagram->AllocateForcedDiscreteUpdateEventCollection();
+  diagram->get_input_port(u).FixValue(context.get(), Vector1d(-1.0));
+  const EventStatus status = diagram->CalcDiscreteVariableUpdate(
+      *context, *discrete_events, discrete_values.get());
+  EXPECT_TRUE(status.failed());
+  EXPECT_EQ(status.system(), accumulators[6]);
+  diagram->get_input_port(u).FixValue(
+      context.get(), Vector1d(std::numeric_limits<double>::quiet_NaN()));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      diagram->CalcDiscreteVariableUpdate(*context, *discrete_events,
+                                          discrete_values.get()),
+      "accumulator6 got NaN");
+}
+
+class LazyResource;
+
+// The output value of a LazyResource.
+struct ResourceHandle {
+  const LazyResource* resource{};
+};
+
+// A system whose output only hands out access to the system itself, like
+// SceneGraph's QueryObject, so that the work happens when a downstream handler
+// uses the output value, not when the output port is evaluated. It records the
+// largest number of users at once.
+class LazyResource : public LeafSystem<double> {
+ public:
+  LazyResource() {
+    DeclareAbstractOutputPort("handle", &LazyResource::CalcHandle);
+  }
+
+  void Use() const {
+    const int num_users = ++num_users_;
+    int max_users = max_users_;
+    while (num_users > max_users &&
+           !max_users_.compare_exchange_weak(max_users, num_users)) {
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    --num_users_;
+  }
+
+  int max_users() const { return max_users_; }
+
+ private:
+  void CalcHandle(const Context<double>&, ResourceHandle* handle) const {
+    handle->resource = this;
+  }
+
+  mutable std::atomic<int> num_users_{0};
+  mutable std::atomic<int> max_users_{0};
+};
+
+// A system whose forced discrete update uses the LazyResource connected to its
+// input, and counts the updates in its state.
+class ResourceUser : public LeafSystem<double> {
+ public:
+  ResourceUser() {
+    DeclareAbstractInputPort("handle", Value<ResourceHandle>());
+    DeclareDiscreteState(1);
+    DeclareForcedDiscreteUpdateEvent(&ResourceUser::Update);
+  }
+
+ private:
+  EventStatus Update(const Context<double>& context,
+                     DiscreteValues<double>* discrete_state) const {
+    get_input_port().Eval<ResourceHandle>(context).resource->Use();
+    (*discrete_state)[0] += 1;
+    return EventStatus::Succeeded();
+  }
+};
+
+// Subsystems that share an upstream subsystem are never dispatched
+// concurrently, even if they only use it through a value that was computed
+// beforehand.
+GTEST_TEST(DiagramEventEvaluation, ParallelUpdateDispatchSharedUpstream) {
+  DiagramBuilder<double> builder;
+  const auto* resource = builder.AddSystem<LazyResource>();
+  for (int i = 0; i < 3; ++i) {
+    const auto* user = builder.AddSystem<ResourceUser>();
+    builder.Connect(resource->get_output_port(), user->get_input_port());
+  }
+  const auto diagram = builder.Build();
+  diagram->set_update_dispatch_parallelism(Parallelism(3));
+  const auto context = diagram->CreateDefaultContext();
+  const auto discrete_values = diagram->AllocateDiscreteVariables();
+  EXPECT_TRUE(diagram
+                  ->CalcDiscreteVariableUpdate(
+                      *context,
+                      *diagram->AllocateForcedDiscreteUpdateEventCollection(),
+                      discrete_values.get())
+                  .succeeded());
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(discrete_values->get_vector(i)[0], 1);
+  }
+  EXPECT_EQ(resource->max_users(), 1);
+}
+
+// Two plants connected to the same SceneGraph both query it in their discrete
+// updates, which computes poses and contact results lazily in the SceneGraph's
+// cache. The concurrent dispatch must give the same result as the serial one.
+GTEST_TEST(DiagramEventEvaluation, ParallelUpdateDispatchSharedSceneGraph) {
+  using geometry::Box;
+  using geometry::SceneGraph;
+  using geometry::Sphere;
+  using math::RigidTransformd;
+  using multibody::CoulombFriction;
+  using multibody::MultibodyPlant;
+  using multibody::RigidBody;
+  using multibody::SpatialInertia;
+
+  DiagramBuilder<double> builder;
+  auto* scene_graph = builder.AddSystem<SceneGraph<double>>();
+  for (int i = 0; i < 2; ++i) {
+    // Each plant drops a ball onto its own box, far from the other plant's.
+    auto* plant = builder.AddNamedSystem<MultibodyPlant<double>>(
+        fmt::format("plant{}", i), 0.01);
+    plant->RegisterAsSourceForSceneGraph(scene_graph);
+    const CoulombFriction<double> friction(0.5, 0.5);
+    const RigidBody<double>& ball = plant->AddRigidBody(
+        "ball", SpatialInertia<double>::SolidSphereWithMass(1.0, 0.1));
+    plant->RegisterCollisionGeometry(ball, RigidTransformd(), Sphere(0.1),
+                                     "ball", friction);
+    plant->RegisterCollisionGeometry(
+        plant->world_body(), RigidTransformd(Vector3d(10.0 * i, 0, -0.5)),
+        Box(1, 1, 1), "ground", friction);
+    plant->Finalize();
+    plant->SetDefaultFloatingBaseBodyPose(
+        ball, RigidTransformd(Vector3d(10.0 * i, 0, 0.095 + 0.05 * i)));
+    builder.Connect(plant->get_geometry_pose_output_port(),
+                    scene_graph->get_source_pose_port(
+                        plant->get_source_id().value()));
+    builder.Connect(scene_graph->get_query_output_port(),
+                    plant->get_geometry_query_input_port());
+  }
+  const auto diagram = builder.Build();
+
+  auto simulate = [&diagram]() {
+    Simulator<double> simulator(*diagram);
+    simulator.AdvanceTo(0.1);
+    const Context<double>& context = simulator.get_context();
+    std::vector<VectorXd> result;
+    for (int i = 0; i < context.num_discrete_state_groups(); ++i) {
+      result.push_back(context.get_discrete_state(i).value());
+    }
+    return result;
+  };
+  const std::vector<VectorXd> expected = simulate();
+  ASSERT_EQ(expected.size(), 2);
+  diagram->set_update_dispatch_parallelism(Parallelism(2));
+  EXPECT_EQ(simulate(), expected);
+}
+
 class MyEventTestSystem : public LeafSystem<double> {
  public:
   // If p > 0, declares a periodic publish event with p. Otherwise, declares